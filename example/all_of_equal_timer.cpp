@@ -0,0 +1,124 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  all_of_equal, any_of_equal, none_of_equal, one_of_equal and
+//  count_equal_up_to on arrays of numbers, which compare thirty two bytes at
+//  a time, compared with the element at a time loops they used to be:
+//  checking that a bitmap is all set, that a buffer still holds its
+//  sentinel, and that a flag occurs once.
+//
+//  Usage: all_of_equal_timer [size]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/algorithm/cxx11/any_of.hpp>
+#include <boost/algorithm/cxx11/none_of.hpp>
+#include <boost/algorithm/cxx11/one_of.hpp>
+#include <boost/algorithm/count_up_to.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 20;
+
+//  The element at a time versions
+template <typename T>
+bool loop_all_of_equal ( const T *first, const T *last, T x ) {
+    for ( ; first != last; ++first )
+        if ( *first != x )
+            return false;
+    return true;
+    }
+
+template <typename T>
+bool loop_one_of_equal ( const T *first, const T *last, T x ) {
+    for ( ; first != last; ++first )
+        if ( *first == x )
+            break;
+    if ( first == last )
+        return false;
+    for ( ++first; first != last; ++first )
+        if ( *first == x )
+            return false;
+    return true;
+    }
+
+template <typename T>
+std::ptrdiff_t loop_count_up_to ( const T *first, const T *last, T x, std::ptrdiff_t n ) {
+    std::ptrdiff_t count = 0;
+    for ( ; first != last; ++first )
+        if ( *first == x && ++count == n )
+            break;
+    return count;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    const auto start = std::chrono::steady_clock::now ();
+    std::size_t check = 0;
+    for ( int i = 0; i < repeats; ++i )
+        check += f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    if ( check == 1 ) std::cout << "";  //  keep the results alive
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double loop, double blocks ) {
+    std::cout << "  " << std::left << std::setw ( 34 ) << name << std::right << std::fixed << std::setprecision ( 1 )
+              << std::setw ( 10 ) << loop * 1e6 << " us  " << std::setw ( 10 ) << blocks * 1e6 << " us  "
+              << std::setprecision ( 2 ) << std::setw ( 6 ) << loop / blocks << "x" << std::endl;
+    }
+
+template <typename T>
+void numbers ( const std::string &name, std::size_t n, T fill, T flag ) {
+    std::vector<T> v ( n, fill );
+    const T *first = v.data (), *last = first + n;
+    report ( "all_of_equal, " + name, time_it ( [&] { return loop_all_of_equal ( first, last, fill ); }),
+                                      time_it ( [&] { return ba::all_of_equal ( first, last, fill ); }));
+    report ( "none_of_equal, " + name, time_it ( [&] { return !loop_all_of_equal ( first, last, fill ); }),
+                                       time_it ( [&] { return ba::none_of_equal ( first, last, flag ); }));
+    v [ n / 2 ] = flag;
+    report ( "one_of_equal, " + name, time_it ( [&] { return loop_one_of_equal ( first, last, flag ); }),
+                                      time_it ( [&] { return ba::one_of_equal ( first, last, flag ); }));
+    for ( std::size_t i = 0; i < n; i += 97 )
+        v [ i ] = flag;
+    report ( "count_equal_up_to 1000, " + name,
+        time_it ( [&] { return loop_count_up_to ( first, last, flag, 1000 ); }),
+        time_it ( [&] { return ba::count_equal_up_to ( first, last, flag, 1000 ); }));
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 20;
+    std::cout << n << " elements; element at a time, then thirty two bytes at a time" << std::endl;
+
+//  A bitmap with every bit set
+    std::vector<boost::uint64_t> bitmap ( n / 8, ~boost::uint64_t ( 0 ));
+    report ( "bitmap all set", time_it ( [&] { return loop_all_of_equal ( bitmap.data (), bitmap.data () + bitmap.size (), ~boost::uint64_t ( 0 )); }),
+                               time_it ( [&] { return ba::all_of_equal ( bitmap, ~boost::uint64_t ( 0 )); }));
+
+//  A buffer filled with a sentinel, checked before it is reused
+    std::string buffer ( n, '\xAA' );
+    report ( "buffer still holds sentinel", time_it ( [&] { return loop_all_of_equal ( buffer.data (), buffer.data () + n, '\xAA' ); }),
+                                            time_it ( [&] { return ba::all_of_equal ( buffer, '\xAA' ); }));
+    report ( "any_of_equal, absent byte", time_it ( [&] { return !loop_all_of_equal ( buffer.data (), buffer.data () + n, '\xAA' ); }),
+                                          time_it ( [&] { return ba::any_of_equal ( buffer, '\0' ); }));
+
+    numbers<boost::uint8_t>  ( "8 bit",  n, 0, 1 );
+    numbers<boost::uint16_t> ( "16 bit", n, 0, 1 );
+    numbers<boost::uint32_t> ( "32 bit", n, 0, 1 );
+    numbers<float>           ( "float",  n, 0.0f, 1.0f );
+    numbers<double>          ( "double", n, 0.0, 1.0 );
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  The ways of applying a permutation, for small and large items, compared
+//  with following the cycles with swaps; and how the parallel versions
+//  scale with the number of threads.
+//
+//  Usage: apply_permutation_timer [size [max_threads]]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/apply_permutation.hpp>
+#include <boost/algorithm/execution.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 3;
+
+template <std::size_t Size>
+struct item {
+    unsigned long long words [ Size / 8 ];
+    };
+
+//  The swapping algorithm that apply_permutation used to use
+template <typename Item>
+void swap_permutation ( std::vector<Item> &items, std::vector<std::size_t> &ind ) {
+    using std::swap;
+    for ( std::size_t i = 0; i < items.size (); i++ ) {
+        std::size_t current = i;
+        while ( i != ind [ current ] ) {
+            const std::size_t next = ind [ current ];
+            swap ( items [ current ], items [ next ] );
+            ind [ current ] = current;
+            current = next;
+            }
+        ind [ current ] = current;
+        }
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    double total = 0;
+    for ( int i = 0; i < repeats; ++i ) {
+        const std::chrono::duration<double> elapsed = f ();
+        total += elapsed.count ();
+        }
+    return total / repeats;
+    }
+
+void report ( const char *name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 9 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 5 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+template <std::size_t Size>
+void run ( std::size_t n ) {
+    typedef item<Size> Item;
+    std::vector<Item> items ( n ), out ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        items [ i ].words [ 0 ] = i;
+    std::vector<std::size_t> order ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        order [ i ] = i;
+    std::shuffle ( order.begin (), order.end (), std::mt19937 ( 42 ));
+    const std::vector<std::size_t> &corder = order;
+
+    std::cout << n << " items of " << Size << " bytes" << std::endl;
+
+//  Only the permutation is timed, not restoring the indices
+    std::vector<std::size_t> ind;
+    const double base = time_it ( [&] {
+        ind = order;
+        const auto start = std::chrono::steady_clock::now ();
+        swap_permutation ( items, ind );
+        return std::chrono::steady_clock::now () - start;
+        } );
+    report ( "swapping round the cycles", base, base );
+    report ( "apply_permutation", time_it ( [&] {
+        ind = order;
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_permutation ( items, ind );
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    report ( "apply_permutation (const indices)", time_it ( [&] {
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_permutation ( items, corder );
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    report ( "apply_permutation_buffered", time_it ( [&] {
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_permutation_buffered ( items.begin (), items.end (), order.begin (), order.end ());
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    report ( "apply_permutation_copy", time_it ( [&] {
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_permutation_copy ( items.begin (), items.end (), order.begin (), out.begin ());
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    report ( "apply_reverse_permutation", time_it ( [&] {
+        ind = order;
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_reverse_permutation ( items, ind );
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    report ( "apply_reverse_permutation_buffered", time_it ( [&] {
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_reverse_permutation_buffered ( items.begin (), items.end (), order.begin (), order.end ());
+        return std::chrono::steady_clock::now () - start;
+        } ), base );
+    }
+
+//  Four columns of a table, permuted together
+void run_parallel ( std::size_t n, std::size_t max_threads ) {
+    std::vector<std::size_t> order ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        order [ i ] = i;
+    std::shuffle ( order.begin (), order.end (), std::mt19937 ( 43 ));
+    const std::vector<std::size_t> &corder = order;
+    std::vector<int> c1 ( n ), c2 ( n );
+    std::vector<double> c3 ( n );
+    std::vector<item<64> > c4 ( n );
+
+    std::cout << n << " rows of four columns" << std::endl;
+    const double base = time_it ( [&] {
+        const auto start = std::chrono::steady_clock::now ();
+        ba::apply_permutation ( c1, corder );
+        ba::apply_permutation ( c2, corder );
+        ba::apply_permutation ( c3, corder );
+        ba::apply_permutation ( c4, corder );
+        return std::chrono::steady_clock::now () - start;
+        } );
+    report ( "apply_permutation, column by column", base, base );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 ) {
+        report ( ( "apply_permutation ( par (" + std::to_string ( t ) + ") ), column by column" ).c_str (), time_it ( [&] {
+            const auto start = std::chrono::steady_clock::now ();
+            ba::apply_permutation ( ba::execution::par ( t ), c1, corder );
+            ba::apply_permutation ( ba::execution::par ( t ), c2, corder );
+            ba::apply_permutation ( ba::execution::par ( t ), c3, corder );
+            ba::apply_permutation ( ba::execution::par ( t ), c4, corder );
+            return std::chrono::steady_clock::now () - start;
+            } ), base );
+        report ( ( "permutation_cycles::apply_columns ( par (" + std::to_string ( t ) + ") )" ).c_str (), time_it ( [&] {
+            const auto start = std::chrono::steady_clock::now ();
+            const ba::permutation_cycles cycles ( corder );
+            cycles.apply_columns ( ba::execution::par ( t ), c1.begin (), c2.begin (), c3.begin (), c4.begin ());
+            return std::chrono::steady_clock::now () - start;
+            } ), base );
+        }
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t large = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 22;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+    run<8>  ( 10000 );
+    run<64> ( 10000 );
+    run<8>  ( large );
+    run<64> ( large );
+    run_parallel ( large, max_threads );
+    return 0;
+    }
@@ -0,0 +1,74 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  Throughput of the hex, base64 and base32 codecs, comparing the
+//  iterator interfaces with the buffer interfaces.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/algorithm/base64.hpp>
+#include <boost/algorithm/base32.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 20;
+
+template <typename Func>
+void time_it ( const char *name, std::size_t bytes, Func f ) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    std::cout << "    " << std::setw ( 8 ) << std::setprecision ( 4 )
+              << ( bytes * repeats / 1e6 ) / elapsed.count () << " MB/sec  " << name << std::endl;
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 22;
+    std::vector<unsigned char> data ( size );
+    for ( std::size_t i = 0; i < size; ++i )
+        data [ i ] = static_cast<unsigned char> ( std::rand ());
+
+    std::string text;
+    std::vector<unsigned char> bytes;
+    std::cout << "Encoding/decoding " << size << " bytes" << std::endl;
+
+    std::cout << "hex" << std::endl;
+    text.resize ( ba::hex_encoded_size ( size ));
+    time_it ( "hex (back_inserter)", size, [&] { std::string s; ba::hex ( data, std::back_inserter ( s )); } );
+    time_it ( "hex_to_buffer", size, [&] { ba::hex_to_buffer ( data.data (), size, &text[0] ); } );
+    bytes.resize ( size );
+    time_it ( "unhex (back_inserter)", size, [&] { std::vector<unsigned char> v; ba::unhex ( text, std::back_inserter ( v )); } );
+    time_it ( "unhex_to_buffer", size, [&] { ba::unhex_to_buffer ( text.data (), text.size (), bytes.data ()); } );
+
+    std::cout << "base64" << std::endl;
+    text.resize ( ba::base64_encoded_size ( size ));
+    time_it ( "base64_encode (back_inserter)", size, [&] { std::string s; ba::base64_encode ( data, std::back_inserter ( s )); } );
+    time_it ( "base64_encode_to_buffer", size, [&] { ba::base64_encode_to_buffer ( data.data (), size, &text[0] ); } );
+    bytes.resize ( ba::base64_decoded_size ( text.size ()));
+    time_it ( "base64_decode (back_inserter)", size, [&] { std::vector<unsigned char> v; ba::base64_decode ( text, std::back_inserter ( v )); } );
+    time_it ( "base64_decode_to_buffer", size, [&] { ba::base64_decode_to_buffer ( text.data (), text.size (), bytes.data ()); } );
+
+    std::cout << "base32" << std::endl;
+    text.resize ( ba::base32_encoded_size ( size ));
+    time_it ( "base32_encode (back_inserter)", size, [&] { std::string s; ba::base32_encode ( data, std::back_inserter ( s )); } );
+    time_it ( "base32_encode_to_buffer", size, [&] { ba::base32_encode_to_buffer ( data.data (), size, &text[0] ); } );
+    bytes.resize ( ba::base32_decoded_size ( text.size ()));
+    time_it ( "base32_decode (back_inserter)", size, [&] { std::vector<unsigned char> v; ba::base32_decode ( text, std::back_inserter ( v )); } );
+    time_it ( "base32_decode_to_buffer", size, [&] { ba::base32_decode_to_buffer ( text.data (), text.size (), bytes.data ()); } );
+
+    return 0;
+    }
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  copy_if and partition_copy on arrays of random numbers, keeping from 1%
+//  to 99% of them, with the element at a time loops (which branch on every
+//  result) and with the block-wise versions (which don't).
+//
+//  Usage: copy_if_timer [size]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/cxx11/copy_if.hpp>
+#include <boost/algorithm/cxx11/partition_copy.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 20;
+
+//  The element at a time versions
+template <typename T, typename Pred>
+T *loop_copy_if ( const T *first, const T *last, T *result, Pred p ) {
+    for ( ; first != last; ++first )
+        if ( p ( *first ))
+            *result++ = *first;
+    return result;
+    }
+
+template <typename T, typename Pred>
+std::pair<T *, T *> loop_partition_copy ( const T *first, const T *last, T *out_true, T *out_false, Pred p ) {
+    for ( ; first != last; ++first )
+        if ( p ( *first ))
+            *out_true++ = *first;
+        else
+            *out_false++ = *first;
+    return std::make_pair ( out_true, out_false );
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    const auto start = std::chrono::steady_clock::now ();
+    std::size_t check = 0;
+    for ( int i = 0; i < repeats; ++i )
+        check += f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    if ( check == 1 ) std::cout << "";  //  keep the results alive
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double loop, double blocks ) {
+    std::cout << "  " << std::left << std::setw ( 30 ) << name << std::right << std::fixed << std::setprecision ( 1 )
+              << std::setw ( 10 ) << loop * 1e6 << " us  " << std::setw ( 10 ) << blocks * 1e6 << " us  "
+              << std::setprecision ( 2 ) << std::setw ( 6 ) << loop / blocks << "x" << std::endl;
+    }
+
+template <typename T>
+void numbers ( const std::string &name, std::size_t n ) {
+    std::mt19937 gen ( 1234 );
+    std::uniform_int_distribution<int> dist ( 0, 9999 );
+    std::vector<T> v ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = static_cast<T> ( dist ( gen ));
+    std::vector<T> out ( n ), out2 ( n );
+    const T *first = v.data (), *last = first + n;
+
+    const int percents [] = { 1, 5, 25, 50, 75, 95, 99 };
+    for ( int percent : percents ) {
+        const T threshold = static_cast<T> ( percent * 100 );
+        auto keep = [threshold] ( T x ) { return x < threshold; };
+        const std::string suffix = ", " + name + ", " + std::to_string ( percent ) + "%";
+        report ( "copy_if" + suffix,
+            time_it ( [&] { return loop_copy_if ( first, last, out.data (), keep ) - out.data (); }),
+            time_it ( [&] { return ba::copy_if ( first, last, out.data (), keep ) - out.data (); }));
+        report ( "partition_copy" + suffix,
+            time_it ( [&] { return loop_partition_copy ( first, last, out.data (), out2.data (), keep ).first - out.data (); }),
+            time_it ( [&] { return ba::partition_copy ( first, last, out.data (), out2.data (), keep ).first - out.data (); }));
+        }
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 20;
+    std::cout << n << " elements; element at a time, then a block at a time" << std::endl;
+
+    numbers<boost::int32_t> ( "32 bit", n );
+    numbers<double>         ( "double", n );
+    numbers<boost::int16_t> ( "16 bit", n );
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  find_backward, find_not_backward and find_not on arrays of integers,
+//  which search a word at a time, compared with the element at a time loops
+//  they used to be: finding the last line break in a read buffer, stripping
+//  the padding from fixed width records, and skipping the zeros at the
+//  start of arrays of each size of integer.
+//
+//  Usage: find_backward_timer [size]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/find_backward.hpp>
+#include <boost/algorithm/find_not.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 20;
+
+//  The element at a time versions
+template <typename T>
+const T *loop_find_backward ( const T *first, const T *last, T x ) {
+    for ( const T *it = last; it != first; )
+        if ( *--it == x )
+            return it;
+    return last;
+    }
+
+template <typename T>
+const T *loop_find_not_backward ( const T *first, const T *last, T x ) {
+    for ( const T *it = last; it != first; )
+        if ( *--it != x )
+            return it;
+    return last;
+    }
+
+template <typename T>
+const T *loop_find_not ( const T *first, const T *last, T x ) {
+    for ( ; first != last; ++first )
+        if ( *first != x )
+            break;
+    return first;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    const auto start = std::chrono::steady_clock::now ();
+    std::size_t check = 0;
+    for ( int i = 0; i < repeats; ++i )
+        check += f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    if ( check == 1 ) std::cout << "";  //  keep the results alive
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double loop, double words ) {
+    std::cout << "  " << std::left << std::setw ( 34 ) << name << std::right << std::fixed << std::setprecision ( 1 )
+              << std::setw ( 10 ) << loop * 1e6 << " us  " << std::setw ( 10 ) << words * 1e6 << " us  "
+              << std::setprecision ( 2 ) << std::setw ( 6 ) << loop / words << "x" << std::endl;
+    }
+
+template <typename T>
+void zeros ( const std::string &name, std::size_t n ) {
+    std::vector<T> v ( n, T ( 0 ));
+    v.back () = T ( 1 );
+    const T *first = v.data (), *last = first + n;
+    report ( "find_not, " + name, time_it ( [&] { return loop_find_not ( first, last, T ( 0 )) - first; }),
+                                  time_it ( [&] { return ba::find_not ( first, last, T ( 0 )) - first; }));
+    v.back () = T ( 0 );
+    v.front () = T ( 1 );
+    report ( "find_not_backward, " + name,
+        time_it ( [&] { return loop_find_not_backward ( first, last, T ( 0 )) - first; }),
+        time_it ( [&] { return ba::find_not_backward ( first, last, T ( 0 )) - first; }));
+    report ( "find_backward, " + name,
+        time_it ( [&] { return loop_find_backward ( first, last, T ( 1 )) - first; }),
+        time_it ( [&] { return ba::find_backward ( first, last, T ( 1 )) - first; }));
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 20;
+    std::cout << n << " elements; element at a time, then word at a time" << std::endl;
+
+//  A read buffer with one line break, near the start
+    std::string buffer ( n, 'x' );
+    buffer [ 10 ] = '\n';
+    const char *first = buffer.data (), *last = first + n;
+    report ( "last line break", time_it ( [&] { return loop_find_backward ( first, last, '\n' ) - first; }),
+                                time_it ( [&] { return ba::find_backward ( first, last, '\n' ) - first; }));
+
+//  Fixed width records of 80 characters, mostly padding
+    std::string records ( n, ' ' );
+    for ( std::size_t i = 0; i + 80 <= n; i += 80 )
+        records.replace ( i, 12, "record field" );
+    std::size_t lengths = 0;
+    const double loop = time_it ( [&] {
+        for ( std::size_t i = 0; i + 80 <= n; i += 80 )
+            lengths += loop_find_not_backward ( records.data () + i, records.data () + i + 80, ' ' ) - records.data () - i;
+        return lengths; });
+    const double words = time_it ( [&] {
+        for ( std::size_t i = 0; i + 80 <= n; i += 80 )
+            lengths += ba::find_not_backward ( records.data () + i, records.data () + i + 80, ' ' ) - records.data () - i;
+        return lengths; });
+    report ( "strip padding of 80 byte records", loop, words );
+
+    zeros<boost::uint8_t>  ( "8 bit",  n );
+    zeros<boost::uint16_t> ( "16 bit", n );
+    zeros<boost::uint32_t> ( "32 bit", n );
+    zeros<boost::uint64_t> ( "64 bit", n );
+    return 0;
+}
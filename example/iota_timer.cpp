@@ -0,0 +1,79 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  Filling arrays of numbers with iota, compared with counting one element
+//  at a time, sequentially and with increasing numbers of threads.
+//
+//  Usage: iota_timer [size [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/iota.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 10;
+volatile double sink;
+
+//  The loop iota used before
+template <typename ForwardIterator, typename T>
+void loop_iota ( ForwardIterator first, ForwardIterator last, T value ) {
+    for ( ; first != last; ++first, ++value )
+        *first = value;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    f ();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 8 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 6 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+template <typename T>
+void run ( const char *type, std::size_t size, std::size_t max_threads ) {
+    std::vector<T> a ( size );
+
+    std::cout << "iota, " << type << std::endl;
+    const double loop = time_it ( [&] { loop_iota ( a.begin (), a.end (), T ( 0 )); sink = a.back (); } );
+    report ( "loop", loop, loop );
+    report ( "iota", time_it ( [&] { ba::iota ( a.begin (), a.end (), T ( 0 )); sink = a.back (); } ), loop );
+    report ( "iota (step 3)", time_it ( [&] { ba::iota ( a.begin (), a.end (), T ( 0 ), T ( 3 )); sink = a.back (); } ), loop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "iota (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { ba::iota ( ba::execution::par ( t ), a.begin (), a.end (), T ( 0 )); sink = a.back (); } ), loop );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 24;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+
+    std::cout << size << " elements, up to " << max_threads << " threads" << std::endl;
+    run<boost::int32_t>  ( "int32",  size, max_threads );
+    run<boost::uint64_t> ( "uint64", size, max_threads );
+    run<float>           ( "float",  size, max_threads );
+    run<double>          ( "double", size, max_threads );
+    return 0;
+    }
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  Checking that a partitioned array of numbers is partitioned around a
+//  threshold, with the element at a time loop, with the block-wise version,
+//  and with increasing numbers of threads.
+//
+//  Usage: is_partitioned_timer [size [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/is_partitioned.hpp>
+#include <boost/algorithm/is_partitioned_until.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 10;
+volatile std::size_t sink;
+
+//  The loops is_partitioned_until used before
+template <typename InputIterator, typename UnaryPredicate>
+InputIterator loop_partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p ) {
+    for ( ; first != last; ++first )
+        if ( !p ( *first ))
+            break;
+    for ( ; first != last; ++first )
+        if ( p ( *first ))
+            return first;
+    return last;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    sink = f ();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        sink = f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 8 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 6 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+template <typename T>
+void run ( const char *type, std::size_t size, std::size_t max_threads ) {
+    std::vector<T> a ( size );
+    for ( std::size_t i = 0; i < size; ++i )
+        a [ i ] = static_cast<T> ( i < size / 3 ? std::rand () % 50 : 50 + std::rand () % 50 );
+    const T limit = static_cast<T> ( 50 );
+    auto below = [limit] ( T x ) { return x < limit; };
+
+    std::cout << "is_partitioned_until, " << type << std::endl;
+    const double loop = time_it ( [&] { return std::size_t ( loop_partitioned_until ( a.begin (), a.end (), below ) - a.begin ()); } );
+    report ( "loop", loop, loop );
+    report ( "is_partitioned_until", time_it ( [&] { return std::size_t ( ba::is_partitioned_until ( a.begin (), a.end (), below ) - a.begin ()); } ), loop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "is_partitioned_until (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { return std::size_t ( ba::is_partitioned_until ( ba::execution::par ( t ), a.begin (), a.end (), below ) - a.begin ()); } ), loop );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 24;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+
+    std::cout << size << " elements, up to " << max_threads << " threads" << std::endl;
+    run<boost::int8_t>  ( "int8",   size, max_threads );
+    run<boost::int32_t> ( "int32",  size, max_threads );
+    run<float>          ( "float",  size, max_threads );
+    run<double>         ( "double", size, max_threads );
+    return 0;
+    }
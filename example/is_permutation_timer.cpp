@@ -0,0 +1,116 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  is_permutation on a shuffled copy of a sequence, for each of the ways it
+//  can be checked (counting, hashing), and is_permutation_ordered, compared
+//  with the quadratic search that is_permutation used to do for every type.
+//
+//  Usage: is_permutation_timer [size]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/cxx14/is_permutation.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 3;
+
+template <typename Func>
+double time_it ( Func f ) {
+    double total = 0;
+    for ( int i = 0; i < repeats; ++i ) {
+        const auto start = std::chrono::steady_clock::now ();
+        if ( !f ())
+            std::cout << "    wrong answer!" << std::endl;
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+        total += elapsed.count ();
+        }
+    return total / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 10 ) << std::fixed << std::setprecision ( 3 )
+              << seconds * 1e3 << " ms  " << std::setw ( 8 ) << std::setprecision ( 1 )
+              << baseline / seconds << "x  " << name << std::endl;
+    }
+
+//  Only equality, so only the quadratic search applies
+struct token {
+    int v;
+    bool operator == ( const token &rhs ) const { return v == rhs.v; }
+    bool operator != ( const token &rhs ) const { return v != rhs.v; }
+    };
+
+struct pair_hash {
+    std::size_t operator () ( const std::pair<int, int> &p ) const { return std::hash<int> () ( p.first * 1000003 + p.second ); }
+    };
+
+struct token_hash {
+    std::size_t operator () ( const token &t ) const { return std::hash<int> () ( t.v ); }
+    };
+
+template <typename T, typename Hash>
+double run ( const std::string &title, const std::vector<T> &v1, Hash h ) {
+    std::vector<T> v2 ( v1 );
+    std::shuffle ( v2.begin (), v2.end (), std::mt19937 ( 17 ));
+    std::cout << title << ", " << v1.size () << " elements" << std::endl;
+
+    const double quadratic = time_it ( [&] { return ba::detail::is_permutation_inner (
+        v1.begin (), v1.end (), v2.begin (), v2.end (), std::equal_to<T> ()); });
+    report ( "quadratic search", quadratic, quadratic );
+    report ( "is_permutation", time_it ( [&] { return ba::is_permutation (
+        v1.begin (), v1.end (), v2.begin (), v2.end ()); }), quadratic );
+    report ( "is_permutation with a hash", time_it ( [&] { return ba::is_permutation (
+        v1.begin (), v1.end (), v2.begin (), v2.end (), std::equal_to<T> (), h ); }), quadratic );
+    return quadratic;
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 20000;
+    std::mt19937 gen ( 42 );
+
+    std::vector<unsigned char> bytes ( n );
+    std::vector<short> shorts ( n );
+    std::vector<int> ints ( n );
+    std::vector<double> doubles ( n );
+    std::vector<std::string> strings ( n );
+    std::vector<std::pair<int, int> > pairs ( n );
+    std::vector<token> tokens ( n );
+    for ( std::size_t i = 0; i < n; ++i ) {
+        bytes [ i ]   = static_cast<unsigned char> ( gen ());
+        shorts [ i ]  = static_cast<short> ( gen ());
+        ints [ i ]    = static_cast<int> ( gen () % ( n / 4 + 1 ));
+        doubles [ i ] = std::uniform_real_distribution<double> () ( gen );
+        strings [ i ] = "key-" + std::to_string ( gen () % n );
+        pairs [ i ]   = std::make_pair ( static_cast<int> ( gen () % 100 ), static_cast<int> ( gen () % 100 ));
+        tokens [ i ].v = static_cast<int> ( gen () % n );
+        }
+
+    run ( "unsigned char (counting)", bytes, std::hash<unsigned char> ());
+    run ( "short (counting)", shorts, std::hash<short> ());
+    run ( "int (hashing)", ints, std::hash<int> ());
+    run ( "double (hashing)", doubles, std::hash<double> ());
+    run ( "std::string (hashing)", strings, std::hash<std::string> ());
+    const double quadratic = run ( "std::pair<int, int> (quadratic)", pairs, pair_hash ());
+    std::vector<std::pair<int, int> > shuffled ( pairs );
+    std::shuffle ( shuffled.begin (), shuffled.end (), std::mt19937 ( 17 ));
+    report ( "is_permutation_ordered", time_it ( [&] { return ba::is_permutation_ordered (
+        pairs.begin (), pairs.end (), shuffled.begin (), shuffled.end (), std::less<std::pair<int, int> > ()); }), quadratic );
+    run ( "equality only (quadratic)", tokens, token_hash ());
+    return 0;
+}
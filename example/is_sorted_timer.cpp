@@ -0,0 +1,92 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  is_sorted and is_increasing on sorted arrays of numbers (the worst case:
+//  every pair is compared), element at a time, 256 bytes at a time, and with
+//  execution::par.
+//
+//  Usage: is_sorted_timer [size]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+const int repeats = 20;
+
+//  The element at a time version
+template <typename T, typename Pred>
+bool loop_is_sorted ( const T *first, const T *last, Pred p ) {
+    if ( first == last )
+        return true;
+    for ( const T *next = first + 1; next != last; ++next )
+        if ( p ( *next, next [ -1 ] ))
+            return false;
+    return true;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    const auto start = std::chrono::steady_clock::now ();
+    std::size_t check = 0;
+    for ( int i = 0; i < repeats; ++i )
+        check += f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    if ( check == 1 ) std::cout << "";  //  keep the results alive
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double loop, double blocks, double par ) {
+    std::cout << "  " << std::left << std::setw ( 30 ) << name << std::right << std::fixed << std::setprecision ( 1 )
+              << std::setw ( 10 ) << loop * 1e6 << " us  " << std::setw ( 10 ) << blocks * 1e6 << " us  "
+              << std::setprecision ( 2 ) << std::setw ( 6 ) << loop / blocks << "x"
+              << std::setprecision ( 1 ) << std::setw ( 10 ) << par * 1e6 << " us  "
+              << std::setprecision ( 2 ) << std::setw ( 6 ) << loop / par << "x" << std::endl;
+    }
+
+template <typename T>
+void numbers ( const std::string &name, std::size_t n ) {
+    std::vector<T> v ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = static_cast<T> ( i * 100 / n );
+    const T *first = v.data (), *last = first + n;
+    report ( "is_increasing, " + name,
+        time_it ( [&] { return loop_is_sorted ( first, last, std::less<T> ()); }),
+        time_it ( [&] { return ba::is_increasing ( first, last ); }),
+        time_it ( [&] { return ba::is_increasing ( ex::par, first, last ); }));
+    std::vector<T> r ( v.rbegin (), v.rend ());
+    first = r.data (), last = first + n;
+    report ( "is_decreasing, " + name,
+        time_it ( [&] { return loop_is_sorted ( first, last, std::greater<T> ()); }),
+        time_it ( [&] { return ba::is_decreasing ( first, last ); }),
+        time_it ( [&] { return ba::is_decreasing ( ex::par, first, last ); }));
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 22;
+    std::cout << n << " elements; element at a time, then 256 bytes at a time, then execution::par" << std::endl;
+
+    numbers<boost::uint8_t>  ( "8 bit",  n );
+    numbers<boost::int16_t>  ( "16 bit", n );
+    numbers<boost::int32_t>  ( "32 bit", n );
+    numbers<boost::int64_t>  ( "64 bit", n );
+    numbers<float>           ( "float",  n );
+    numbers<double>          ( "double", n );
+    return 0;
+}
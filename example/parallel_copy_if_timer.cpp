@@ -0,0 +1,97 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  Filtering a column of numbers with copy_if and partition_copy, compared
+//  with a plain loop, sequentially and with increasing numbers of threads.
+//
+//  Usage: parallel_copy_if_timer [size [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/copy_if.hpp>
+#include <boost/algorithm/cxx11/partition_copy.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 10;
+volatile std::size_t sink;
+
+template <typename Func>
+double time_it ( Func f ) {
+    sink = f ();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        sink = f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 8 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 6 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+template <typename T>
+void run ( const char *type, std::size_t size, std::size_t max_threads, int percent ) {
+    std::vector<T> a ( size ), out ( size ), rest ( size );
+    for ( std::size_t i = 0; i < size; ++i )
+        a [ i ] = static_cast<T> ( std::rand () % 100 );
+    const T limit = static_cast<T> ( percent );
+    auto keep = [limit] ( T x ) { return x < limit; };
+
+    std::cout << "copy_if, " << type << ", keeping " << percent << "%" << std::endl;
+    const double loop = time_it ( [&] {
+        T *result = out.data ();
+        for ( std::size_t i = 0; i < size; ++i )
+            if ( keep ( a [ i ] ))
+                *result++ = a [ i ];
+        return std::size_t ( result - out.data ());
+        } );
+    report ( "loop", loop, loop );
+    report ( "copy_if", time_it ( [&] { return std::size_t ( ba::copy_if ( a.begin (), a.end (), out.begin (), keep ) - out.begin ()); } ), loop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "copy_if (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { return std::size_t ( ba::copy_if ( ba::execution::par ( t ), a.begin (), a.end (), out.begin (), keep ) - out.begin ()); } ), loop );
+
+    std::cout << "partition_copy, " << type << ", keeping " << percent << "%" << std::endl;
+    const double ploop = time_it ( [&] {
+        T *t = out.data (), *f = rest.data ();
+        for ( std::size_t i = 0; i < size; ++i )
+            if ( keep ( a [ i ] ))
+                *t++ = a [ i ];
+            else
+                *f++ = a [ i ];
+        return std::size_t ( t - out.data ());
+        } );
+    report ( "loop", ploop, ploop );
+    report ( "partition_copy", time_it ( [&] { return std::size_t ( ba::partition_copy ( a.begin (), a.end (), out.begin (), rest.begin (), keep ).first - out.begin ()); } ), ploop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "partition_copy (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { return std::size_t ( ba::partition_copy ( ba::execution::par ( t ), a.begin (), a.end (), out.begin (), rest.begin (), keep ).first - out.begin ()); } ), ploop );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 24;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+
+    std::cout << size << " elements, up to " << max_threads << " threads" << std::endl;
+    run<boost::int32_t> ( "int32",  size, max_threads, 50 );
+    run<boost::int32_t> ( "int32",  size, max_threads, 5 );
+    run<double>         ( "double", size, max_threads, 50 );
+    return 0;
+    }
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  Searching sorted arrays of increasing size for random values: with the
+//  old halving loop of partition_point, with the branchless version, with
+//  std::lower_bound, and with an eytzinger_index, one value at a time and
+//  in batches.
+//
+//  Usage: partition_point_timer [queries]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/cxx11/partition_point.hpp>
+#include <boost/algorithm/eytzinger_index.hpp>
+
+namespace ba = boost::algorithm;
+
+//  The loop partition_point used before
+template <typename ForwardIterator, typename Predicate>
+ForwardIterator loop_partition_point ( ForwardIterator first, ForwardIterator last, Predicate p ) {
+    std::size_t dist = std::distance ( first, last );
+    while ( first != last ) {
+        std::size_t d2 = dist / 2;
+        ForwardIterator ret_val = first;
+        std::advance ( ret_val, d2 );
+        if ( p ( *ret_val )) {
+            first = ++ret_val;
+            dist -= d2 + 1;
+            }
+        else {
+            last = ret_val;
+            dist = d2;
+            }
+        }
+    return first;
+    }
+
+template <typename Func>
+double time_it ( Func f ) {
+    const auto start = std::chrono::steady_clock::now ();
+    const std::size_t check = f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    if ( check == 1 ) std::cout << "";  //  keep the results alive
+    return elapsed.count ();
+    }
+
+void report ( const std::string &name, double seconds, std::size_t queries, double baseline ) {
+    std::cout << "    " << std::left << std::setw ( 28 ) << name << std::right << std::fixed << std::setprecision ( 1 )
+              << std::setw ( 8 ) << seconds * 1e9 / queries << " ns  " << std::setprecision ( 2 )
+              << std::setw ( 6 ) << baseline / seconds << "x" << std::endl;
+    }
+
+void run ( std::size_t n, std::size_t queries ) {
+    std::mt19937 gen ( 1234 );
+    std::vector<boost::uint32_t> v ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = static_cast<boost::uint32_t> ( gen ());
+    std::sort ( v.begin (), v.end ());
+    std::vector<boost::uint32_t> q ( queries );
+    for ( std::size_t i = 0; i < queries; ++i )
+        q [ i ] = static_cast<boost::uint32_t> ( gen ());
+    const ba::eytzinger_index<boost::uint32_t> index ( v );
+    std::vector<std::size_t> out ( queries );
+
+    std::cout << n << " elements (" << n * sizeof ( boost::uint32_t ) / 1024 << " KiB)" << std::endl;
+    const double loop = time_it ( [&] {
+        std::size_t sum = 0;
+        for ( std::size_t i = 0; i < queries; ++i ) {
+            const boost::uint32_t x = q [ i ];
+            sum += loop_partition_point ( v.begin (), v.end (), [x] ( boost::uint32_t e ) { return e < x; } ) - v.begin ();
+            }
+        return sum;
+        } );
+    report ( "loop", loop, queries, loop );
+    report ( "partition_point", time_it ( [&] {
+        std::size_t sum = 0;
+        for ( std::size_t i = 0; i < queries; ++i ) {
+            const boost::uint32_t x = q [ i ];
+            sum += ba::partition_point ( v.begin (), v.end (), [x] ( boost::uint32_t e ) { return e < x; } ) - v.begin ();
+            }
+        return sum;
+        } ), queries, loop );
+    report ( "std::lower_bound", time_it ( [&] {
+        std::size_t sum = 0;
+        for ( std::size_t i = 0; i < queries; ++i )
+            sum += std::lower_bound ( v.begin (), v.end (), q [ i ] ) - v.begin ();
+        return sum;
+        } ), queries, loop );
+    report ( "eytzinger_index", time_it ( [&] {
+        std::size_t sum = 0;
+        for ( std::size_t i = 0; i < queries; ++i )
+            sum += index.lower_bound ( q [ i ] );
+        return sum;
+        } ), queries, loop );
+    report ( "eytzinger_index (batched)", time_it ( [&] {
+        index.lower_bound ( q.begin (), q.end (), out.begin ());
+        return out [ queries / 2 ];
+        } ), queries, loop );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t queries = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 20;
+    std::cout << queries << " searches for random values" << std::endl;
+    for ( std::size_t n = 1 << 10; n <= ( std::size_t ( 1 ) << 26 ); n <<= 4 )
+        run ( n, queries );
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  reduce and transform_reduce (a dot product) compared with a plain
+//  left-to-right loop, sequentially and with increasing numbers of threads.
+//
+//  Usage: reduce_timer [size [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx17/reduce.hpp>
+#include <boost/algorithm/cxx17/transform_reduce.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 10;
+volatile double sink;
+
+template <typename Func>
+double time_it ( Func f ) {
+    sink = f ();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        sink = f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    return elapsed.count () / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 8 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 6 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+template <typename T>
+void run ( const char *type, std::size_t size, std::size_t max_threads ) {
+    std::vector<T> a ( size ), b ( size );
+    for ( std::size_t i = 0; i < size; ++i ) {
+        a [ i ] = static_cast<T> ( std::rand () % 100 );
+        b [ i ] = static_cast<T> ( std::rand () % 100 );
+        }
+
+    std::cout << "reduce, " << type << std::endl;
+    const double loop = time_it ( [&] { T acc = T (); for ( std::size_t i = 0; i < size; ++i ) acc += a [ i ]; return double ( acc ); } );
+    report ( "loop", loop, loop );
+    report ( "reduce", time_it ( [&] { return double ( ba::reduce ( a.begin (), a.end (), T ())); } ), loop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "reduce (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { return double ( ba::reduce ( ba::execution::par ( t ), a.begin (), a.end (), T ())); } ), loop );
+
+    std::cout << "transform_reduce (dot product), " << type << std::endl;
+    const double dloop = time_it ( [&] { T acc = T (); for ( std::size_t i = 0; i < size; ++i ) acc += a [ i ] * b [ i ]; return double ( acc ); } );
+    report ( "loop", dloop, dloop );
+    report ( "transform_reduce", time_it ( [&] { return double ( ba::transform_reduce ( a.begin (), a.end (), b.begin (), T ())); } ), dloop );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "transform_reduce (par " + std::to_string ( t ) + ")",
+                 time_it ( [&] { return double ( ba::transform_reduce ( ba::execution::par ( t ), a.begin (), a.end (), b.begin (), T ())); } ), dloop );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 24;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+
+    std::cout << size << " elements, up to " << max_threads << " threads" << std::endl;
+    run<float>  ( "float",  size, max_threads );
+    run<double> ( "double", size, max_threads );
+    run<int>    ( "int",    size, max_threads );
+    return 0;
+    }
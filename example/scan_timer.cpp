@@ -0,0 +1,80 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  How the parallel scans scale with the number of threads, compared with
+//  the sequential versions.
+//
+//  Usage: scan_timer [size [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx17/inclusive_scan.hpp>
+#include <boost/algorithm/cxx17/exclusive_scan.hpp>
+#include <boost/algorithm/cxx17/transform_inclusive_scan.hpp>
+
+namespace ba = boost::algorithm;
+
+const int repeats = 5;
+
+template <typename Func>
+double time_it ( Func f ) {
+    f ();   // warm up (and fault in the output)
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    for ( int i = 0; i < repeats; ++i )
+        f ();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    return elapsed.count () / repeats;
+    }
+
+void report ( const char *name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 8 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 5 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t size = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 1 << 25;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+
+    std::vector<unsigned> in ( size ), out ( size );
+    for ( std::size_t i = 0; i < size; ++i )
+        in [ i ] = static_cast<unsigned> ( std::rand () % 16 );
+    std::cout << "Scanning " << size << " values, up to " << max_threads << " threads" << std::endl;
+
+    std::cout << "inclusive_scan" << std::endl;
+    const double inc = time_it ( [&] { ba::inclusive_scan ( in.begin (), in.end (), out.begin ()); } );
+    report ( "sequential", inc, inc );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( ( "par (" + std::to_string ( t ) + ")" ).c_str (),
+                 time_it ( [&] { ba::inclusive_scan ( ba::execution::par ( t ), in.begin (), in.end (), out.begin ()); } ), inc );
+
+    std::cout << "exclusive_scan" << std::endl;
+    const double exc = time_it ( [&] { ba::exclusive_scan ( in.begin (), in.end (), out.begin (), 0u ); } );
+    report ( "sequential", exc, exc );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( ( "par (" + std::to_string ( t ) + ")" ).c_str (),
+                 time_it ( [&] { ba::exclusive_scan ( ba::execution::par ( t ), in.begin (), in.end (), out.begin (), 0u ); } ), exc );
+
+    std::cout << "transform_inclusive_scan" << std::endl;
+    const auto square = [] ( unsigned v ) { return v * v; };
+    const double tinc = time_it ( [&] { ba::transform_inclusive_scan ( in.begin (), in.end (), out.begin (), std::plus<unsigned> (), square ); } );
+    report ( "sequential", tinc, tinc );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( ( "par (" + std::to_string ( t ) + ")" ).c_str (),
+                 time_it ( [&] { ba::transform_inclusive_scan ( ba::execution::par ( t ), in.begin (), in.end (), out.begin (), std::plus<unsigned> (), square ); } ), tinc );
+
+    return 0;
+    }
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+//  sort_subrange for windows of various sizes and positions, compared with
+//  nth_element followed by partial_sort of the rest of the range (which is
+//  what sort_subrange used to do) and with sorting everything; and
+//  sort_subranges for several pages at once; then how the execution policy
+//  versions, and top_k_copy, scale with the number of threads.
+//
+//  Usage: sort_subrange_timer [size [max_threads]]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/sort_subrange.hpp>
+
+namespace ba = boost::algorithm;
+
+typedef std::vector<double>::iterator Iter;
+
+const int repeats = 3;
+
+//  The time taken by f on a fresh copy of 'data'
+template <typename Func>
+double time_it ( const std::vector<double> &data, Func f ) {
+    std::vector<double> v;
+    double total = 0;
+    for ( int i = 0; i < repeats; ++i ) {
+        v = data;
+        const auto start = std::chrono::steady_clock::now ();
+        f ( v );
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+        total += elapsed.count ();
+        }
+    return total / repeats;
+    }
+
+void report ( const std::string &name, double seconds, double baseline ) {
+    std::cout << "    " << std::setw ( 9 ) << std::fixed << std::setprecision ( 2 )
+              << seconds * 1e3 << " ms  " << std::setw ( 6 ) << baseline / seconds << "x  " << name << std::endl;
+    }
+
+void heap_subrange ( Iter first, Iter last, Iter sub_first, Iter sub_last ) {
+    if ( sub_first == sub_last ) return;
+    if ( sub_first != first ) {
+        std::nth_element ( first, sub_first, last );
+        ++sub_first;
+        }
+    std::partial_sort ( sub_first, sub_last, last );
+    }
+
+int main ( int argc, char *argv [] ) {
+    const std::size_t n = argc > 1 ? std::strtoul ( argv [ 1 ], NULL, 10 ) : 10000000;
+    const unsigned hw = std::thread::hardware_concurrency ();
+    const std::size_t max_threads = argc > 2 ? std::strtoul ( argv [ 2 ], NULL, 10 ) : ( hw == 0 ? 4 : hw );
+    std::vector<double> data ( n );
+    std::mt19937 gen ( 17 );
+    std::uniform_real_distribution<double> dist;
+    for ( std::size_t i = 0; i < n; ++i )
+        data [ i ] = dist ( gen );
+    std::cout << n << " doubles" << std::endl;
+
+    const double full = time_it ( data, [] ( std::vector<double> &v ) { std::sort ( v.begin (), v.end ()); } );
+    report ( "std::sort (everything)", full, full );
+
+    const std::size_t windows [] = { 10, 1000, 100000, n / 10 };
+    const std::size_t positions [] = { 0, n / 2, n - n / 10 };
+    for ( std::size_t w = 0; w < sizeof ( windows ) / sizeof ( windows [ 0 ] ); ++w )
+        for ( std::size_t p = 0; p < sizeof ( positions ) / sizeof ( positions [ 0 ] ); ++p ) {
+            const std::size_t sf = positions [ p ], sl = std::min ( n, sf + windows [ w ] );
+            std::cout << "window [" << sf << ", " << sl << ")" << std::endl;
+            const double heap = time_it ( data, [=] ( std::vector<double> &v ) {
+                heap_subrange ( v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } );
+            report ( "nth_element and partial_sort", heap, heap );
+            report ( "sort_subrange", time_it ( data, [=] ( std::vector<double> &v ) {
+                ba::sort_subrange ( v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } ), heap );
+            }
+
+//  Pages 1, 5 and 20 of 100 results each
+    std::cout << "three pages of 100" << std::endl;
+    const std::size_t pages [] = { 0, 100, 400, 500, 1900, 2000 };
+    const double separate = time_it ( data, [&] ( std::vector<double> &v ) {
+        for ( std::size_t i = 0; i < 6; i += 2 )
+            ba::sort_subrange ( v.begin (), v.end (), v.begin () + pages [ i ], v.begin () + pages [ i + 1 ] );
+        } );
+    report ( "sort_subrange, three times", separate, separate );
+    report ( "sort_subranges", time_it ( data, [&] ( std::vector<double> &v ) {
+        std::vector<Iter> cuts;
+        for ( std::size_t i = 0; i < 6; ++i )
+            cuts.push_back ( v.begin () + pages [ i ] );
+        ba::sort_subranges ( v.begin (), v.end (), cuts.begin (), cuts.end ());
+        } ), separate );
+
+//  Ten pages spread over the range
+    std::cout << "ten pages of 1000, spread out" << std::endl;
+    const double separate10 = time_it ( data, [&] ( std::vector<double> &v ) {
+        for ( std::size_t i = 0; i < 10; ++i )
+            ba::sort_subrange ( v.begin (), v.end (), v.begin () + i * ( n / 10 ), v.begin () + i * ( n / 10 ) + 1000 );
+        } );
+    report ( "sort_subrange, ten times", separate10, separate10 );
+    report ( "sort_subranges", time_it ( data, [&] ( std::vector<double> &v ) {
+        std::vector<Iter> cuts;
+        for ( std::size_t i = 0; i < 10; ++i ) {
+            cuts.push_back ( v.begin () + i * ( n / 10 ));
+            cuts.push_back ( v.begin () + i * ( n / 10 ) + 1000 );
+            }
+        ba::sort_subranges ( v.begin (), v.end (), cuts.begin (), cuts.end ());
+        } ), separate10 );
+
+//  The middle 1% of the range, sorted and partitioned
+    const std::size_t sf = n / 2, sl = n / 2 + n / 100;
+    std::cout << "window [" << sf << ", " << sl << "), up to " << max_threads << " threads" << std::endl;
+    const double seq_sort = time_it ( data, [=] ( std::vector<double> &v ) {
+        ba::sort_subrange ( v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } );
+    report ( "sort_subrange", seq_sort, seq_sort );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "sort_subrange, par (" + std::to_string ( t ) + ")", time_it ( data, [=] ( std::vector<double> &v ) {
+            ba::sort_subrange ( ba::execution::par ( t ), v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } ), seq_sort );
+    const double seq_part = time_it ( data, [=] ( std::vector<double> &v ) {
+        ba::partition_subrange ( v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } );
+    report ( "partition_subrange", seq_part, seq_part );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "partition_subrange, par (" + std::to_string ( t ) + ")", time_it ( data, [=] ( std::vector<double> &v ) {
+            ba::partition_subrange ( ba::execution::par ( t ), v.begin (), v.end (), v.begin () + sf, v.begin () + sl ); } ), seq_part );
+
+//  The 100 smallest, copied out of the (unchanged) input
+    std::cout << "top 100, up to " << max_threads << " threads" << std::endl;
+    std::vector<double> top ( 100 );
+    const double seq_top = time_it ( data, [&] ( std::vector<double> &v ) {
+        ba::top_k_copy ( v.begin (), v.end (), top.begin (), top.end ()); } );
+    report ( "top_k_copy", seq_top, seq_top );
+    for ( std::size_t t = 1; t <= max_threads; t *= 2 )
+        report ( "top_k_copy, par (" + std::to_string ( t ) + ")", time_it ( data, [&] ( std::vector<double> &v ) {
+            ba::top_k_copy ( ba::execution::par ( t ), v.begin (), v.end (), top.begin (), top.end ()); } ), seq_top );
+    return 0;
+    }
@@ -6,6 +6,7 @@
 
  Revision history:
     2 Dec 2014 mtc First version; power
+   19 Oct 2026 agent Added power<N>, power_mod and identity_element
    
 */
 
@@ -20,8 +21,12 @@
 #include <functional> // for plus and multiplies
 
 #include <boost/config.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/core/enable_if.hpp> // for boost::disable_if
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+#include <boost/algorithm/detail/power_mod.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -31,6 +36,32 @@ BOOST_CXX14_CONSTEXPR T identity_operation ( std::multiplies<T> ) { return T(1);
 template <typename T>
 BOOST_CXX14_CONSTEXPR T identity_operation ( std::plus<T> ) { return T(0); }
 
+/// \struct identity_element
+/// \brief The identity of the operation "Operation" on values of type "T";
+///     that is, the value e for which op ( e, x ) == x. power uses it for
+///     an exponent of 0 (and only then).
+///
+/// Specialize this for your own operations (for example, matrix products,
+/// or the "plus" of a semiring) to give a static member function
+/// "T value ( const Operation & )". By default, it calls identity_operation ( op ),
+/// which is found by argument dependent lookup, so overloading that for
+/// your operation also works.
+template <typename Operation, typename T>
+struct identity_element {
+    static BOOST_CXX14_CONSTEXPR T value ( const Operation &op ) { return identity_operation ( op ); }
+    };
+
+//  The operations that deduce their argument types (since C++14)
+template <typename T>
+struct identity_element<std::multiplies<void>, T> {
+    static BOOST_CXX14_CONSTEXPR T value ( const std::multiplies<void> & ) { return T(1); }
+    };
+
+template <typename T>
+struct identity_element<std::plus<void>, T> {
+    static BOOST_CXX14_CONSTEXPR T value ( const std::plus<void> & ) { return T(0); }
+    };
+
 
 /// \fn power ( T x, Integer n )
 /// \return the value "x" raised to the power "n"
@@ -45,14 +76,19 @@ BOOST_CXX14_CONSTEXPR typename boost::enable_if<boost::is_integral<Integer>, T>:
 power (T x, Integer n) {
     T y = 1; // Should be "T y{1};" 
     if (n == 0) return y;
+//  Start from the lowest power of x that is a factor, rather than from 1
+    while (n % 2 == 0) {
+        n = n / 2;
+        x = x * x;
+        }
+    y = x;
     while (true) {
-        if (n % 2 == 1) {
-            y = x * y;
-            if (n == 1)
-                return y;
-            }
         n = n / 2;
+        if (n == 0)
+            return y;
         x = x * x;
+        if (n % 2 == 1)
+            y = x * y;
         }
     return y;
     }
@@ -70,20 +106,103 @@ power (T x, Integer n) {
 template <typename T, typename Integer, typename Operation>
 BOOST_CXX14_CONSTEXPR typename boost::enable_if<boost::is_integral<Integer>, T>::type
 power (T x, Integer n, Operation op) {
-    T y = identity_operation(op);
-    if (n == 0) return y;
+    if (n == 0) return identity_element<Operation, T>::value(op);
+//  Start from the lowest power of x that is a factor, rather than from
+//  the identity, which saves an operation and is only needed for n == 0.
+    while (n % 2 == 0) {
+        n = n / 2;
+        x = op(x, x);
+        }
+    T y = x;
     while (true) {
-        if (n % 2 == 1) {
-            y = op(x, y);
-            if (n == 1)
-                return y;
-            }
         n = n / 2;
+        if (n == 0)
+            return y;
         x = op(x, x);
+        if (n % 2 == 1)
+            y = op(x, y);
         }
     return y;
     }
 
+/// \cond DOXYGEN_HIDE
+namespace detail {
+//  x to the power N, as a chain of operations unrolled at compile time:
+//  x^N is ( x^(N/2) )^2, times x if N is odd.
+    template <unsigned long N, bool Odd = N % 2 == 1>
+    struct power_chain {
+        template <typename T, typename Operation>
+        static BOOST_CXX14_CONSTEXPR T call (const T &x, Operation op) {
+            const T half = power_chain<N / 2>::call(x, op);
+            return op(half, half);
+            }
+        };
+
+    template <unsigned long N>
+    struct power_chain<N, true> {
+        template <typename T, typename Operation>
+        static BOOST_CXX14_CONSTEXPR T call (const T &x, Operation op) {
+            return op(x, power_chain<N - 1>::call(x, op));
+            }
+        };
+
+    template <>
+    struct power_chain<1, true> {
+        template <typename T, typename Operation>
+        static BOOST_CXX14_CONSTEXPR T call (const T &x, Operation) { return x; }
+        };
+
+    template <>
+    struct power_chain<0, false> {
+        template <typename T, typename Operation>
+        static BOOST_CXX14_CONSTEXPR T call (const T &, Operation op) { return identity_element<Operation, T>::value(op); }
+        };
+    }
+/// \endcond
+
+/// \fn power<N> ( T x )
+/// \return the value "x" raised to the power "N", where N is known at
+///     compile time; the multiplications are unrolled.
+/// 
+/// \param x     The value to be exponentiated
+///
+template <unsigned long N, typename T>
+BOOST_CXX14_CONSTEXPR T power (T x) {
+    return detail::power_chain<N>::call(x, std::multiplies<T>());
+    }
+
+/// \fn power<N> ( T x, Operation op )
+/// \return the value "x" raised to the power "N" using the operation "op",
+///     where N is known at compile time; the operations are unrolled.
+/// 
+/// \param x     The value to be exponentiated
+/// \param op    The operation used
+///
+template <unsigned long N, typename T, typename Operation>
+BOOST_CXX14_CONSTEXPR T power (T x, Operation op) {
+    return detail::power_chain<N>::call(x, op);
+    }
+
+/// \fn power_mod ( T x, Integer n, T m )
+/// \return the value "x" raised to the power "n", modulo "m"
+/// 
+/// \param x     The value to be exponentiated (must be >= 0)
+/// \param n     The exponent (must be >= 0)
+/// \param m     The modulus (must be > 0)
+///
+/// \note No intermediate value overflows, whatever the size of m. Moduli
+///     that need more than 32 bits use Montgomery multiplication (with
+///     128 bit products) when they are odd, so there are no divisions in
+///     the loop.
+///
+template <typename T, typename Integer>
+typename boost::enable_if_c<boost::is_integral<T>::value && boost::is_integral<Integer>::value
+                            && sizeof(T) <= sizeof(boost::uint64_t), T>::type
+power_mod (T x, Integer n, T m) {
+    typedef typename boost::make_unsigned<T>::type unsigned_type;
+    return static_cast<T>(detail::power_mod(static_cast<unsigned_type>(x), n, static_cast<unsigned_type>(m)));
+    }
+
 }}
 
 #endif // BOOST_ALGORITHM_HPP
@@ -19,75 +19,451 @@
 #define BOOST_ALGORITHM_APPLY_PERMUTATION_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+#include <tuple>
+#endif
 
 #include <boost/config.hpp>
+#include <boost/core/addressof.hpp>
+#include <boost/core/enable_if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_const.hpp>
+#include <boost/type_traits/is_reference.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/move.hpp>
+#include <boost/algorithm/detail/prefetch.hpp>
 
 namespace boost { namespace algorithm
 {
 
-/// \fn apply_permutation ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin )
+namespace detail
+{
+/// \cond DOXYGEN_HIDE
+
+//  Are the indices read-only? Then they can't be used for bookkeeping.
+template<typename RandomAccessIterator>
+struct permutation_const_indices : public boost::is_const<typename boost::remove_reference<
+    typename std::iterator_traits<RandomAccessIterator>::reference>::type> {};
+
+//  Each cycle is rotated with one move per element, rather than a swap.
+//  A position whose index refers to itself is in place; the indices are
+//  left as the identity permutation.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void apply_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                       std::size_t size, boost::false_type)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    typedef typename std::iterator_traits<RandomAccessIterator2>::value_type Index;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (static_cast<std::size_t>(ind_begin[i]) == i)
+            continue;
+        Value tmp(move_value(item_begin[i]));
+        std::size_t current = i;
+        for (std::size_t next = ind_begin[current]; next != i; next = ind_begin[current])
+        {
+            item_begin[current] = move_value(item_begin[next]);
+            ind_begin[current] = static_cast<Index>(current);
+            current = next;
+        }
+        item_begin[current] = move_value(tmp);
+        ind_begin[current] = static_cast<Index>(current);
+    }
+}
+
+//  The same, keeping track of the positions already in place in a bit vector
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void apply_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                       std::size_t size, boost::true_type)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    std::vector<bool> done(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (done[i] || static_cast<std::size_t>(ind_begin[i]) == i)
+            continue;
+        Value tmp(move_value(item_begin[i]));
+        std::size_t current = i;
+        for (std::size_t next = ind_begin[current]; next != i; next = ind_begin[current])
+        {
+            item_begin[current] = move_value(item_begin[next]);
+            done[next] = true;
+            current = next;
+        }
+        item_begin[current] = move_value(tmp);
+    }
+}
+
+//  Each item is carried forward round its cycle, to where it goes to
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void apply_reverse_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                               std::size_t size, boost::false_type)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    typedef typename std::iterator_traits<RandomAccessIterator2>::value_type Index;
+    using std::swap;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (static_cast<std::size_t>(ind_begin[i]) == i)
+            continue;
+        Value tmp(move_value(item_begin[i]));
+        for (std::size_t next = ind_begin[i]; next != i; )
+        {
+            swap(tmp, item_begin[next]);
+            const std::size_t current = next;
+            next = ind_begin[current];
+            ind_begin[current] = static_cast<Index>(current);
+        }
+        item_begin[i] = move_value(tmp);
+        ind_begin[i] = static_cast<Index>(i);
+    }
+}
+
+//  The same, keeping track of the positions already in place in a bit vector
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void apply_reverse_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                               std::size_t size, boost::true_type)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    using std::swap;
+    std::vector<bool> done(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (done[i] || static_cast<std::size_t>(ind_begin[i]) == i)
+            continue;
+        Value tmp(move_value(item_begin[i]));
+        for (std::size_t next = ind_begin[i]; next != i; next = ind_begin[next])
+        {
+            swap(tmp, item_begin[next]);
+            done[next] = true;
+        }
+        item_begin[i] = move_value(tmp);
+    }
+}
+
+//  How far ahead of the copy to prefetch
+const std::size_t permutation_prefetch_distance = 16;
+
+template<typename RandomAccessIterator>
+void prefetch_item(RandomAccessIterator it, boost::true_type)
+{
+    BOOST_ALGORITHM_PREFETCH(boost::addressof(*it));
+}
+
+template<typename RandomAccessIterator>
+void prefetch_item(RandomAccessIterator, boost::false_type) {}
+
+template<typename RandomAccessIterator>
+struct permutation_can_prefetch : public boost::is_reference<
+    typename std::iterator_traits<RandomAccessIterator>::reference> {};
+
+//  Can different threads write neighbouring items? Not when the items are
+//  bits packed into shared words (std::vector<bool>), which are written
+//  through proxies.
+template<typename RandomAccessIterator>
+struct permutation_items_apart : public boost::is_reference<
+    typename std::iterator_traits<RandomAccessIterator>::reference> {};
+
+//  Minimum number of items for a thread
+const std::size_t permutation_grain = 1 << 15;
+
+//  Move the items back from the buffer, in chunk 'i'
+template<bool Reverse, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Value>
+struct permutation_from_buffer
+{
+    permutation_from_buffer(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                            Value* buffer, std::size_t size, std::size_t chunks)
+        : item_begin_(item_begin), ind_begin_(ind_begin), buffer_(buffer), size_(size), chunks_(chunks) {}
+
+    void operator()(std::size_t i) const
+    {
+        const std::size_t first = chunk_offset(i, chunks_, size_);
+        const std::size_t last = chunk_offset(i + 1, chunks_, size_);
+        const std::size_t ahead = permutation_prefetch_distance;
+        for (std::size_t k = first; k < last; ++k)
+        {
+            if (k + ahead < last)
+                prefetch(k + ahead, boost::integral_constant<bool, Reverse>());
+            if (Reverse)
+                item_begin_[ind_begin_[k]] = move_value(buffer_[k]);
+            else
+                item_begin_[k] = move_value(buffer_[ind_begin_[k]]);
+        }
+    }
+
+private:
+    void prefetch(std::size_t k, boost::false_type) const
+    {
+        BOOST_ALGORITHM_PREFETCH(buffer_ + ind_begin_[k]);
+    }
+
+    void prefetch(std::size_t k, boost::true_type) const
+    {
+        prefetch_item(item_begin_ + ind_begin_[k], permutation_can_prefetch<RandomAccessIterator1>());
+    }
+
+    RandomAccessIterator1 item_begin_;
+    RandomAccessIterator2 ind_begin_;
+    Value* buffer_;
+    std::size_t size_, chunks_;
+};
+
+//  The versions that leave the indices unchanged, picked at compile time
+//  (std::vector<bool> items can't be swapped with a bool before C++11)
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void sequential_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                            std::size_t size, boost::false_type /* reverse */)
+{
+    apply_permutation(item_begin, ind_begin, size, boost::true_type());
+}
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void sequential_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                            std::size_t size, boost::true_type /* reverse */)
+{
+    apply_reverse_permutation(item_begin, ind_begin, size, boost::true_type());
+}
+
+//  Packed bits are done on one thread
+template<bool Reverse, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void parallel_permutation(const execution::parallel_policy&,
+                          RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                          std::size_t size, boost::false_type)
+{
+    sequential_permutation(item_begin, ind_begin, size, boost::integral_constant<bool, Reverse>());
+}
+
+//  The items are moved to a buffer in order, and then moved back
+//  concurrently: each thread writes a different part of the sequence
+//  (or, for the reverse permutation, reads a different part of the buffer).
+template<bool Reverse, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void parallel_permutation(const execution::parallel_policy& policy,
+                          RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                          std::size_t size, boost::true_type)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    const std::size_t chunks = parallel_chunk_count(policy, size, permutation_grain);
+//  Going through the buffer is faster even on one thread, once the
+//  sequence is big enough to be worth a thread.
+    if (size < permutation_grain)
+    {
+        sequential_permutation(item_begin, ind_begin, size, boost::integral_constant<bool, Reverse>());
+        return;
+    }
+
+    std::vector<Value> buffer;
+    buffer.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        buffer.push_back(move_value(item_begin[i]));
+    parallel_run(chunks, permutation_from_buffer<Reverse, RandomAccessIterator1, RandomAccessIterator2, Value>
+                             (item_begin, ind_begin, &buffer[0], size, chunks));
+}
+
+template<bool Reverse, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void policy_permutation(const execution::sequenced_policy&,
+                        RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                        std::size_t size)
+{
+    sequential_permutation(item_begin, ind_begin, size, boost::integral_constant<bool, Reverse>());
+}
+
+template<bool Reverse, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void policy_permutation(const execution::parallel_policy& policy,
+                        RandomAccessIterator1 item_begin, RandomAccessIterator2 ind_begin,
+                        std::size_t size)
+{
+    parallel_permutation<Reverse>(policy, item_begin, ind_begin, size,
+                                  typename permutation_items_apart<RandomAccessIterator1>::type());
+}
+
+/// \endcond
+}
+
+/// \fn apply_permutation ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
 /// \brief Reorder item sequence with index sequence order
 ///
 /// \param item_begin    The start of the item sequence
 /// \param item_end		 One past the end of the item sequence
 /// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
 ///
 /// \note Item sequence size should be equal to index size. Otherwise behavior is undefined.
-///       Complexity: O(N).
+///       Complexity: O(N). Each item is moved once (plus once per cycle).
+///       The index sequence is left as the identity permutation, unless it is
+///       read-only (const), in which case it is unchanged and a bit vector
+///       of N bits is used instead.
 template<typename RandomAccessIterator1, typename RandomAccessIterator2>
 void
 apply_permutation(RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
-                  RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end)
+                  RandomAccessIterator2 ind_begin, RandomAccessIterator2 /* ind_end */)
 {
-    typedef typename std::iterator_traits<RandomAccessIterator1>::difference_type Diff;
-    typedef typename std::iterator_traits<RandomAccessIterator2>::difference_type Index;
-    using std::swap;
-    Diff size = std::distance(item_begin, item_end);
-    for (Diff i = 0; i < size; i++)
-    {
-        Diff current = i;
-        while (i != ind_begin[current])
-        {
-            Index next = ind_begin[current];
-            swap(item_begin[current], item_begin[next]);
-            ind_begin[current] = current;
-            current = next;
-        }
-        ind_begin[current] = current;
-    }
+    detail::apply_permutation(item_begin, ind_begin,
+                              static_cast<std::size_t>(std::distance(item_begin, item_end)),
+                              detail::permutation_const_indices<RandomAccessIterator2>());
 }
 
-/// \fn apply_reverse_permutation ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin )
+/// \fn apply_reverse_permutation ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
 /// \brief Reorder item sequence with index sequence order
 ///
 /// \param item_begin    The start of the item sequence
 /// \param item_end		 One past the end of the item sequence
 /// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
 ///
 /// \note Item sequence size should be equal to index size. Otherwise behavior is undefined.
-///       Complexity: O(N).
+///       Complexity: O(N). Each item is swapped into place once.
+///       The index sequence is left as the identity permutation, unless it is
+///       read-only (const), in which case it is unchanged and a bit vector
+///       of N bits is used instead.
 template<typename RandomAccessIterator1, typename RandomAccessIterator2>
 void
 apply_reverse_permutation(
         RandomAccessIterator1 item_begin,
         RandomAccessIterator1 item_end,
         RandomAccessIterator2 ind_begin,
-        RandomAccessIterator2 ind_end)
+        RandomAccessIterator2 /* ind_end */)
 {
-    typedef typename std::iterator_traits<RandomAccessIterator2>::difference_type Diff;
-    using std::swap;
-    Diff length = std::distance(item_begin, item_end);
-    for (Diff i = 0; i < length; i++)
+    detail::apply_reverse_permutation(item_begin, ind_begin,
+                                      static_cast<std::size_t>(std::distance(item_begin, item_end)),
+                                      detail::permutation_const_indices<RandomAccessIterator2>());
+}
+
+/// \fn apply_permutation_copy ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, OutputIterator result )
+/// \brief Copy the items to 'result' in index sequence order:
+///        the i'th output is item_begin[ind_begin[i]].
+///
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param result        Where to write the items
+/// \return The end of the output
+///
+/// \note Neither the items nor the indices are changed. The items are
+///       prefetched ahead of the copy, which hides most of the cost of
+///       reading them in random order.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator
+apply_permutation_copy(RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                       RandomAccessIterator2 ind_begin, OutputIterator result)
+{
+    const std::size_t size = static_cast<std::size_t>(std::distance(item_begin, item_end));
+    const std::size_t ahead = detail::permutation_prefetch_distance;
+    std::size_t i = 0;
+    for (; i + ahead < size; ++i, (void) ++result)
     {
-        while (i != ind_begin[i])
-        {
-            Diff next = ind_begin[i];
-            swap(item_begin[i], item_begin[next]);
-            swap(ind_begin[i], ind_begin[next]);
-        }
+        detail::prefetch_item(item_begin + ind_begin[i + ahead],
+                              detail::permutation_can_prefetch<RandomAccessIterator1>());
+        *result = item_begin[ind_begin[i]];
+    }
+    for (; i < size; ++i, (void) ++result)
+        *result = item_begin[ind_begin[i]];
+    return result;
+}
+
+/// \fn apply_reverse_permutation_copy ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator3 result )
+/// \brief Copy the items to 'result' in reverse index sequence order:
+///        item_begin[i] is written to result[ind_begin[i]].
+///
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param result        The start of the output sequence
+///
+/// \note Neither the items nor the indices are changed. The output is
+///       prefetched ahead of the copy.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3>
+void
+apply_reverse_permutation_copy(RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                               RandomAccessIterator2 ind_begin, RandomAccessIterator3 result)
+{
+    const std::size_t size = static_cast<std::size_t>(std::distance(item_begin, item_end));
+    const std::size_t ahead = detail::permutation_prefetch_distance;
+    std::size_t i = 0;
+    for (; i + ahead < size; ++i)
+    {
+        detail::prefetch_item(result + ind_begin[i + ahead],
+                              detail::permutation_can_prefetch<RandomAccessIterator3>());
+        result[ind_begin[i]] = item_begin[i];
+    }
+    for (; i < size; ++i)
+        result[ind_begin[i]] = item_begin[i];
+}
+
+/// \fn apply_permutation_buffered ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
+/// \brief Reorder item sequence with index sequence order, through a buffer
+///
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
+///
+/// \note The same result as apply_permutation, but the items are moved to
+///       a temporary buffer of N items (with prefetching) and back, rather
+///       than round the cycles. For large sequences this is usually much
+///       faster. The indices are not changed.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void
+apply_permutation_buffered(RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                           RandomAccessIterator2 ind_begin, RandomAccessIterator2 /* ind_end */)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    const std::size_t size = static_cast<std::size_t>(std::distance(item_begin, item_end));
+    const std::size_t ahead = detail::permutation_prefetch_distance;
+    std::vector<Value> buffer;
+    buffer.reserve(size);
+    std::size_t i = 0;
+    for (; i + ahead < size; ++i)
+    {
+        detail::prefetch_item(item_begin + ind_begin[i + ahead],
+                              detail::permutation_can_prefetch<RandomAccessIterator1>());
+        buffer.push_back(detail::move_value(item_begin[ind_begin[i]]));
+    }
+    for (; i < size; ++i)
+        buffer.push_back(detail::move_value(item_begin[ind_begin[i]]));
+    for (i = 0; i < size; ++i)
+        item_begin[i] = detail::move_value(buffer[i]);
+}
+
+/// \fn apply_reverse_permutation_buffered ( RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
+/// \brief Reorder item sequence with reverse index sequence order, through a buffer
+///
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
+///
+/// \note The same result as apply_reverse_permutation, using a temporary
+///       buffer of N items. The indices are not changed.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+void
+apply_reverse_permutation_buffered(RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                                   RandomAccessIterator2 ind_begin, RandomAccessIterator2 /* ind_end */)
+{
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type Value;
+    const std::size_t size = static_cast<std::size_t>(std::distance(item_begin, item_end));
+    const std::size_t ahead = detail::permutation_prefetch_distance;
+    std::vector<Value> buffer;
+    buffer.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        buffer.push_back(detail::move_value(item_begin[i]));
+    std::size_t i = 0;
+    for (; i + ahead < size; ++i)
+    {
+        detail::prefetch_item(item_begin + ind_begin[i + ahead],
+                              detail::permutation_can_prefetch<RandomAccessIterator1>());
+        item_begin[ind_begin[i]] = detail::move_value(buffer[i]);
     }
+    for (; i < size; ++i)
+        item_begin[ind_begin[i]] = detail::move_value(buffer[i]);
 }
 
 /// \fn apply_permutation ( Range1 item_range, Range2 ind_range )
@@ -122,5 +498,361 @@ apply_reverse_permutation(Range1& item_range, Range2& ind_range)
                               boost::begin(ind_range), boost::end(ind_range));
 }
 
+/// \fn apply_permutation ( Range1 item_range, const Range2 ind_range )
+/// \brief Reorder item sequence with index sequence order, leaving the indices unchanged
+///
+/// \param item_range    The item sequence
+/// \param ind_range     The index sequence
+///
+/// \note Item sequence size should be equal to index size. Otherwise behavior is undefined.
+///       Complexity: O(N). Uses a bit vector of N bits.
+template<typename Range1, typename Range2>
+void
+apply_permutation(Range1& item_range, const Range2& ind_range)
+{
+    apply_permutation(boost::begin(item_range), boost::end(item_range),
+                      boost::begin(ind_range), boost::end(ind_range));
+}
+
+/// \fn apply_reverse_permutation ( Range1 item_range, const Range2 ind_range )
+/// \brief Reorder item sequence with reverse index sequence order, leaving the indices unchanged
+///
+/// \param item_range    The item sequence
+/// \param ind_range     The index sequence
+///
+/// \note Item sequence size should be equal to index size. Otherwise behavior is undefined.
+///       Complexity: O(N). Uses a bit vector of N bits.
+template<typename Range1, typename Range2>
+void
+apply_reverse_permutation(Range1& item_range, const Range2& ind_range)
+{
+    apply_reverse_permutation(boost::begin(item_range), boost::end(item_range),
+                              boost::begin(ind_range), boost::end(ind_range));
+}
+
+/// \fn apply_permutation ( const ExecutionPolicy &policy, RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
+/// \brief Reorder item sequence with index sequence order, using an execution policy
+///
+/// \param policy        The execution policy (execution::seq or execution::par)
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
+///
+/// \note The index sequence is not changed. The parallel version moves
+///       the items to a temporary buffer of N items, and back concurrently.
+template<typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+apply_permutation(const ExecutionPolicy& policy,
+                  RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                  RandomAccessIterator2 ind_begin, RandomAccessIterator2 /* ind_end */)
+{
+    detail::policy_permutation<false>(policy, item_begin, ind_begin,
+                                      static_cast<std::size_t>(std::distance(item_begin, item_end)));
+}
+
+/// \fn apply_reverse_permutation ( const ExecutionPolicy &policy, RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end, RandomAccessIterator2 ind_begin, RandomAccessIterator2 ind_end )
+/// \brief Reorder item sequence with reverse index sequence order, using an execution policy
+///
+/// \param policy        The execution policy (execution::seq or execution::par)
+/// \param item_begin    The start of the item sequence
+/// \param item_end		 One past the end of the item sequence
+/// \param ind_begin     The start of the index sequence.
+/// \param ind_end       One past the end of the index sequence.
+///
+/// \note The index sequence is not changed. The parallel version moves
+///       the items to a temporary buffer of N items, and back concurrently.
+template<typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+apply_reverse_permutation(const ExecutionPolicy& policy,
+                          RandomAccessIterator1 item_begin, RandomAccessIterator1 item_end,
+                          RandomAccessIterator2 ind_begin, RandomAccessIterator2 /* ind_end */)
+{
+    detail::policy_permutation<true>(policy, item_begin, ind_begin,
+                                     static_cast<std::size_t>(std::distance(item_begin, item_end)));
+}
+
+/// \fn apply_permutation ( const ExecutionPolicy &policy, Range1 item_range, const Range2 ind_range )
+/// \brief Reorder item sequence with index sequence order, using an execution policy
+///
+/// \param policy        The execution policy (execution::seq or execution::par)
+/// \param item_range    The item sequence
+/// \param ind_range     The index sequence
+template<typename ExecutionPolicy, typename Range1, typename Range2>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+apply_permutation(const ExecutionPolicy& policy, Range1& item_range, const Range2& ind_range)
+{
+    apply_permutation(policy, boost::begin(item_range), boost::end(item_range),
+                      boost::begin(ind_range), boost::end(ind_range));
+}
+
+/// \fn apply_reverse_permutation ( const ExecutionPolicy &policy, Range1 item_range, const Range2 ind_range )
+/// \brief Reorder item sequence with reverse index sequence order, using an execution policy
+///
+/// \param policy        The execution policy (execution::seq or execution::par)
+/// \param item_range    The item sequence
+/// \param ind_range     The index sequence
+template<typename ExecutionPolicy, typename Range1, typename Range2>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+apply_reverse_permutation(const ExecutionPolicy& policy, Range1& item_range, const Range2& ind_range)
+{
+    apply_reverse_permutation(policy, boost::begin(item_range), boost::end(item_range),
+                              boost::begin(ind_range), boost::end(ind_range));
+}
+
+/// \class permutation_cycles
+/// \brief The cycles of a permutation, worked out once and then applied to
+///        any number of item sequences (such as the columns of a table)
+///        without further bookkeeping.
+///
+///        The cycles are independent, so the parallel versions of apply and
+///        apply_reverse split them between the threads; when there are
+///        several sequences, the threads also work on different sequences.
+///        Each item is moved (or swapped) in place; no buffer is needed.
+class permutation_cycles
+{
+public:
+    /// \brief Decompose the permutation [ind_begin, ind_end) into cycles.
+    ///        The index sequence is copied, and not changed.
+    template<typename RandomAccessIterator>
+    permutation_cycles(RandomAccessIterator ind_begin, RandomAccessIterator ind_end)
+        : ind_(ind_begin, ind_end) { decompose(); }
+
+    /// \brief Decompose the permutation ind_range into cycles.
+    template<typename Range>
+    explicit permutation_cycles(const Range& ind_range)
+        : ind_(boost::begin(ind_range), boost::end(ind_range)) { decompose(); }
+
+    /// \brief The number of items in a sequence that the permutation applies to
+    std::size_t size() const { return ind_.size(); }
+
+    /// \brief The number of cycles, not counting items that stay in place
+    std::size_t cycles() const { return leaders_.size(); }
+
+    /// \brief Reorder the sequence starting at item_begin as apply_permutation does
+    template<typename RandomAccessIterator>
+    void apply(RandomAccessIterator item_begin) const
+    {
+        apply_cycles<false>(item_begin, 0, cycles());
+    }
+
+    /// \brief Reorder the sequence starting at item_begin as apply_reverse_permutation does
+    template<typename RandomAccessIterator>
+    void apply_reverse(RandomAccessIterator item_begin) const
+    {
+        apply_cycles<true>(item_begin, 0, cycles());
+    }
+
+    /// \brief Reorder the sequence starting at item_begin as apply_permutation does,
+    ///        using an execution policy
+    template<typename ExecutionPolicy, typename RandomAccessIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+    apply(const ExecutionPolicy& policy, RandomAccessIterator item_begin) const
+    {
+        run(policy, columns_task<false, RandomAccessIterator>(*this, item_begin), 1);
+    }
+
+    /// \brief Reorder the sequence starting at item_begin as apply_reverse_permutation does,
+    ///        using an execution policy
+    template<typename ExecutionPolicy, typename RandomAccessIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+    apply_reverse(const ExecutionPolicy& policy, RandomAccessIterator item_begin) const
+    {
+        run(policy, columns_task<true, RandomAccessIterator>(*this, item_begin), 1);
+    }
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+    /// \brief Reorder each of the sequences starting at item_begins... as
+    ///        apply_permutation does, using an execution policy
+    template<typename ExecutionPolicy, typename... RandomAccessIterators>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+    apply_columns(const ExecutionPolicy& policy, RandomAccessIterators... item_begins) const
+    {
+        run(policy, columns_task<false, RandomAccessIterators...>(*this, item_begins...),
+            sizeof...(RandomAccessIterators));
+    }
+
+    /// \brief Reorder each of the sequences starting at item_begins... as
+    ///        apply_reverse_permutation does, using an execution policy
+    template<typename ExecutionPolicy, typename... RandomAccessIterators>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+    apply_reverse_columns(const ExecutionPolicy& policy, RandomAccessIterators... item_begins) const
+    {
+        run(policy, columns_task<true, RandomAccessIterators...>(*this, item_begins...),
+            sizeof...(RandomAccessIterators));
+    }
+#endif
+
+private:
+    void decompose()
+    {
+        const std::size_t n = ind_.size();
+        std::vector<bool> done(n);
+        offsets_.push_back(0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (done[i] || ind_[i] == i)
+                continue;
+            std::size_t length = 1;
+            for (std::size_t next = ind_[i]; next != i; next = ind_[next])
+            {
+                done[next] = true;
+                ++length;
+            }
+            leaders_.push_back(i);
+            offsets_.push_back(offsets_.back() + length);
+        }
+    }
+
+    //  Apply the cycles [first, last)
+    template<bool Reverse, typename RandomAccessIterator>
+    void apply_cycles(RandomAccessIterator item_begin, std::size_t first, std::size_t last) const
+    {
+        for (std::size_t c = first; c < last; ++c)
+            apply_cycle(item_begin, leaders_[c], boost::integral_constant<bool, Reverse>());
+    }
+
+    template<typename RandomAccessIterator>
+    void apply_cycle(RandomAccessIterator item_begin, std::size_t leader, boost::false_type /* reverse */) const
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+        Value tmp(detail::move_value(item_begin[leader]));
+        std::size_t current = leader;
+        for (std::size_t next = ind_[current]; next != leader; next = ind_[current])
+        {
+            item_begin[current] = detail::move_value(item_begin[next]);
+            current = next;
+        }
+        item_begin[current] = detail::move_value(tmp);
+    }
+
+    template<typename RandomAccessIterator>
+    void apply_cycle(RandomAccessIterator item_begin, std::size_t leader, boost::true_type /* reverse */) const
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+        using std::swap;
+        Value tmp(detail::move_value(item_begin[leader]));
+        for (std::size_t next = ind_[leader]; next != leader; next = ind_[next])
+            swap(tmp, item_begin[next]);
+        item_begin[leader] = detail::move_value(tmp);
+    }
+
+    //  The first cycle of group 'g' of 'groups', each with about the same number of items
+    std::size_t group_start(std::size_t g, std::size_t groups) const
+    {
+        if (g == groups)
+            return cycles();
+        const std::size_t items = detail::chunk_offset(g, groups, offsets_.back());
+        return static_cast<std::size_t>(std::lower_bound(offsets_.begin(), offsets_.end() - 1, items) - offsets_.begin());
+    }
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+    //  Whether all the columns can have their items written by several threads
+    template<typename... RandomAccessIterators>
+    struct all_apart : public boost::true_type {};
+
+    template<typename RandomAccessIterator, typename... RandomAccessIterators>
+    struct all_apart<RandomAccessIterator, RandomAccessIterators...> : public boost::integral_constant<bool,
+        detail::permutation_items_apart<RandomAccessIterator>::value && all_apart<RandomAccessIterators...>::value> {};
+
+    //  Applies group 'g' of the cycles to column 'c'
+    template<bool Reverse, typename... RandomAccessIterators>
+    struct columns_task
+    {
+        //  Can the cycles of a column be split between threads?
+        static const bool splittable = all_apart<RandomAccessIterators...>::value;
+
+        columns_task(const permutation_cycles& cycles, RandomAccessIterators... item_begins)
+            : cycles_(cycles), item_begins_(item_begins...) {}
+
+        void operator()(std::size_t c, std::size_t g, std::size_t groups) const
+        {
+            dispatch<0>(c, cycles_.group_start(g, groups), cycles_.group_start(g + 1, groups));
+        }
+
+    private:
+        template<std::size_t K>
+        typename boost::enable_if_c<K == sizeof...(RandomAccessIterators)>::type
+        dispatch(std::size_t, std::size_t, std::size_t) const {}
+
+        template<std::size_t K>
+        typename boost::enable_if_c<(K < sizeof...(RandomAccessIterators))>::type
+        dispatch(std::size_t c, std::size_t first, std::size_t last) const
+        {
+            if (c == K)
+                cycles_.apply_cycles<Reverse>(std::get<K>(item_begins_), first, last);
+            else
+                dispatch<K + 1>(c, first, last);
+        }
+
+        const permutation_cycles& cycles_;
+        std::tuple<RandomAccessIterators...> item_begins_;
+    };
+#else
+    template<bool Reverse, typename RandomAccessIterator>
+    struct columns_task
+    {
+        //  Can the cycles of the column be split between threads?
+        static const bool splittable = detail::permutation_items_apart<RandomAccessIterator>::value;
+
+        columns_task(const permutation_cycles& cycles, RandomAccessIterator item_begin)
+            : cycles_(cycles), item_begin_(item_begin) {}
+
+        void operator()(std::size_t, std::size_t g, std::size_t groups) const
+        {
+            cycles_.apply_cycles<Reverse>(item_begin_, cycles_.group_start(g, groups),
+                                          cycles_.group_start(g + 1, groups));
+        }
+
+    private:
+        const permutation_cycles& cycles_;
+        RandomAccessIterator item_begin_;
+    };
+#endif
+
+    //  Worker 'w' of 'workers' does every workers'th of the (column, group) tasks
+    template<typename Task>
+    struct worker
+    {
+        worker(const Task& task, std::size_t columns, std::size_t groups, std::size_t workers)
+            : task_(task), columns_(columns), groups_(groups), workers_(workers) {}
+
+        void operator()(std::size_t w) const
+        {
+            for (std::size_t t = w; t < columns_ * groups_; t += workers_)
+                task_(t / groups_, t % groups_, groups_);
+        }
+
+    private:
+        Task task_;
+        std::size_t columns_, groups_, workers_;
+    };
+
+    template<typename Task>
+    void run(const execution::sequenced_policy&, const Task& task, std::size_t columns) const
+    {
+        for (std::size_t c = 0; c < columns; ++c)
+            task(c, 0, 1);
+    }
+
+    template<typename Task>
+    void run(const execution::parallel_policy& policy, const Task& task, std::size_t columns) const
+    {
+        const std::size_t chunks = detail::parallel_chunk_count(policy, offsets_.back() * columns, detail::permutation_grain);
+    //  Split the cycles only when there aren't enough columns to go round,
+    //  and never for packed bits, where neighbouring items share a word
+        std::size_t groups = chunks > columns && Task::splittable ? chunks / columns : 1;
+        if (groups > cycles())
+            groups = cycles() == 0 ? 1 : cycles();
+        const std::size_t tasks = columns * groups;
+        const std::size_t workers = chunks < tasks ? chunks : tasks;
+        detail::parallel_run(workers, worker<Task>(task, columns, groups, workers));
+    }
+
+    std::vector<std::size_t> ind_;
+    std::vector<std::size_t> leaders_;
+    std::vector<std::size_t> offsets_;  // offsets_[c] items are in the cycles before c
+};
+
 }}
 #endif //BOOST_ALGORITHM_APPLY_PERMUTATION_HPP
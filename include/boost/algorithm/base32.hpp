@@ -0,0 +1,293 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    General problem - turn a sequence of 8-bit values into a sequence of base32 characters.
+    - and back.
+*/
+
+/// \file  base32.hpp
+/// \brief Convert a sequence of 8-bit values into a sequence of base32
+///     characters and back, as described in RFC 4648.
+/// \author agent
+
+#ifndef BOOST_ALGORITHM_BASE32_HPP
+#define BOOST_ALGORITHM_BASE32_HPP
+
+#include <cstddef>      // for std::size_t
+
+#include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/algorithm/detail/radix_codec.hpp>
+
+
+namespace boost { namespace algorithm {
+
+/*!
+    \enum  base32_flags
+    \brief Select the alphabet and the padding used by the base32 functions.
+                Combine them with '|'.
+*/
+enum base32_flags {
+    base32_standard   = 0,  ///< The standard alphabet ('A'-'Z', '2'-'7'), with padding
+    base32_hex        = 1,  ///< The "extended hex" alphabet ('0'-'9', 'A'-'V')
+    base32_no_padding = 2   ///< Do not write (or accept) trailing '=' characters
+    };
+
+inline base32_flags operator| ( base32_flags lhs, base32_flags rhs ) {
+    return static_cast<base32_flags> ( static_cast<int> ( lhs ) | static_cast<int> ( rhs ));
+    }
+
+/*!
+    \struct non_base32_input
+    \brief  Thrown when a character that is not in the alphabet is encountered
+                when decoding (contains the offending character), or when a
+                value that does not fit in 8 bits is encoded.
+                Running out of input throws not_enough_input, as for hex.
+*/
+struct BOOST_SYMBOL_VISIBLE non_base32_input : virtual hex_decode_error {};
+
+namespace detail {
+/// \cond DOXYGEN_HIDE
+
+    struct base32_codec {
+        BOOST_STATIC_CONSTANT ( std::size_t, bits = 5 );
+        BOOST_STATIC_CONSTANT ( std::size_t, group_bytes = 5 );
+        BOOST_STATIC_CONSTANT ( std::size_t, group_chars = 8 );
+        typedef non_base32_input bad_input;
+
+        static const char *alphabet ( int flags );
+        static const signed char *values ( int flags );
+        };
+
+    template <typename Dummy>
+    struct base32_tables {
+        static const char         alphabets [ 2 ][ 33 ];
+        static const signed char  values [ 2 ][ 256 ];
+        };
+
+    template <typename Dummy>
+    const char base32_tables<Dummy>::alphabets [ 2 ][ 33 ] = {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567",
+        "0123456789ABCDEFGHIJKLMNOPQRSTUV"
+        };
+
+    template <typename Dummy>
+    const signed char base32_tables<Dummy>::values [ 2 ][ 256 ] = {
+      {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+      },
+      {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+        -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+      }
+        };
+
+    inline const char *base32_codec::alphabet ( int flags ) {
+        return base32_tables<void>::alphabets [ ( flags & radix_alternate ) ? 1 : 0 ];
+        }
+
+    inline const signed char *base32_codec::values ( int flags ) {
+        return base32_tables<void>::values [ ( flags & radix_alternate ) ? 1 : 0 ];
+        }
+/// \endcond
+    }
+
+
+/// \fn base32_encode ( InputIterator first, InputIterator last, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base32 characters.
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename InputIterator, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<typename detail::hex_iterator_traits<InputIterator>::value_type>, OutputIterator>::type
+base32_encode ( InputIterator first, InputIterator last, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_encode<detail::base32_codec> ( first, last, out, flags, detail::iter_end<InputIterator> );
+    }
+
+
+/// \fn base32_encode ( const T *ptr, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base32 characters.
+///
+/// \param ptr      A pointer to a 0-terminated sequence of data.
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename T, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<T>, OutputIterator>::type
+base32_encode ( const T *ptr, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_encode<detail::base32_codec> ( ptr, (const T *) NULL, out, flags, detail::ptr_end<T> );
+    }
+
+
+/// \fn base32_encode ( const Range &r, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base32 characters.
+///
+/// \param r        The input range
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename Range, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<typename detail::hex_iterator_traits<typename Range::iterator>::value_type>, OutputIterator>::type
+base32_encode ( const Range &r, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_encode_range<detail::base32_codec> ( r, out, flags );
+    }
+
+
+/// \fn base32_decode ( InputIterator first, InputIterator last, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of base32 characters into a sequence of 8-bit values.
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename InputIterator, typename OutputIterator>
+OutputIterator base32_decode ( InputIterator first, InputIterator last, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_decode<detail::base32_codec> ( first, last, out, flags, detail::iter_end<InputIterator> );
+    }
+
+
+/// \fn base32_decode ( const T *ptr, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of base32 characters into a sequence of 8-bit values.
+///
+/// \param ptr      A pointer to a null-terminated input sequence.
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename T, typename OutputIterator>
+OutputIterator base32_decode ( const T *ptr, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_decode<detail::base32_codec> ( ptr, (const T *) NULL, out, flags, detail::ptr_end<T> );
+    }
+
+
+/// \fn base32_decode ( const Range &r, OutputIterator out, base32_flags flags )
+/// \brief   Converts a sequence of base32 characters into a sequence of 8-bit values.
+///
+/// \param r        The input range
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename Range, typename OutputIterator>
+OutputIterator base32_decode ( const Range &r, OutputIterator out, base32_flags flags = base32_standard ) {
+    return detail::radix_decode_range<detail::base32_codec> ( r, out, flags );
+    }
+
+
+/// \fn String base32_encode ( const String &input, base32_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base32 characters.
+///
+/// \param input    A container to be converted
+/// \param flags    The alphabet and padding to use
+/// \return         A container with the encoded text
+template<typename String>
+String base32_encode ( const String &input, base32_flags flags = base32_standard ) {
+    return detail::radix_encode_string<detail::base32_codec> ( input, flags );
+    }
+
+
+/// \fn String base32_decode ( const String &input, base32_flags flags )
+/// \brief   Converts a sequence of base32 characters into a sequence of 8-bit values.
+///
+/// \param input    A container to be converted
+/// \param flags    The alphabet and padding to expect
+/// \return         A container with the decoded data
+template<typename String>
+String base32_decode ( const String &input, base32_flags flags = base32_standard ) {
+    return detail::radix_decode_string<detail::base32_codec> ( input, flags );
+    }
+
+
+/// \fn base32_encoded_size ( std::size_t n, base32_flags flags )
+/// \brief   The number of characters that base32_encode produces for n values.
+///
+/// \param n        The number of values to be encoded
+/// \param flags    The alphabet and padding to use
+BOOST_CONSTEXPR inline std::size_t base32_encoded_size ( std::size_t n, base32_flags flags = base32_standard ) {
+    return detail::radix_encoded_size<detail::base32_codec> ( n, flags );
+    }
+
+
+/// \fn base32_decoded_size ( std::size_t n )
+/// \brief   The largest number of values that base32_decode can produce from
+///             n characters. Padding characters make the actual number smaller.
+///
+/// \param n        The number of characters to be decoded
+BOOST_CONSTEXPR inline std::size_t base32_decoded_size ( std::size_t n ) {
+    return detail::radix_decoded_size<detail::base32_codec> ( n );
+    }
+
+
+/// \fn base32_encode_to_buffer ( const T *first, std::size_t n, CharT *out, base32_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base32 characters.
+///             Whole groups of five values are converted without checking for the end of the input.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of values in the input sequence
+/// \param out      The output buffer; it must have room for base32_encoded_size ( n, flags ) characters
+/// \param flags    The alphabet and padding to use
+/// \return         One past the last character written
+template <typename T, typename CharT>
+typename boost::enable_if<boost::is_integral<T>, CharT *>::type
+base32_encode_to_buffer ( const T *first, std::size_t n, CharT *out, base32_flags flags = base32_standard ) {
+    return detail::radix_encode_buffer<detail::base32_codec> ( first, n, out, flags );
+    }
+
+
+/// \fn base32_decode_to_buffer ( const CharT *first, std::size_t n, T *out, base32_flags flags )
+/// \brief   Converts a sequence of base32 characters into a sequence of 8-bit values.
+///             Whole groups of eight characters are converted without checking for the end of the input.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of characters in the input sequence
+/// \param out      The output buffer; it must have room for base32_decoded_size ( n ) values
+/// \param flags    The alphabet and padding to expect
+/// \return         One past the last value written
+template <typename CharT, typename T>
+typename boost::enable_if<boost::is_integral<T>, T *>::type
+base32_decode_to_buffer ( const CharT *first, std::size_t n, T *out, base32_flags flags = base32_standard ) {
+    return detail::radix_decode_buffer<detail::base32_codec> ( first, n, out, flags );
+    }
+
+}}
+
+#endif // BOOST_ALGORITHM_BASE32_HPP
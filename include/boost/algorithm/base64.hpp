@@ -0,0 +1,293 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    General problem - turn a sequence of 8-bit values into a sequence of base64 characters.
+    - and back.
+*/
+
+/// \file  base64.hpp
+/// \brief Convert a sequence of 8-bit values into a sequence of base64
+///     characters and back, as described in RFC 4648.
+/// \author agent
+
+#ifndef BOOST_ALGORITHM_BASE64_HPP
+#define BOOST_ALGORITHM_BASE64_HPP
+
+#include <cstddef>      // for std::size_t
+
+#include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/algorithm/detail/radix_codec.hpp>
+
+
+namespace boost { namespace algorithm {
+
+/*!
+    \enum  base64_flags
+    \brief Select the alphabet and the padding used by the base64 functions.
+                Combine them with '|'.
+*/
+enum base64_flags {
+    base64_standard   = 0,  ///< The standard alphabet ('+' and '/'), with padding
+    base64_url        = 1,  ///< The URL and filename safe alphabet ('-' and '_')
+    base64_no_padding = 2   ///< Do not write (or accept) trailing '=' characters
+    };
+
+inline base64_flags operator| ( base64_flags lhs, base64_flags rhs ) {
+    return static_cast<base64_flags> ( static_cast<int> ( lhs ) | static_cast<int> ( rhs ));
+    }
+
+/*!
+    \struct non_base64_input
+    \brief  Thrown when a character that is not in the alphabet is encountered
+                when decoding (contains the offending character), or when a
+                value that does not fit in 8 bits is encoded.
+                Running out of input throws not_enough_input, as for hex.
+*/
+struct BOOST_SYMBOL_VISIBLE non_base64_input : virtual hex_decode_error {};
+
+namespace detail {
+/// \cond DOXYGEN_HIDE
+
+    struct base64_codec {
+        BOOST_STATIC_CONSTANT ( std::size_t, bits = 6 );
+        BOOST_STATIC_CONSTANT ( std::size_t, group_bytes = 3 );
+        BOOST_STATIC_CONSTANT ( std::size_t, group_chars = 4 );
+        typedef non_base64_input bad_input;
+
+        static const char *alphabet ( int flags );
+        static const signed char *values ( int flags );
+        };
+
+    template <typename Dummy>
+    struct base64_tables {
+        static const char         alphabets [ 2 ][ 65 ];
+        static const signed char  values [ 2 ][ 256 ];
+        };
+
+    template <typename Dummy>
+    const char base64_tables<Dummy>::alphabets [ 2 ][ 65 ] = {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+        };
+
+    template <typename Dummy>
+    const signed char base64_tables<Dummy>::values [ 2 ][ 256 ] = {
+      {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+        -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+        -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+      },
+      {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+        -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, 63,
+        -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+      }
+        };
+
+    inline const char *base64_codec::alphabet ( int flags ) {
+        return base64_tables<void>::alphabets [ ( flags & radix_alternate ) ? 1 : 0 ];
+        }
+
+    inline const signed char *base64_codec::values ( int flags ) {
+        return base64_tables<void>::values [ ( flags & radix_alternate ) ? 1 : 0 ];
+        }
+/// \endcond
+    }
+
+
+/// \fn base64_encode ( InputIterator first, InputIterator last, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base64 characters.
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename InputIterator, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<typename detail::hex_iterator_traits<InputIterator>::value_type>, OutputIterator>::type
+base64_encode ( InputIterator first, InputIterator last, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_encode<detail::base64_codec> ( first, last, out, flags, detail::iter_end<InputIterator> );
+    }
+
+
+/// \fn base64_encode ( const T *ptr, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base64 characters.
+///
+/// \param ptr      A pointer to a 0-terminated sequence of data.
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename T, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<T>, OutputIterator>::type
+base64_encode ( const T *ptr, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_encode<detail::base64_codec> ( ptr, (const T *) NULL, out, flags, detail::ptr_end<T> );
+    }
+
+
+/// \fn base64_encode ( const Range &r, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base64 characters.
+///
+/// \param r        The input range
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to use
+/// \return         The updated output iterator
+template <typename Range, typename OutputIterator>
+typename boost::enable_if<boost::is_integral<typename detail::hex_iterator_traits<typename Range::iterator>::value_type>, OutputIterator>::type
+base64_encode ( const Range &r, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_encode_range<detail::base64_codec> ( r, out, flags );
+    }
+
+
+/// \fn base64_decode ( InputIterator first, InputIterator last, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of base64 characters into a sequence of 8-bit values.
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename InputIterator, typename OutputIterator>
+OutputIterator base64_decode ( InputIterator first, InputIterator last, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_decode<detail::base64_codec> ( first, last, out, flags, detail::iter_end<InputIterator> );
+    }
+
+
+/// \fn base64_decode ( const T *ptr, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of base64 characters into a sequence of 8-bit values.
+///
+/// \param ptr      A pointer to a null-terminated input sequence.
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename T, typename OutputIterator>
+OutputIterator base64_decode ( const T *ptr, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_decode<detail::base64_codec> ( ptr, (const T *) NULL, out, flags, detail::ptr_end<T> );
+    }
+
+
+/// \fn base64_decode ( const Range &r, OutputIterator out, base64_flags flags )
+/// \brief   Converts a sequence of base64 characters into a sequence of 8-bit values.
+///
+/// \param r        The input range
+/// \param out      An output iterator to the results into
+/// \param flags    The alphabet and padding to expect
+/// \return         The updated output iterator
+template <typename Range, typename OutputIterator>
+OutputIterator base64_decode ( const Range &r, OutputIterator out, base64_flags flags = base64_standard ) {
+    return detail::radix_decode_range<detail::base64_codec> ( r, out, flags );
+    }
+
+
+/// \fn String base64_encode ( const String &input, base64_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base64 characters.
+///
+/// \param input    A container to be converted
+/// \param flags    The alphabet and padding to use
+/// \return         A container with the encoded text
+template<typename String>
+String base64_encode ( const String &input, base64_flags flags = base64_standard ) {
+    return detail::radix_encode_string<detail::base64_codec> ( input, flags );
+    }
+
+
+/// \fn String base64_decode ( const String &input, base64_flags flags )
+/// \brief   Converts a sequence of base64 characters into a sequence of 8-bit values.
+///
+/// \param input    A container to be converted
+/// \param flags    The alphabet and padding to expect
+/// \return         A container with the decoded data
+template<typename String>
+String base64_decode ( const String &input, base64_flags flags = base64_standard ) {
+    return detail::radix_decode_string<detail::base64_codec> ( input, flags );
+    }
+
+
+/// \fn base64_encoded_size ( std::size_t n, base64_flags flags )
+/// \brief   The number of characters that base64_encode produces for n values.
+///
+/// \param n        The number of values to be encoded
+/// \param flags    The alphabet and padding to use
+BOOST_CONSTEXPR inline std::size_t base64_encoded_size ( std::size_t n, base64_flags flags = base64_standard ) {
+    return detail::radix_encoded_size<detail::base64_codec> ( n, flags );
+    }
+
+
+/// \fn base64_decoded_size ( std::size_t n )
+/// \brief   The largest number of values that base64_decode can produce from
+///             n characters. Padding characters make the actual number smaller.
+///
+/// \param n        The number of characters to be decoded
+BOOST_CONSTEXPR inline std::size_t base64_decoded_size ( std::size_t n ) {
+    return detail::radix_decoded_size<detail::base64_codec> ( n );
+    }
+
+
+/// \fn base64_encode_to_buffer ( const T *first, std::size_t n, CharT *out, base64_flags flags )
+/// \brief   Converts a sequence of 8-bit values into a sequence of base64 characters.
+///             Whole groups of three values are converted without checking for the end of the input.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of values in the input sequence
+/// \param out      The output buffer; it must have room for base64_encoded_size ( n, flags ) characters
+/// \param flags    The alphabet and padding to use
+/// \return         One past the last character written
+template <typename T, typename CharT>
+typename boost::enable_if<boost::is_integral<T>, CharT *>::type
+base64_encode_to_buffer ( const T *first, std::size_t n, CharT *out, base64_flags flags = base64_standard ) {
+    return detail::radix_encode_buffer<detail::base64_codec> ( first, n, out, flags );
+    }
+
+
+/// \fn base64_decode_to_buffer ( const CharT *first, std::size_t n, T *out, base64_flags flags )
+/// \brief   Converts a sequence of base64 characters into a sequence of 8-bit values.
+///             Whole groups of four characters are converted without checking for the end of the input.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of characters in the input sequence
+/// \param out      The output buffer; it must have room for base64_decoded_size ( n ) values
+/// \param flags    The alphabet and padding to expect
+/// \return         One past the last value written
+template <typename CharT, typename T>
+typename boost::enable_if<boost::is_integral<T>, T *>::type
+base64_decode_to_buffer ( const CharT *first, std::size_t n, T *out, base64_flags flags = base64_standard ) {
+    return detail::radix_decode_buffer<detail::base64_codec> ( first, n, out, flags );
+    }
+
+}}
+
+#endif // BOOST_ALGORITHM_BASE64_HPP
@@ -19,6 +19,7 @@
 #ifndef BOOST_ALGORITHM_CLAMP_HPP
 #define BOOST_ALGORITHM_CLAMP_HPP
 
+#include <cstddef>          //  For std::ptrdiff_t
 #include <functional>       //  For std::less
 #include <iterator>         //  For std::iterator_traits
 #include <cassert>
@@ -26,8 +27,14 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/type_identity.hpp> // for boost::type_identity
 #include <boost/core/enable_if.hpp>            // for boost::disable_if
+#include <boost/algorithm/detail/contiguous.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -76,6 +83,103 @@ namespace boost { namespace algorithm {
     return boost::algorithm::clamp ( val, lo, hi, std::less<T>());
   } 
 
+  namespace detail {
+/// \cond DOXYGEN_HIDE
+//  Arrays of arithmetic values clamped with the default comparison are done
+//  a block at a time, in loops without branches and with a fixed trip count,
+//  which compilers turn into vector compares and blends. Each block goes
+//  through a local buffer, so the compiler needn't worry that the output
+//  overlaps the input. The expression is the one in clamp, so the results
+//  (for NaNs too) are the same.
+    template<typename T>
+    BOOST_CXX14_CONSTEXPR T clamp_value ( const T v, const T lo, const T hi )
+    {
+      return v < lo ? lo : hi < v ? hi : v;
+    }
+
+    template<typename T>
+    BOOST_CXX14_CONSTEXPR T* clamp_contiguous ( const T* first, const T* last, T* out, const T lo, const T hi )
+    {
+      const std::ptrdiff_t block = 64 / sizeof ( T ) > 0 ? 64 / sizeof ( T ) : 1;
+      for ( ; last - first >= block; first += block, out += block ) {
+        T buffer [ block ] = {};
+        for ( std::ptrdiff_t i = 0; i < block; ++i )
+          buffer [ i ] = clamp_value ( first [ i ], lo, hi );
+        for ( std::ptrdiff_t i = 0; i < block; ++i )
+          out [ i ] = buffer [ i ];
+        }
+      for ( ; first != last; ++first, ++out )
+        *out = clamp_value ( *first, lo, hi );
+      return out;
+    }
+
+    template<typename InputIterator, typename OutputIterator, typename Pred> 
+    BOOST_CXX14_CONSTEXPR OutputIterator clamp_range_impl ( InputIterator first, InputIterator last, OutputIterator out,
+      typename std::iterator_traits<InputIterator>::value_type const & lo, 
+      typename std::iterator_traits<InputIterator>::value_type const & hi, Pred p )
+    {
+      while ( first != last )
+          *out++ = boost::algorithm::clamp ( *first++, lo, hi, p );
+      return out;
+    }
+
+//  Whether [first, last) and out are both arrays (pointers, or the iterators
+//  of std::vector, std::string or std::wstring) of the arithmetic type T.
+//  The output iterator is only looked at when the input is such an array.
+    template<typename OutputIterator, typename T,
+             bool Contiguous = boost::algorithm::detail::is_contiguous_iterator<OutputIterator, T>::value>
+    struct is_clamp_output : public boost::false_type {};
+
+    template<typename OutputIterator, typename T>
+    struct is_clamp_output<OutputIterator, T, true> : public boost::is_same<
+        typename boost::algorithm::detail::contiguous_element<OutputIterator>::type, T> {};
+
+    template<typename InputIterator, typename OutputIterator, typename T,
+             bool Contiguous = boost::algorithm::detail::is_contiguous_scalars<InputIterator>::value>
+    struct is_clamp_contiguous : public boost::false_type {};
+
+    template<typename InputIterator, typename OutputIterator, typename T>
+    struct is_clamp_contiguous<InputIterator, OutputIterator, T, true> : public boost::integral_constant<bool,
+           boost::is_arithmetic<T>::value
+        && boost::is_same<typename boost::remove_cv<typename std::iterator_traits<InputIterator>::value_type>::type, T>::value
+        && is_clamp_output<OutputIterator, T>::value> {};
+
+    template<typename InputIterator, typename OutputIterator, typename T> 
+    BOOST_CXX14_CONSTEXPR typename boost::enable_if<is_clamp_contiguous<InputIterator, OutputIterator, T>, OutputIterator>::type
+    clamp_range_impl ( InputIterator first, InputIterator last, OutputIterator out, T const & lo, T const & hi, std::less<T> )
+    {
+      if ( first == last )
+        return out;
+      const T *in = boost::algorithm::detail::contiguous_pointer ( first );
+      T *dest = boost::algorithm::detail::contiguous_pointer ( out );
+      return out + ( clamp_contiguous<T> ( in, in + ( last - first ), dest, lo, hi ) - dest );
+    }
+
+    template<typename ForwardIterator, typename Pred> 
+    BOOST_CXX14_CONSTEXPR void clamp_range_inplace_impl ( ForwardIterator first, ForwardIterator last,
+      typename std::iterator_traits<ForwardIterator>::value_type const & lo, 
+      typename std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+    {
+    //  Only the values that change are written
+      for ( ; first != last; ++first )
+        if ( p ( *first, lo ))
+          *first = lo;
+        else if ( p ( hi, *first ))
+          *first = hi;
+    }
+
+    template<typename ForwardIterator, typename T> 
+    BOOST_CXX14_CONSTEXPR typename boost::enable_if<is_clamp_contiguous<ForwardIterator, ForwardIterator, T> >::type
+    clamp_range_inplace_impl ( ForwardIterator first, ForwardIterator last, T const & lo, T const & hi, std::less<T> )
+    {
+      if ( first == last )
+        return;
+      T *p = boost::algorithm::detail::contiguous_pointer ( first );
+      (void) clamp_contiguous<T> ( p, p + ( last - first ), p, lo, hi );
+    }
+/// \endcond
+    }
+
 /// \fn clamp_range ( InputIterator first, InputIterator last, OutputIterator out, 
 ///       std::iterator_traits<InputIterator>::value_type const & lo, 
 ///       std::iterator_traits<InputIterator>::value_type const & hi )
@@ -86,16 +190,17 @@ namespace boost { namespace algorithm {
 /// \param out   An output iterator to write the clamped values into
 /// \param lo    The lower bound of the range to be clamped to
 /// \param hi    The upper bound of the range to be clamped to
+///
+/// \note From one array of arithmetic values to another, this is a loop
+///     that compilers can vectorize.
 ///
   template<typename InputIterator, typename OutputIterator> 
   BOOST_CXX14_CONSTEXPR OutputIterator clamp_range ( InputIterator first, InputIterator last, OutputIterator out,
     typename std::iterator_traits<InputIterator>::value_type const & lo, 
     typename std::iterator_traits<InputIterator>::value_type const & hi )
   {
-  // this could also be written with bind and std::transform
-    while ( first != last )
-        *out++ = boost::algorithm::clamp ( *first++, lo, hi );
-    return out;
+    typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+    return detail::clamp_range_impl ( first, last, out, lo, hi, std::less<value_type>());
   } 
 
 /// \fn clamp_range ( const Range &r, OutputIterator out, 
@@ -138,10 +243,7 @@ namespace boost { namespace algorithm {
     typename std::iterator_traits<InputIterator>::value_type const & lo, 
     typename std::iterator_traits<InputIterator>::value_type const & hi, Pred p )
   {
-  // this could also be written with bind and std::transform
-    while ( first != last )
-        *out++ = boost::algorithm::clamp ( *first++, lo, hi, p );
-    return out;
+    return detail::clamp_range_impl ( first, last, out, lo, hi, p );
   } 
 
 /// \fn clamp_range ( const Range &r, OutputIterator out, 
@@ -171,6 +273,90 @@ namespace boost { namespace algorithm {
   } 
 
 
+
+/// \fn clamp_range_inplace ( ForwardIterator first, ForwardIterator last, 
+///       std::iterator_traits<ForwardIterator>::value_type const & lo, 
+///       std::iterator_traits<ForwardIterator>::value_type const & hi )
+/// \brief clamp each of the values in [first, last) into [ lo, hi ], in place
+/// 
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range to be clamped to
+/// \param hi    The upper bound of the range to be clamped to
+///
+/// \note For an array of arithmetic values, this is a loop that compilers 
+///     can vectorize; otherwise, only the values that 
+///     are out of the range are assigned to.
+///
+  template<typename ForwardIterator> 
+  BOOST_CXX14_CONSTEXPR void clamp_range_inplace ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo, 
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi )
+  {
+    typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+    detail::clamp_range_inplace_impl ( first, last, lo, hi, std::less<value_type>());
+  } 
+
+/// \fn clamp_range_inplace ( Range &r, 
+///       typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & hi )
+/// \brief clamp each of the values in the range r into [ lo, hi ], in place
+/// 
+/// \param r     The range of values to be clamped
+/// \param lo    The lower bound of the range to be clamped to
+/// \param hi    The upper bound of the range to be clamped to
+///
+  template<typename Range> 
+  BOOST_CXX14_CONSTEXPR void clamp_range_inplace ( Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & lo, 
+    typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & hi )
+  {
+    boost::algorithm::clamp_range_inplace ( boost::begin ( r ), boost::end ( r ), lo, hi );
+  } 
+
+/// \fn clamp_range_inplace ( ForwardIterator first, ForwardIterator last, 
+///       std::iterator_traits<ForwardIterator>::value_type const & lo, 
+///       std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+/// \brief clamp each of the values in [first, last) into [ lo, hi ], in place,
+///     using the comparison predicate p.
+/// 
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range to be clamped to
+/// \param hi    The upper bound of the range to be clamped to
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename ForwardIterator, typename Pred> 
+  BOOST_CXX14_CONSTEXPR void clamp_range_inplace ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo, 
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+  {
+    detail::clamp_range_inplace_impl ( first, last, lo, hi, p );
+  } 
+
+/// \fn clamp_range_inplace ( Range &r, 
+///       typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & hi,
+///       Pred p )
+/// \brief clamp each of the values in the range r into [ lo, hi ], in place,
+///     using the comparison predicate p.
+/// 
+/// \param r     The range of values to be clamped
+/// \param lo    The lower bound of the range to be clamped to
+/// \param hi    The upper bound of the range to be clamped to
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename Range, typename Pred> 
+  BOOST_CXX14_CONSTEXPR void clamp_range_inplace ( Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & lo, 
+    typename std::iterator_traits<typename boost::range_iterator<Range>::type>::value_type const & hi,
+    Pred p )
+  {
+    boost::algorithm::clamp_range_inplace ( boost::begin ( r ), boost::end ( r ), lo, hi, p );
+  } 
+
 }}
 
 #endif // BOOST_ALGORITHM_CLAMP_HPP
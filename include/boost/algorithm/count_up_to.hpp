@@ -0,0 +1,141 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/// \file  count_up_to.hpp
+/// \brief Count the elements of a range that match a value or predicate,
+///        stopping once a limit is reached.
+/// \author agent
+
+#ifndef BOOST_ALGORITHM_COUNT_UP_TO_HPP
+#define BOOST_ALGORITHM_COUNT_UP_TO_HPP
+
+#include <cstddef>
+#include <iterator>     // for std::iterator_traits
+
+#include <boost/config.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/difference_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/find_value.hpp>
+
+namespace boost { namespace algorithm {
+
+/// \fn count_if_up_to ( InputIterator first, InputIterator last, Predicate p, typename std::iterator_traits<InputIterator>::difference_type n )
+/// \return the number of elements in [first, last) that satisfy the predicate 'p',
+///     or 'n' if there are at least 'n' of them. No element after the 'n'th
+///     match is looked at.
+/// \note returns 0 if 'n' is not positive
+///
+/// \param first The start of the input sequence
+/// \param last  One past the end of the input sequence
+/// \param p     A predicate for testing the elements of the sequence
+/// \param n     The most matches to count
+///
+template<typename InputIterator, typename Predicate>
+BOOST_CXX14_CONSTEXPR typename std::iterator_traits<InputIterator>::difference_type
+count_if_up_to ( InputIterator first, InputIterator last, Predicate p,
+                 typename std::iterator_traits<InputIterator>::difference_type n )
+{
+    typename std::iterator_traits<InputIterator>::difference_type count = 0;
+    if ( n <= 0 )
+        return count;
+    for ( ; first != last; ++first )
+        if ( p(*first) && ++count == n )
+            break;
+    return count;
+}
+
+/// \fn count_if_up_to ( const Range &r, Predicate p, typename boost::range_difference<const Range>::type n )
+/// \return the number of elements in the range that satisfy the predicate 'p',
+///     or 'n' if there are at least 'n' of them.
+///
+/// \param r    The input range
+/// \param p    A predicate for testing the elements of the range
+/// \param n    The most matches to count
+///
+template<typename Range, typename Predicate>
+BOOST_CXX14_CONSTEXPR typename boost::range_difference<const Range>::type
+count_if_up_to ( const Range &r, Predicate p, typename boost::range_difference<const Range>::type n )
+{
+    return boost::algorithm::count_if_up_to ( boost::begin (r), boost::end (r), p, n );
+}
+
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+template<typename InputIterator, typename T>
+BOOST_CXX14_CONSTEXPR typename std::iterator_traits<InputIterator>::difference_type
+count_equal_up_to ( InputIterator first, InputIterator last, const T &val,
+                    typename std::iterator_traits<InputIterator>::difference_type n, boost::false_type )
+{
+    typename std::iterator_traits<InputIterator>::difference_type count = 0;
+    if ( n <= 0 )
+        return count;
+    for ( ; first != last; ++first )
+        if ( *first == val && ++count == n )
+            break;
+    return count;
+}
+
+//  Arrays of numbers are counted thirty two bytes at a time
+template<typename InputIterator, typename T>
+BOOST_CXX14_CONSTEXPR typename std::iterator_traits<InputIterator>::difference_type
+count_equal_up_to ( InputIterator first, InputIterator last, const T &val,
+                    typename std::iterator_traits<InputIterator>::difference_type n, boost::true_type )
+{
+    if ( first == last || n <= 0 || is_constant_evaluated ())
+        return detail::count_equal_up_to ( first, last, val, n, boost::false_type ());
+    return static_cast<typename std::iterator_traits<InputIterator>::difference_type> (
+        detail::count_value_in ( first, last, val, static_cast<std::size_t> ( n )));
+}
+
+}
+/// \endcond
+
+/// \fn count_equal_up_to ( InputIterator first, InputIterator last, const T &val, typename std::iterator_traits<InputIterator>::difference_type n )
+/// \return the number of elements in [first, last) that are equal to 'val',
+///     or 'n' if there are at least 'n' of them.
+/// \note returns 0 if 'n' is not positive
+///
+/// \param first The start of the input sequence
+/// \param last  One past the end of the input sequence
+/// \param val   A value to compare against
+/// \param n     The most matches to count
+///
+/// \note Arrays of integers, floats and doubles are counted thirty two bytes
+///       at a time (except in constant expressions), checking for the limit
+///       after each block.
+///
+template<typename InputIterator, typename T>
+BOOST_CXX14_CONSTEXPR typename std::iterator_traits<InputIterator>::difference_type
+count_equal_up_to ( InputIterator first, InputIterator last, const T &val,
+                    typename std::iterator_traits<InputIterator>::difference_type n )
+{
+    return detail::count_equal_up_to ( first, last, val, n,
+        typename detail::is_value_searchable<InputIterator, T>::type ());
+}
+
+/// \fn count_equal_up_to ( const Range &r, const T &val, typename boost::range_difference<const Range>::type n )
+/// \return the number of elements in the range that are equal to 'val',
+///     or 'n' if there are at least 'n' of them.
+///
+/// \param r    The input range
+/// \param val  A value to compare against
+/// \param n    The most matches to count
+///
+template<typename Range, typename T>
+BOOST_CXX14_CONSTEXPR typename boost::range_difference<const Range>::type
+count_equal_up_to ( const Range &r, const T &val, typename boost::range_difference<const Range>::type n )
+{
+    return boost::algorithm::count_equal_up_to ( boost::begin (r), boost::end (r), val, n );
+}
+
+}} // namespace boost and algorithm
+
+#endif // BOOST_ALGORITHM_COUNT_UP_TO_HPP
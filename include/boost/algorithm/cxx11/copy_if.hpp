@@ -17,6 +17,11 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/copy_if.hpp>
+#include <boost/algorithm/detail/parallel_copy_if.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -30,13 +35,15 @@ namespace boost { namespace algorithm {
 /// \param result   An output iterator to write the results into
 /// \param p        A predicate for testing the elements of the range
 /// \note           This function is part of the C++2011 standard library.
+/// \note           For arrays of numbers (and pointers), the elements are copied
+///     through a buffer without a branch on each result (except in constant
+///     expressions). The predicate is still applied to each element once, in order,
+///     and if it throws, the elements before it have still been copied.
 template<typename InputIterator, typename OutputIterator, typename Predicate> 
 BOOST_CXX14_CONSTEXPR OutputIterator copy_if ( InputIterator first, InputIterator last, OutputIterator result, Predicate p )
 {
-    for ( ; first != last; ++first )
-        if (p(*first))
-            *result++ = *first;
-    return result;
+    return boost::algorithm::detail::copy_if ( first, last, result, p,
+        typename boost::algorithm::detail::is_copy_blockwise<InputIterator>::type ());
 }
 
 /// \fn copy_if ( const Range &r, OutputIterator result, Predicate p )
@@ -206,6 +213,30 @@ copy_if_until ( const Range& r, OutputIterator result, CopyPredicate copy_pred,
     return boost::algorithm::copy_if_until(boost::begin(r), boost::end(r), result, copy_pred, term_pred);
 }
 
+/// \fn copy_if ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, OutputIterator result, Predicate p )
+/// \brief Copies all the elements from the input range that satisfy the
+/// predicate to the output range, in the same order as copy_if.
+/// \return The updated output iterator
+///
+/// \param policy   The execution policy (execution::seq or execution::par)
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param result   An output iterator to write the results into
+/// \param p        A predicate for testing the elements of the range
+///
+/// \note With execution::par, when the input and the output are both random
+///     access, the matches in each chunk of the input are counted concurrently,
+///     the counts are summed to give each chunk its place in the output, and the
+///     chunks are then copied concurrently. The predicate is applied to each element
+///     once, but must be safe to call from several threads at once; the output
+///     must not overlap the input.
+template<typename ExecutionPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+copy_if ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, OutputIterator result, Predicate p )
+{
+    return boost::algorithm::detail::policy_copy_if ( policy, first, last, result, p );
+}
+
 }} // namespace boost and algorithm
 
 #endif  // BOOST_ALGORITHM_COPY_IF_HPP
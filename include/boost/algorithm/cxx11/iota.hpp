@@ -12,9 +12,16 @@
 #ifndef BOOST_ALGORITHM_IOTA_HPP
 #define BOOST_ALGORITHM_IOTA_HPP
 
+#include <cstddef>      // for std::size_t
+
 #include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/type_identity.hpp> // for boost::type_identity
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/iota.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -25,11 +32,29 @@ namespace boost { namespace algorithm {
 /// \param last     One past the end of the input sequence
 /// \param value    The initial value of the sequence to be generated
 /// \note           This function is part of the C++2011 standard library.
+/// \note           Arrays of numbers are filled without a dependency from one
+///     element to the next (except in constant expressions, and when value
+///     is a floating point number for which that would round differently).
 template <typename ForwardIterator, typename T>
 BOOST_CXX14_CONSTEXPR void iota ( ForwardIterator first, ForwardIterator last, T value )
 {
-    for ( ; first != last; ++first, ++value )
-        *first = value;
+    boost::algorithm::detail::iota ( first, last, value,
+        typename boost::algorithm::detail::is_iota_blockwise<ForwardIterator, T>::type ());
+}
+
+/// \fn iota ( ForwardIterator first, ForwardIterator last, T value, T step )
+/// \brief Generates a sequence of values, each one step more than the one
+///     before, and stores them in [first, last)
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param value    The initial value of the sequence to be generated
+/// \param step     The difference between consecutive values
+template <typename ForwardIterator, typename T>
+BOOST_CXX14_CONSTEXPR void iota ( ForwardIterator first, ForwardIterator last, T value,
+                                  typename boost::type_identity<T>::type step )
+{
+    boost::algorithm::detail::iota_step ( first, last, value, step );
 }
 
 /// \fn iota ( Range &r, T value )
@@ -55,10 +80,43 @@ BOOST_CXX14_CONSTEXPR void iota ( Range &r, T value )
 template <typename OutputIterator, typename T>
 BOOST_CXX14_CONSTEXPR OutputIterator iota_n ( OutputIterator out, T value, std::size_t n )
 {
-    for ( ; n > 0; --n, ++value )
-        *out++ = value;
+    return boost::algorithm::detail::iota_n ( out, value, n,
+        typename boost::algorithm::detail::is_iota_blockwise<OutputIterator, T>::type ());
+}
 
-    return out;
+/// \fn iota ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, T value )
+/// \brief Generates an increasing sequence of values, and stores them in [first, last),
+///     using an execution policy
+///
+/// \param policy   The execution policy (execution::seq or execution::par)
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param value    The initial value of the sequence to be generated
+/// \note With execution::par, a random access sequence of numbers is split
+///     into chunks, and each chunk's first value is computed directly.
+template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+iota ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, T value )
+{
+    boost::algorithm::detail::policy_iota ( policy, first, last, value,
+        typename boost::algorithm::detail::is_iota_number<T>::type ());
+}
+
+/// \fn iota ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, T value, T step )
+/// \brief Generates a sequence of values, each one step more than the one
+///     before, and stores them in [first, last), using an execution policy
+///
+/// \param policy   The execution policy (execution::seq or execution::par)
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param value    The initial value of the sequence to be generated
+/// \param step     The difference between consecutive values
+template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+iota ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, T value,
+       typename boost::type_identity<T>::type step )
+{
+    boost::algorithm::detail::policy_iota ( policy, first, last, value, step );
 }
 
 }}
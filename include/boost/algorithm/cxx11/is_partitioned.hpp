@@ -13,9 +13,13 @@
 #define BOOST_ALGORITHM_IS_PARTITIONED_HPP
 
 #include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/is_partitioned.hpp>
+
 namespace boost { namespace algorithm {
 
 /// \fn is_partitioned ( InputIterator first, InputIterator last, UnaryPredicate p )
@@ -26,18 +30,13 @@ namespace boost { namespace algorithm {
 /// \param last     One past the end of the input sequence
 /// \param p        The predicate to test the values with
 /// \note           This function is part of the C++2011 standard library.
+/// \note           Arrays of numbers are tested a block at a time (except in
+///     constant expressions), so p may be applied to some elements after the
+///     first one out of place, but still at most once to each element.
 template <typename InputIterator, typename UnaryPredicate>
 BOOST_CXX14_CONSTEXPR bool is_partitioned ( InputIterator first, InputIterator last, UnaryPredicate p )
 {
-//  Run through the part that satisfy the predicate
-    for ( ; first != last; ++first )
-        if ( !p (*first))
-            break;
-//  Now the part that does not satisfy the predicate
-    for ( ; first != last; ++first )
-        if ( p (*first))
-            return false;
-    return true;
+    return boost::algorithm::detail::partitioned_until ( first, last, p ) == last;
 }
 
 /// \fn is_partitioned ( const Range &r, UnaryPredicate p )
@@ -46,6 +45,7 @@ BOOST_CXX14_CONSTEXPR bool is_partitioned ( InputIterator first, InputIterator l
 /// 
 /// \param r        The input range
 /// \param p        The predicate to test the values with
+/// \note           p may be applied to some elements after the first one out of place.
 ///
 template <typename Range, typename UnaryPredicate>
 BOOST_CXX14_CONSTEXPR bool is_partitioned ( const Range &r, UnaryPredicate p )
@@ -53,6 +53,24 @@ BOOST_CXX14_CONSTEXPR bool is_partitioned ( const Range &r, UnaryPredicate p )
     return boost::algorithm::is_partitioned (boost::begin(r), boost::end(r), p);
 }
 
+/// \fn is_partitioned ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, UnaryPredicate p )
+/// \brief Tests to see if a sequence is partitioned according to a predicate,
+///     using an execution policy
+///
+/// \param policy   The execution policy (execution::seq or execution::par)
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param p        The predicate to test the values with
+/// \note With execution::par, a random access sequence is split into chunks
+///     that are tested concurrently; p must be safe to call from several
+///     threads at once.
+/// \note p may be applied to some elements after the first one out of place.
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+is_partitioned ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, UnaryPredicate p )
+{
+    return boost::algorithm::detail::policy_partitioned_until ( policy, first, last, p ) == last;
+}
 
 }}
 
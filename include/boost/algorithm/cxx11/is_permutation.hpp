@@ -12,16 +12,20 @@
 #ifndef BOOST_ALGORITHM_IS_PERMUTATION11_HPP
 #define BOOST_ALGORITHM_IS_PERMUTATION11_HPP
 
-#include <algorithm>    // for std::find_if, count_if, mismatch
+#include <algorithm>    // for std::find_if, count_if, mismatch, sort
 #include <utility>      // for std::pair
 #include <functional>   // for std::equal_to
 #include <iterator>
+#include <vector>
 
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/core/enable_if.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/detail/is_permutation.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -61,6 +65,78 @@ namespace detail {
         return true;
         }                      
 
+//  Preconditions: the sequences are the same length
+//  Sorted copies of the sequences hold their equal values in runs of equivalent
+//  ones, which must be the same length and at the same place in both; within
+//  a run, the values are matched up by the quadratic search.
+    template< class ForwardIterator1, class ForwardIterator2, class Compare, class BinaryPredicate >
+    bool is_permutation_sort ( ForwardIterator1 first1, ForwardIterator1 last1,
+                               ForwardIterator2 first2, ForwardIterator2 last2,
+                               Compare comp, BinaryPredicate p ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ForwardIterator1>::value_type>::type value_type1;
+        typedef typename boost::remove_cv<typename std::iterator_traits<ForwardIterator2>::value_type>::type value_type2;
+        std::vector<value_type1> v1 ( first1, last1 );
+        std::vector<value_type2> v2 ( first2, last2 );
+        std::sort ( v1.begin (), v1.end (), comp );
+        std::sort ( v2.begin (), v2.end (), comp );
+
+        const std::size_t n = v1.size ();
+        for ( std::size_t i = 0; i < n; ) {
+            std::size_t j = i + 1;
+            while ( j < n && !comp ( v1 [ i ], v1 [ j ] ))
+                ++j;
+            for ( std::size_t k = i; k < j; ++k )
+                if ( comp ( v1 [ i ], v2 [ k ] ) || comp ( v2 [ k ], v1 [ i ] ))
+                    return false;
+            if ( j < n && !comp ( v1 [ i ], v2 [ j ] ))
+                return false;
+            if ( !is_permutation_inner ( v1.begin () + i, v1.begin () + j, v2.begin () + i, v2.begin () + j, p ))
+                return false;
+            i = j;
+            }
+        return true;
+        }
+
+    template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate >
+    bool is_permutation_strategy ( ForwardIterator1 first1, ForwardIterator1 last1,
+                                   ForwardIterator2 first2, ForwardIterator2 last2,
+                                   std::size_t n, BinaryPredicate p, permutation_count_tag ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ForwardIterator1>::value_type>::type value_type;
+        if ( sizeof ( value_type ) > 1 && n < permutation_count_wide )
+            return is_permutation_hash ( first1, last1, first2, last2, n, p, boost::hash<value_type> ());
+        return is_permutation_count ( first1, last1, first2, last2 );
+        }
+
+    template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate >
+    bool is_permutation_strategy ( ForwardIterator1 first1, ForwardIterator1 last1,
+                                   ForwardIterator2 first2, ForwardIterator2 last2,
+                                   std::size_t n, BinaryPredicate p, permutation_hash_tag ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ForwardIterator1>::value_type>::type value_type;
+        return is_permutation_hash ( first1, last1, first2, last2, n, p, boost::hash<value_type> ());
+        }
+
+    template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate >
+    bool is_permutation_strategy ( ForwardIterator1 first1, ForwardIterator1 last1,
+                                   ForwardIterator2 first2, ForwardIterator2 last2,
+                                   std::size_t, BinaryPredicate p, permutation_quadratic_tag ) {
+        return is_permutation_inner ( first1, last1, first2, last2, p );
+        }
+
+//  Preconditions:
+//  1. The sequences both have n elements
+//  2. Any common elements on the front have been removed
+//  Picks the counting or hashing check when the elements are compared
+//  with std::equal_to and their type allows it, and the quadratic one otherwise.
+    template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate >
+    bool is_permutation_dispatch ( ForwardIterator1 first1, ForwardIterator1 last1,
+                                   ForwardIterator2 first2, ForwardIterator2 last2,
+                                   std::size_t n, BinaryPredicate p ) {
+        if ( n < permutation_small )
+            return is_permutation_inner ( first1, last1, first2, last2, p );
+        return is_permutation_strategy ( first1, last1, first2, last2, n, p,
+            typename permutation_strategy<ForwardIterator1, ForwardIterator2, BinaryPredicate>::type ());
+        }
+
     template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate>
     bool is_permutation_tag ( ForwardIterator1 first1, ForwardIterator1 last1, 
                           ForwardIterator2 first2, ForwardIterator2 last2, 
@@ -72,10 +148,13 @@ namespace detail {
             ++first1;
             ++first2;
             }
-        if ( first1 != last1 && first2 != last2 )
-            return boost::algorithm::detail::is_permutation_inner ( first1, last1, first2, last2,
-                std::equal_to<typename std::iterator_traits<ForwardIterator1>::value_type> ());
-        return first1 == last1 && first2 == last2;
+        if ( first1 == last1 || first2 == last2 )
+            return first1 == last1 && first2 == last2;
+
+        const std::size_t n = std::distance ( first1, last1 );
+        if ( n != static_cast<std::size_t> ( std::distance ( first2, last2 )))
+            return false;
+        return is_permutation_dispatch ( first1, last1, first2, last2, n, p );
         }
 
     template <class RandomAccessIterator1, class RandomAccessIterator2, class BinaryPredicate>
@@ -93,7 +172,7 @@ namespace detail {
             }
 
         if ( first1 != last1 && first2 != last2 )
-            return is_permutation_inner (first1, last1, first2, last2, p);
+            return is_permutation_dispatch ( first1, last1, first2, last2, std::distance ( first1, last1 ), p );
         return first1 == last1 && first2 == last2;
         }
 
@@ -119,9 +198,10 @@ bool is_permutation ( ForwardIterator1 first1, ForwardIterator1 last1,
     first2 = eq.second;
     if ( first1 != last1 ) {
     //  Create last2
+        const std::size_t n = std::distance ( first1, last1 );
         ForwardIterator2 last2 = first2;
-        std::advance ( last2, std::distance (first1, last1));
-        return boost::algorithm::detail::is_permutation_inner ( first1, last1, first2, last2, p );
+        std::advance ( last2, n );
+        return boost::algorithm::detail::is_permutation_dispatch ( first1, last1, first2, last2, n, p );
         }
 
     return true;
@@ -145,9 +225,10 @@ bool is_permutation ( ForwardIterator1 first1, ForwardIterator1 last1, ForwardIt
     first2 = eq.second;
     if ( first1 != last1 ) {
     //  Create last2
+        const std::size_t n = std::distance ( first1, last1 );
         ForwardIterator2 last2 = first2;
-        std::advance ( last2, std::distance (first1, last1));
-        return boost::algorithm::detail::is_permutation_inner ( first1, last1, first2, last2,
+        std::advance ( last2, n );
+        return boost::algorithm::detail::is_permutation_dispatch ( first1, last1, first2, last2, n,
             std::equal_to<typename std::iterator_traits<ForwardIterator1>::value_type> ());
         }
     return true;
@@ -24,6 +24,9 @@
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/type_identity.hpp> // for boost::type_identity
 
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/is_sorted.hpp>
+
 namespace boost { namespace algorithm {
 
 /// \fn is_sorted_until ( ForwardIterator first, ForwardIterator last, Pred p )
@@ -34,18 +37,13 @@ namespace boost { namespace algorithm {
 /// \param last  One past the end of the sequence
 /// \param p     A binary predicate that returns true if two elements are ordered.
 ///
+/// \note Arrays of numbers compared with std::less, std::greater, std::less_equal
+///     or std::greater_equal are checked 256 bytes at a time (except in constant
+///     expressions).
     template <typename ForwardIterator, typename Pred>
     BOOST_CXX14_CONSTEXPR ForwardIterator is_sorted_until ( ForwardIterator first, ForwardIterator last, Pred p )
     {
-        if ( first == last ) return last;  // the empty sequence is ordered
-        ForwardIterator next = first;
-        while ( ++next != last )
-        {
-            if ( p ( *next, *first ))
-                return next;
-            first = next;
-        }
-        return last;    
+        return boost::algorithm::detail::sorted_until ( first, last, p );
     }
 
 /// \fn is_sorted_until ( ForwardIterator first, ForwardIterator last )
@@ -276,6 +274,137 @@ namespace boost { namespace algorithm {
         return is_strictly_decreasing ( boost::begin ( range ), boost::end ( range ));
     }
 
+///
+/// -- Execution policy versions
+///
+
+/// \fn is_sorted_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, Pred p )
+/// \return the point in the sequence [first, last) where the elements are unordered
+///     (according to the comparison predicate 'p').
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+/// \param p      A binary predicate that returns true if two elements are ordered.
+///
+/// \note With execution::par, the neighbouring pairs of a random access sequence
+///     are split into chunks that are checked concurrently; 'p' must be safe to
+///     call from several threads at once.
+    template <typename ExecutionPolicy, typename ForwardIterator, typename Pred>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, ForwardIterator>::type
+    is_sorted_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, Pred p )
+    {
+        return boost::algorithm::detail::policy_sorted_until ( policy, first, last, p );
+    }
+
+/// \fn is_sorted_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return the point in the sequence [first, last) where the elements are unordered
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, ForwardIterator>::type
+    is_sorted_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return boost::algorithm::detail::policy_sorted_until ( policy, first, last, std::less<value_type>());
+    }
+
+/// \fn is_sorted ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, Pred p )
+/// \return whether or not the entire sequence is sorted
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+/// \param p      A binary predicate that returns true if two elements are ordered.
+///
+    template <typename ExecutionPolicy, typename ForwardIterator, typename Pred>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_sorted ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, Pred p )
+    {
+        return boost::algorithm::detail::policy_sorted_until ( policy, first, last, p ) == last;
+    }
+
+/// \fn is_sorted ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return whether or not the entire sequence is sorted
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_sorted ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        return boost::algorithm::is_sorted_until ( policy, first, last ) == last;
+    }
+
+/// \fn is_increasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return true if the entire sequence is increasing; i.e, each item is greater than or
+///     equal to the previous one.
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_increasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return boost::algorithm::is_sorted ( policy, first, last, std::less<value_type>());
+    }
+
+/// \fn is_decreasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return true if the entire sequence is decreasing; i.e, each item is less than
+///     or equal to the previous one.
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_decreasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return boost::algorithm::is_sorted ( policy, first, last, std::greater<value_type>());
+    }
+
+/// \fn is_strictly_increasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return true if the entire sequence is strictly increasing; i.e, each item is greater
+///     than the previous one
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_strictly_increasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return boost::algorithm::is_sorted ( policy, first, last, std::less_equal<value_type>());
+    }
+
+/// \fn is_strictly_decreasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+/// \return true if the entire sequence is strictly decreasing; i.e, each item is less than
+///     the previous one
+///
+/// \param policy The execution policy (execution::seq or execution::par)
+/// \param first  The start of the sequence to be tested.
+/// \param last   One past the end of the sequence
+///
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    typename boost::enable_if<is_execution_policy<ExecutionPolicy>, bool>::type
+    is_strictly_decreasing ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last )
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return boost::algorithm::is_sorted ( policy, first, last, std::greater_equal<value_type>());
+    }
+
 }} // namespace boost
 
 #endif  // BOOST_ALGORITHM_ORDERED_HPP
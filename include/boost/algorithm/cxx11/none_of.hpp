@@ -15,6 +15,9 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/find_value.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -48,6 +51,30 @@ BOOST_CXX14_CONSTEXPR bool none_of ( const Range &r, Predicate p )
     return boost::algorithm::none_of (boost::begin (r), boost::end (r), p );
 } 
 
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+template<typename InputIterator, typename V> 
+BOOST_CXX14_CONSTEXPR bool none_of_equal ( InputIterator first, InputIterator last, const V &val, boost::false_type ) 
+{
+    for ( ; first != last; ++first )
+        if ( val == *first )
+            return false;
+    return true; 
+} 
+
+//  Arrays of numbers are compared thirty two bytes at a time
+template<typename InputIterator, typename V> 
+BOOST_CXX14_CONSTEXPR bool none_of_equal ( InputIterator first, InputIterator last, const V &val, boost::true_type ) 
+{
+    if ( first == last || is_constant_evaluated ())
+        return detail::none_of_equal ( first, last, val, boost::false_type ());
+    return detail::find_value_in<true> ( first, last, val ) == last;
+} 
+
+}
+/// \endcond
+
 /// \fn none_of_equal ( InputIterator first, InputIterator last, const V &val )
 /// \return true if none of the elements in [first, last) are equal to 'val'
 /// \note returns true on an empty range
@@ -56,13 +83,14 @@ BOOST_CXX14_CONSTEXPR bool none_of ( const Range &r, Predicate p )
 /// \param last  One past the end of the input sequence
 /// \param val   A value to compare against
 ///
+/// \note Arrays of integers, floats and doubles are compared thirty two bytes
+///       at a time (except in constant expressions).
+///
 template<typename InputIterator, typename V> 
 BOOST_CXX14_CONSTEXPR bool none_of_equal ( InputIterator first, InputIterator last, const V &val ) 
 {
-    for ( ; first != last; ++first )
-        if ( val == *first )
-            return false;
-    return true; 
+    return detail::none_of_equal ( first, last, val,
+        typename detail::is_value_searchable<InputIterator, V>::type ());
 } 
 
 /// \fn none_of_equal ( const Range &r, const V &val )
@@ -17,6 +17,7 @@
 #include <boost/range/end.hpp>
 
 #include <boost/algorithm/cxx11/none_of.hpp>
+#include <boost/algorithm/count_up_to.hpp>
 
 
 namespace boost { namespace algorithm {
@@ -31,14 +32,8 @@ namespace boost { namespace algorithm {
 template<typename InputIterator, typename Predicate> 
 BOOST_CXX14_CONSTEXPR bool one_of ( InputIterator first, InputIterator last, Predicate p )
 {
-//  find_if
-    for (; first != last; ++first)
-        if (p(*first))
-            break;
-
-    if (first == last)
-        return false;    // Didn't occur at all
-    return boost::algorithm::none_of (++first, last, p);
+//  One pass, which stops at the second match
+    return boost::algorithm::count_if_up_to ( first, last, p, 2 ) == 1;
 }
 
 /// \fn one_of ( const Range &r, Predicate p )
@@ -61,17 +56,14 @@ BOOST_CXX14_CONSTEXPR bool one_of ( const Range &r, Predicate p )
 /// \param last     One past the end of the input sequence
 /// \param val      A value to compare against
 ///
+/// \note Arrays of integers, floats and doubles are compared thirty two bytes
+///       at a time (except in constant expressions), stopping at the block
+///       with the second match.
+///
 template<typename InputIterator, typename V> 
 BOOST_CXX14_CONSTEXPR bool one_of_equal ( InputIterator first, InputIterator last, const V &val )
 {
-//  find
-    for (; first != last; ++first)
-        if (*first == val)
-            break;
-
-    if (first == last)
-        return false;                    // Didn't occur at all
-    return boost::algorithm::none_of_equal (++first, last, val);
+    return boost::algorithm::count_equal_up_to ( first, last, val, 2 ) == 1;
 }
 
 /// \fn one_of_equal ( const Range &r, const V &val )
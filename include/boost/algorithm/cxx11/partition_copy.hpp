@@ -17,6 +17,11 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/copy_if.hpp>
+#include <boost/algorithm/detail/parallel_copy_if.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -34,18 +39,18 @@ namespace boost { namespace algorithm {
 /// \param p         A predicate for dividing the elements of the input sequence.
 ///
 /// \note            This function is part of the C++2011 standard library.
+/// \note            For arrays of numbers (and pointers), the elements are copied
+///     through two buffers without a branch on each result (except in constant
+///     expressions). The predicate is still applied to each element once, in order,
+///     and if it throws, the elements before it have still been copied.
 template <typename InputIterator, 
         typename OutputIterator1, typename OutputIterator2, typename UnaryPredicate>
 BOOST_CXX14_CONSTEXPR std::pair<OutputIterator1, OutputIterator2>
 partition_copy ( InputIterator first, InputIterator last,
         OutputIterator1 out_true, OutputIterator2 out_false, UnaryPredicate p )
 {
-    for ( ; first != last; ++first )
-        if ( p (*first))
-            *out_true++ = *first;
-        else
-            *out_false++ = *first;
-    return std::pair<OutputIterator1, OutputIterator2> ( out_true, out_false );
+    return boost::algorithm::detail::partition_copy ( first, last, out_true, out_false, p,
+        typename boost::algorithm::detail::is_copy_blockwise<InputIterator>::type ());
 }
 
 /// \fn partition_copy ( const Range &r, 
@@ -66,6 +71,33 @@ partition_copy ( const Range &r, OutputIterator1 out_true, OutputIterator2 out_f
                       (boost::begin(r), boost::end(r), out_true, out_false, p );
 }
 
+/// \fn partition_copy ( const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+///     OutputIterator1 out_true, OutputIterator2 out_false, UnaryPredicate p )
+/// \brief Copies the elements that satisfy the predicate p from the range [first, last)
+///     to the range beginning at out_true, and the elements that do not to the range
+///     beginning at out_false, in the same order as partition_copy.
+///
+/// \param policy    The execution policy (execution::seq or execution::par)
+/// \param first     The start of the input sequence
+/// \param last      One past the end of the input sequence
+/// \param out_true  An output iterator to write the elements that satisfy the predicate into
+/// \param out_false An output iterator to write the elements that do not satisfy the predicate into
+/// \param p         A predicate for dividing the elements of the input sequence.
+///
+/// \note With execution::par, when the input and both outputs are random access,
+///     the chunks of the input are classified concurrently and then copied to
+///     their places in the outputs concurrently. The predicate is applied to each
+///     element once, but must be safe to call from several threads at once; the
+///     outputs must not overlap the input.
+template <typename ExecutionPolicy, typename InputIterator,
+        typename OutputIterator1, typename OutputIterator2, typename UnaryPredicate>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, std::pair<OutputIterator1, OutputIterator2> >::type
+partition_copy ( const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+        OutputIterator1 out_true, OutputIterator2 out_false, UnaryPredicate p )
+{
+    return boost::algorithm::detail::policy_partition_copy ( policy, first, last, out_true, out_false, p );
+}
+
 }} // namespace boost and algorithm
 
 #endif  // BOOST_ALGORITHM_PARTITION_COPY_HPP
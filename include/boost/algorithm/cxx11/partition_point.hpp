@@ -17,9 +17,70 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/prefetch.hpp>
 
 namespace boost { namespace algorithm {
 
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+    template <typename ForwardIterator, typename Predicate>
+    ForwardIterator partition_point ( ForwardIterator first, ForwardIterator last, Predicate p, std::forward_iterator_tag )
+    {
+        std::size_t dist = std::distance ( first, last );
+        while ( first != last ) {
+            std::size_t d2 = dist / 2;
+            ForwardIterator ret_val = first;
+            std::advance (ret_val, d2);
+            if (p (*ret_val)) {
+                first = ++ret_val;
+                dist -= d2 + 1;
+                }
+            else {
+                last = ret_val;
+                dist = d2;
+                }
+            }
+        return first;
+    }
+
+    template <typename RandomAccessIterator>
+    void partition_point_prefetch ( RandomAccessIterator it, boost::true_type ) { BOOST_ALGORITHM_PREFETCH ( &*it ); }
+
+    template <typename RandomAccessIterator>
+    void partition_point_prefetch ( RandomAccessIterator, boost::false_type ) {}
+
+//  The partition point is always in [first, first + len]. Each step halves
+//  len, moving first up (without a branch) when the last element of the
+//  lower half satisfies the predicate. Both places the next step might
+//  look at are prefetched, so on large arrays the cache misses of one step
+//  overlap the work of the one before. (Multiplying by the result, rather
+//  than choosing between half and 0, keeps compilers from branching on it.)
+    template <typename RandomAccessIterator, typename Predicate>
+    RandomAccessIterator partition_point ( RandomAccessIterator first, RandomAccessIterator last, Predicate p,
+                                           std::random_access_iterator_tag )
+    {
+        typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        typedef typename is_contiguous_iterator<RandomAccessIterator>::type contiguous;
+        difference_type len = last - first;
+        if ( len == 0 )
+            return first;
+        while ( len > 1 ) {
+            const difference_type half = len / 2;
+            len -= half;
+            detail::partition_point_prefetch ( first + len / 2, contiguous ());
+            detail::partition_point_prefetch ( first + ( half + len / 2 ), contiguous ());
+            first += half * static_cast<difference_type> ( static_cast<bool> ( p ( first [ half - 1 ] )));
+            }
+        return p ( *first ) ? first + 1 : first;
+    }
+
+}
+/// \endcond
+
 /// \fn partition_point ( ForwardIterator first, ForwardIterator last, Predicate p )
 /// \brief Given a partitioned range, returns the partition point, i.e, the first element 
 ///     that does not satisfy p
@@ -28,24 +89,14 @@ namespace boost { namespace algorithm {
 /// \param last     One past the end of the input sequence
 /// \param p        The predicate to test the values with
 /// \note           This function is part of the C++2011 standard library.
+/// \note           For random access iterators the search does not branch on the
+///     result of the predicate, and for arrays the elements it may look at next
+///     are prefetched.
 template <typename ForwardIterator, typename Predicate>
 ForwardIterator partition_point ( ForwardIterator first, ForwardIterator last, Predicate p )
 {
-    std::size_t dist = std::distance ( first, last );
-    while ( first != last ) {
-        std::size_t d2 = dist / 2;
-        ForwardIterator ret_val = first;
-        std::advance (ret_val, d2);
-        if (p (*ret_val)) {
-            first = ++ret_val;
-            dist -= d2 + 1;
-            }
-        else {
-            last = ret_val;
-            dist = d2;
-            }
-        }
-    return first;
+    typedef typename std::iterator_traits<ForwardIterator>::iterator_category category;
+    return boost::algorithm::detail::partition_point ( first, last, p, category ());
 }
 
 /// \fn partition_point ( Range &r, Predicate p )
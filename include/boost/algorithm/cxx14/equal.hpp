@@ -12,18 +12,65 @@
 #ifndef BOOST_ALGORITHM_EQUAL_HPP
 #define BOOST_ALGORITHM_EQUAL_HPP
 
+#include <cstring>      // for std::memcmp
 #include <iterator>
 
 #include <boost/config.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 
 namespace boost { namespace algorithm {
 
+/// \cond DOXYGEN_HIDE
 namespace detail {
 
     template <class T1, class T2>
     struct eq {
         BOOST_CONSTEXPR bool operator () ( const T1& v1, const T2& v2 ) const { return v1 == v2 ;}
         };
+
+//  Whether pred is == on values of type T
+    template <class BinaryPredicate, class T>
+    struct is_equality_predicate : public boost::integral_constant<bool,
+        boost::is_same<BinaryPredicate, eq<T, T> >::value || is_equal_to<BinaryPredicate, T>::value> {};
+
+//  Whether the ranges can be compared with memcmp: contiguous arrays of the
+//  same type, whose values are equal when their bytes are, compared with ==
+    template <class Iterator1, class Iterator2, class BinaryPredicate>
+    struct is_bytewise_equal {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator1>::value_type>::type value_type1;
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator2>::value_type>::type value_type2;
+        typedef boost::integral_constant<bool,
+               is_contiguous_scalars<Iterator1>::value && is_contiguous_scalars<Iterator2>::value
+            && boost::is_same<value_type1, value_type2>::value
+            && is_bitwise_comparable<value_type1>::value
+            && is_equality_predicate<BinaryPredicate, value_type1>::value> type;
+        };
+
+    template <class RandomAccessIterator1, class RandomAccessIterator2, class BinaryPredicate>
+    BOOST_CXX14_CONSTEXPR
+    bool equal_same_size ( RandomAccessIterator1 first1, RandomAccessIterator1 last1, 
+                           RandomAccessIterator2 first2, BinaryPredicate pred, boost::false_type )
+    {
+    //  std::equal
+        for (; first1 != last1; ++first1, ++first2)
+            if (!pred(*first1, *first2))
+                return false;
+        return true;
+    }
+
+    template <class ContiguousIterator1, class ContiguousIterator2, class BinaryPredicate>
+    BOOST_CXX14_CONSTEXPR
+    bool equal_same_size ( ContiguousIterator1 first1, ContiguousIterator1 last1, 
+                           ContiguousIterator2 first2, BinaryPredicate pred, boost::true_type )
+    {
+        if ( first1 == last1 || boost::algorithm::detail::is_constant_evaluated ())
+            return equal_same_size ( first1, last1, first2, pred, boost::false_type ());
+        return std::memcmp ( contiguous_bytes ( first1 ), contiguous_bytes ( first2 ),
+            ( last1 - first1 ) * sizeof ( *first1 )) == 0;
+    }
     
     template <class RandomAccessIterator1, class RandomAccessIterator2, class BinaryPredicate>
     BOOST_CXX14_CONSTEXPR
@@ -35,11 +82,8 @@ namespace detail {
         if ( std::distance ( first1, last1 ) != std::distance ( first2, last2 ))
             return false;
 
-    //  std::equal
-        for (; first1 != last1; ++first1, ++first2)
-            if (!pred(*first1, *first2))
-                return false;
-        return true;
+        return equal_same_size ( first1, last1, first2, pred,
+            typename is_bytewise_equal<RandomAccessIterator1, RandomAccessIterator2, BinaryPredicate>::type ());
     }
 
     template <class InputIterator1, class InputIterator2, class BinaryPredicate>
@@ -55,6 +99,7 @@ namespace detail {
     return first1 == last1 && first2 == last2;
     }
 }
+/// \endcond
 
 /// \fn equal ( InputIterator1 first1, InputIterator1 last1, 
 ///             InputIterator2 first2, InputIterator2 last2,
@@ -66,6 +111,9 @@ namespace detail {
 /// \param first2    The start of the second range.
 /// \param last2     One past the end of the second range.
 /// \param pred      A predicate for comparing the elements of the ranges
+///
+/// \note            Arrays of integers, enums or pointers compared with std::equal_to
+///                  are compared with memcmp (except in constant expressions).
 template <class InputIterator1, class InputIterator2, class BinaryPredicate>
 BOOST_CXX14_CONSTEXPR
 bool equal ( InputIterator1 first1, InputIterator1 last1, 
@@ -85,6 +133,9 @@ bool equal ( InputIterator1 first1, InputIterator1 last1,
 /// \param last1     One past the end of the first range.
 /// \param first2    The start of the second range.
 /// \param last2     One past the end of the second range.
+///
+/// \note            Arrays of integers, enums or pointers are compared with memcmp
+///                  (except in constant expressions).
 template <class InputIterator1, class InputIterator2>
 BOOST_CXX14_CONSTEXPR
 bool equal ( InputIterator1 first1, InputIterator1 last1, 
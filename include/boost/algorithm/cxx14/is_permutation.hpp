@@ -12,6 +12,7 @@
 #ifndef BOOST_ALGORITHM_IS_PERMUTATION14_HPP
 #define BOOST_ALGORITHM_IS_PERMUTATION14_HPP
 
+#include <cstddef>
 #include <utility>      // for std::pair
 #include <functional>   // for std::equal_to
 #include <iterator>
@@ -19,6 +20,7 @@
 #include <boost/config.hpp>
 #include <boost/algorithm/cxx11/is_permutation.hpp>
 #include <boost/algorithm/cxx14/mismatch.hpp>
+#include <boost/algorithm/detail/is_permutation.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -70,11 +72,96 @@ bool is_permutation ( ForwardIterator1 first1, ForwardIterator1 last1,
     if ( eq.first == last1 && eq.second == last2)
         return true;
     return boost::algorithm::detail::is_permutation_tag (
-        first1, last1, first2, last2, pred, 
+        eq.first, last1, eq.second, last2, pred,
         typename std::iterator_traits<ForwardIterator1>::iterator_category (),
         typename std::iterator_traits<ForwardIterator2>::iterator_category ());
 }
 
+/// \fn is_permutation ( ForwardIterator1 first, ForwardIterator1 last, 
+///                      ForwardIterator2 first2, ForwardIterator2 last2, 
+///                      BinaryPredicate p, Hash h )
+/// \brief Tests to see if the sequence [first,last) is a permutation of the sequence starting at first2,
+///     counting the elements in a hash table
+///
+/// \param first1   The start of the input sequence
+/// \param last1    One past the end of the input sequence
+/// \param first2   The start of the second sequence
+/// \param last2    One past the end of the second sequence
+/// \param pred     The predicate to compare elements with
+/// \param h        The hash function for the elements of both sequences
+///
+/// \note           Elements that are equal according to pred must have the same hash.
+///                 The check takes linear time on average, where the other versions
+///                 take quadratic time unless the elements can be counted or hashed.
+template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate, class Hash >
+bool is_permutation ( ForwardIterator1 first1, ForwardIterator1 last1,
+                      ForwardIterator2 first2, ForwardIterator2 last2, 
+                      BinaryPredicate pred, Hash h )
+{
+    std::pair<ForwardIterator1, ForwardIterator2> eq = boost::algorithm::mismatch
+        ( first1, last1, first2, last2, pred );
+    if ( eq.first == last1 || eq.second == last2 )
+        return eq.first == last1 && eq.second == last2;
+
+    const std::size_t n = std::distance ( eq.first, last1 );
+    if ( n != static_cast<std::size_t> ( std::distance ( eq.second, last2 )))
+        return false;
+    return boost::algorithm::detail::is_permutation_hash ( eq.first, last1, eq.second, last2, n, pred, h );
+}
+
+/// \fn is_permutation_ordered ( ForwardIterator1 first, ForwardIterator1 last, 
+///                              ForwardIterator2 first2, ForwardIterator2 last2, 
+///                              BinaryPredicate p, Compare comp )
+/// \brief Tests to see if the sequence [first,last) is a permutation of the sequence starting at first2,
+///     by sorting copies of both sequences
+///
+/// \param first1   The start of the input sequence
+/// \param last1    One past the end of the input sequence
+/// \param first2   The start of the second sequence
+/// \param last2    One past the end of the second sequence
+/// \param pred     The predicate to compare elements with
+/// \param comp     A strict weak ordering of the elements of both sequences
+///
+/// \note           Elements that are equal according to pred must be equivalent according
+///                 to comp; elements that are equivalent need not be equal. The check takes
+///                 O(N log N) time, plus quadratic time within each run of equivalent elements.
+template< class ForwardIterator1, class ForwardIterator2, class BinaryPredicate, class Compare >
+bool is_permutation_ordered ( ForwardIterator1 first1, ForwardIterator1 last1,
+                              ForwardIterator2 first2, ForwardIterator2 last2, 
+                              BinaryPredicate pred, Compare comp )
+{
+    std::pair<ForwardIterator1, ForwardIterator2> eq = boost::algorithm::mismatch
+        ( first1, last1, first2, last2, pred );
+    if ( eq.first == last1 || eq.second == last2 )
+        return eq.first == last1 && eq.second == last2;
+
+    if ( std::distance ( eq.first, last1 ) != std::distance ( eq.second, last2 ))
+        return false;
+    return boost::algorithm::detail::is_permutation_sort ( eq.first, last1, eq.second, last2, comp, pred );
+}
+
+/// \fn is_permutation_ordered ( ForwardIterator1 first, ForwardIterator1 last, 
+///                              ForwardIterator2 first2, ForwardIterator2 last2, 
+///                              Compare comp )
+/// \brief Tests to see if the sequence [first,last) is a permutation of the sequence starting at first2,
+///     by sorting copies of both sequences
+///
+/// \param first1   The start of the input sequence
+/// \param last1    One past the end of the input sequence
+/// \param first2   The start of the second sequence
+/// \param last2    One past the end of the second sequence
+/// \param comp     A strict weak ordering of the elements of both sequences
+///
+/// \note           Elements that are == must be equivalent according to comp.
+template< class ForwardIterator1, class ForwardIterator2, class Compare >
+bool is_permutation_ordered ( ForwardIterator1 first1, ForwardIterator1 last1,
+                              ForwardIterator2 first2, ForwardIterator2 last2, 
+                              Compare comp )
+{
+    return boost::algorithm::is_permutation_ordered ( first1, last1, first2, last2,
+        std::equal_to<typename std::iterator_traits<ForwardIterator1>::value_type> (), comp );
+}
+
 }}
 
 #endif  // BOOST_ALGORITHM_IS_PERMUTATION14_HPP
@@ -12,12 +12,70 @@
 #ifndef BOOST_ALGORITHM_MISMATCH_HPP
 #define BOOST_ALGORITHM_MISMATCH_HPP
 
+#include <cstddef>
+#include <functional>   // for std::equal_to
+#include <iterator>
 #include <utility>      // for std::pair
 
 #include <boost/config.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 
 namespace boost { namespace algorithm {
 
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+//  Whether the ranges can be compared a word at a time: contiguous arrays of
+//  the same type, whose values are equal when their bytes are, compared with ==
+    template <class Iterator1, class Iterator2, class BinaryPredicate>
+    struct is_bytewise_mismatch {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator1>::value_type>::type value_type1;
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator2>::value_type>::type value_type2;
+        typedef boost::integral_constant<bool,
+               is_contiguous_scalars<Iterator1>::value && is_contiguous_scalars<Iterator2>::value
+            && boost::is_same<value_type1, value_type2>::value
+            && is_bitwise_comparable<value_type1>::value
+            && is_equal_to<BinaryPredicate, value_type1>::value> type;
+        };
+
+//  The comparison of the versions without a predicate
+    struct not_unequal {
+        template <class T1, class T2>
+        BOOST_CONSTEXPR bool operator () ( const T1& v1, const T2& v2 ) const { return !( v1 != v2 ); }
+        };
+
+    template <class InputIterator1, class InputIterator2, class BinaryPredicate>
+    BOOST_CXX14_CONSTEXPR std::pair<InputIterator1, InputIterator2> mismatch (
+                        InputIterator1 first1, InputIterator1 last1,
+                        InputIterator2 first2, InputIterator2 last2,
+                        BinaryPredicate pred, boost::false_type )
+    {
+        for (; first1 != last1 && first2 != last2; ++first1, ++first2)
+            if ( !pred ( *first1, *first2 ))
+                break;
+        return std::pair<InputIterator1, InputIterator2>(first1, first2);
+    }
+
+    template <class ContiguousIterator1, class ContiguousIterator2, class BinaryPredicate>
+    BOOST_CXX14_CONSTEXPR std::pair<ContiguousIterator1, ContiguousIterator2> mismatch (
+                        ContiguousIterator1 first1, ContiguousIterator1 last1,
+                        ContiguousIterator2 first2, ContiguousIterator2 last2,
+                        BinaryPredicate pred, boost::true_type )
+    {
+        if ( first1 == last1 || first2 == last2 || boost::algorithm::detail::is_constant_evaluated ())
+            return boost::algorithm::detail::mismatch ( first1, last1, first2, last2, pred, boost::false_type ());
+
+        const std::size_t n = static_cast<std::size_t> ( last1 - first1 < last2 - first2 ? last1 - first1 : last2 - first2 );
+        const std::size_t i = first_difference ( contiguous_bytes ( first1 ), contiguous_bytes ( first2 ),
+                                                 n * sizeof ( *first1 )) / sizeof ( *first1 );
+        return std::pair<ContiguousIterator1, ContiguousIterator2>(first1 + i, first2 + i);
+    }
+}
+/// \endcond
+
 /// \fn mismatch ( InputIterator1 first1, InputIterator1 last1, 
 ///                InputIterator2 first2, InputIterator2 last2,
 ///                BinaryPredicate pred )
@@ -28,16 +86,17 @@ namespace boost { namespace algorithm {
 /// \param first2    The start of the second range.
 /// \param last2     One past the end of the second range.
 /// \param pred      A predicate for comparing the elements of the ranges
+///
+/// \note            Arrays of integers, enums or pointers compared with std::equal_to
+///                  are compared a word at a time (except in constant expressions).
 template <class InputIterator1, class InputIterator2, class BinaryPredicate>
 BOOST_CXX14_CONSTEXPR std::pair<InputIterator1, InputIterator2> mismatch (
                     InputIterator1 first1, InputIterator1 last1,
                     InputIterator2 first2, InputIterator2 last2,
                     BinaryPredicate pred )
 {
-    for (; first1 != last1 && first2 != last2; ++first1, ++first2)
-        if ( !pred ( *first1, *first2 ))
-            break;
-    return std::pair<InputIterator1, InputIterator2>(first1, first2);
+    return boost::algorithm::detail::mismatch ( first1, last1, first2, last2, pred,
+        typename boost::algorithm::detail::is_bytewise_mismatch<InputIterator1, InputIterator2, BinaryPredicate>::type ());
 }
 
 /// \fn mismatch ( InputIterator1 first1, InputIterator1 last1, 
@@ -48,15 +107,17 @@ BOOST_CXX14_CONSTEXPR std::pair<InputIterator1, InputIterator2> mismatch (
 /// \param last1     One past the end of the first range.
 /// \param first2    The start of the second range.
 /// \param last2     One past the end of the second range.
+///
+/// \note            Arrays of integers, enums or pointers are compared a word at a time
+///                  (except in constant expressions).
 template <class InputIterator1, class InputIterator2>
 BOOST_CXX14_CONSTEXPR std::pair<InputIterator1, InputIterator2> mismatch (
                     InputIterator1 first1, InputIterator1 last1,
                     InputIterator2 first2, InputIterator2 last2 )
 {
-    for (; first1 != last1 && first2 != last2; ++first1, ++first2)
-        if ( *first1 != *first2 )
-            break;
-    return std::pair<InputIterator1, InputIterator2>(first1, first2);
+    typedef typename std::iterator_traits<InputIterator1>::value_type value_type;
+    return boost::algorithm::detail::mismatch ( first1, last1, first2, last2, boost::algorithm::detail::not_unequal (),
+        typename boost::algorithm::detail::is_bytewise_mismatch<InputIterator1, InputIterator2, std::equal_to<value_type> >::type ());
 }
 
 //  There are already range-based versions of these.
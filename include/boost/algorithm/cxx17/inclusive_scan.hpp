@@ -19,6 +19,10 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_scan.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -56,6 +60,36 @@ OutputIterator inclusive_scan(InputIterator first, InputIterator last,
     return boost::algorithm::inclusive_scan(first, last, result, std::plus<VT>());
 }
 
+//  Execution policy versions. With execution::par, a random access range is
+//  scanned in parallel; the operation must be associative.
+
+template<class ExecutionPolicy, class InputIterator, class OutputIterator, class T, class BinaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+inclusive_scan(const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+               OutputIterator result, BinaryOperation bOp, T init)
+{
+    return detail::policy_scan<true, true>(policy, first, last, result, init,
+                                            bOp, detail::scan_identity());
+}
+
+template<class ExecutionPolicy, class InputIterator, class OutputIterator, class BinaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+inclusive_scan(const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+               OutputIterator result, BinaryOperation bOp)
+{
+    return detail::policy_inclusive_scan(policy, first, last, result,
+                                         bOp, detail::scan_identity());
+}
+
+template<class ExecutionPolicy, class InputIterator, class OutputIterator>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+inclusive_scan(const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+               OutputIterator result)
+{
+    typedef typename std::iterator_traits<InputIterator>::value_type VT;
+    return boost::algorithm::inclusive_scan(policy, first, last, result, std::plus<VT>());
+}
+
 }} // namespace boost and algorithm
 
 #endif // BOOST_ALGORITHM_INCLUSIVE_SCAN_HPP
@@ -19,16 +19,17 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_reduce.hpp>
 
 namespace boost { namespace algorithm {
 
 template<class InputIterator, class T, class BinaryOperation>
 T reduce(InputIterator first, InputIterator last, T init, BinaryOperation bOp)
 {
-    ;
-    for (; first != last; ++first)
-        init = bOp(init, *first);
-    return init;
+    return detail::sequential_reduce(first, last, init, bOp, detail::reduce_identity());
 }
 
 template<class InputIterator, class T>
@@ -68,6 +69,35 @@ T reduce(const Range &r, T init, BinaryOperation bOp)
     return boost::algorithm::reduce(boost::begin(r), boost::end(r), init, bOp);
 }
 
+//  Execution policy versions. The elements are combined in the same order
+//  (which is fixed, but not left to right) for seq and for any number of
+//  threads, so the results are reproducible.
+
+template<class ExecutionPolicy, class InputIterator, class T, class BinaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, T>::type
+reduce(const ExecutionPolicy &policy, InputIterator first, InputIterator last,
+       T init, BinaryOperation bOp)
+{
+    return detail::policy_reduce(policy, first, last, init, bOp, detail::reduce_identity());
+}
+
+template<class ExecutionPolicy, class InputIterator, class T>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, T>::type
+reduce(const ExecutionPolicy &policy, InputIterator first, InputIterator last, T init)
+{
+    typedef typename std::iterator_traits<InputIterator>::value_type VT;
+    return boost::algorithm::reduce(policy, first, last, init, std::plus<VT>());
+}
+
+template<class ExecutionPolicy, class InputIterator>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>,
+                          typename std::iterator_traits<InputIterator>::value_type>::type
+reduce(const ExecutionPolicy &policy, InputIterator first, InputIterator last)
+{
+    return boost::algorithm::reduce(policy, first, last,
+       typename std::iterator_traits<InputIterator>::value_type());
+}
+
 }} // namespace boost and algorithm
 
 #endif // BOOST_ALGORITHM_REDUCE_HPP
@@ -19,6 +19,10 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_scan.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -57,6 +61,31 @@ OutputIterator transform_exclusive_scan(InputIterator first, InputIterator last,
     return result;
 }
 
+/// \fn transform_exclusive_scan ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, OutputIterator result, T init, BinaryOperation bOp, UnaryOperation uOp )
+/// \brief As above, run according to 'policy'. With execution::par, a
+/// random access range is split into chunks that are scanned in parallel.
+/// \return The updated output iterator
+///
+/// \param policy The execution policy
+/// \param first  The start of the input sequence
+/// \param last   The end of the input sequence
+/// \param result The output iterator to write the results into
+/// \param init   The initial value
+/// \param bOp    The operation for combining transformed input elements; it must be associative
+/// \param uOp    The operation for transforming input elements
+///
+/// \note This function is part of the C++17 standard library
+template<class ExecutionPolicy, class InputIterator, class OutputIterator, class T,
+         class BinaryOperation, class UnaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+transform_exclusive_scan(const ExecutionPolicy &policy,
+                         InputIterator first, InputIterator last,
+                         OutputIterator result, T init,
+                         BinaryOperation bOp, UnaryOperation uOp)
+{
+    return detail::policy_scan<false, true>(policy, first, last, result, init, bOp, uOp);
+}
+
 }} // namespace boost and algorithm
 
 #endif // BOOST_ALGORITHM_TRANSFORM_EXCLUSIVE_SCAN_HPP
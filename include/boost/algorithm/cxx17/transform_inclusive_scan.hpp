@@ -5,12 +5,12 @@
    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 */
 
-/// \file  transform_reduce.hpp
-/// \brief Combine the (transformed) elements of a sequence (or two) into a single value.
+/// \file  transform_inclusive_scan.hpp
+/// \brief Transform and combine the elements of a sequence, writing each partial result.
 /// \author Marshall Clow
 
-#ifndef BOOST_ALGORITHM_TRANSFORM_REDUCE_HPP
-#define BOOST_ALGORITHM_TRANSFORM_REDUCE_HPP
+#ifndef BOOST_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN_HPP
+#define BOOST_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN_HPP
 
 #include <functional>     // for std::plus
 #include <iterator>       // for std::iterator_traits
@@ -19,6 +19,10 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_scan.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -84,6 +88,55 @@ OutputIterator transform_inclusive_scan(InputIterator first, InputIterator last,
 }
 
 
+/// \fn transform_inclusive_scan ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, OutputIterator result, BinaryOperation bOp, UnaryOperation uOp, T init )
+/// \brief As above, run according to 'policy'. With execution::par, a
+/// random access range is split into chunks that are scanned in parallel.
+/// \return The updated output iterator
+///
+/// \param policy The execution policy
+/// \param first  The start of the input sequence
+/// \param last   The end of the input sequence
+/// \param result The output iterator to write the results into
+/// \param bOp    The operation for combining transformed input elements; it must be associative
+/// \param uOp    The operation for transforming input elements
+/// \param init   The initial value
+///
+/// \note This function is part of the C++17 standard library
+template<class ExecutionPolicy, class InputIterator, class OutputIterator,
+         class BinaryOperation, class UnaryOperation, class T>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+transform_inclusive_scan(const ExecutionPolicy &policy,
+                         InputIterator first, InputIterator last,
+                         OutputIterator result,
+                         BinaryOperation bOp, UnaryOperation uOp,
+                         T init)
+{
+    return detail::policy_scan<true, true>(policy, first, last, result, init, bOp, uOp);
+}
+
+/// \fn transform_inclusive_scan ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, OutputIterator result, BinaryOperation bOp, UnaryOperation uOp )
+/// \brief As above, run according to 'policy'; the first value will be used as the init.
+/// \return The updated output iterator
+///
+/// \param policy The execution policy
+/// \param first  The start of the input sequence
+/// \param last   The end of the input sequence
+/// \param result The output iterator to write the results into
+/// \param bOp    The operation for combining transformed input elements; it must be associative
+/// \param uOp    The operation for transforming input elements
+///
+/// \note This function is part of the C++17 standard library
+template<class ExecutionPolicy, class InputIterator, class OutputIterator,
+         class BinaryOperation, class UnaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, OutputIterator>::type
+transform_inclusive_scan(const ExecutionPolicy &policy,
+                         InputIterator first, InputIterator last,
+                         OutputIterator result,
+                         BinaryOperation bOp, UnaryOperation uOp)
+{
+    return detail::policy_inclusive_scan(policy, first, last, result, bOp, uOp);
+}
+
 }} // namespace boost and algorithm
 
-#endif // BOOST_ALGORITHM_TRANSFORM_REDUCE_HPP
+#endif // BOOST_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN_HPP
@@ -19,6 +19,10 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_reduce.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -28,9 +32,7 @@ T transform_reduce(InputIterator1 first1, InputIterator1 last1,
                    InputIterator2 first2, T init,
                  BinaryOperation1 bOp1, BinaryOperation2 bOp2)
 {
-    for (; first1 != last1; ++first1, (void) ++first2)
-        init = bOp1(init, bOp2(*first1, *first2));
-    return init;
+    return detail::sequential_reduce2(first1, last1, first2, init, bOp1, bOp2);
 }
 
 template<class InputIterator, class T,
@@ -38,9 +40,7 @@ template<class InputIterator, class T,
 T transform_reduce(InputIterator first, InputIterator last,
                    T init, BinaryOperation bOp, UnaryOperation uOp)
 {
-    for (; first != last; ++first)
-        init = bOp(init, uOp(*first));
-    return init;
+    return detail::sequential_reduce(first, last, init, bOp, uOp);
 }
 
 template<class InputIterator1, class InputIterator2, class T>
@@ -51,6 +51,41 @@ T transform_reduce(InputIterator1 first1, InputIterator1 last1,
                             std::plus<T>(), std::multiplies<T>());
 }
 
+//  Execution policy versions. The elements are combined in the same order
+//  (which is fixed, but not left to right) for seq and for any number of
+//  threads, so the results are reproducible.
+
+template<class ExecutionPolicy, class InputIterator1, class InputIterator2, class T,
+         class BinaryOperation1, class BinaryOperation2>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, T>::type
+transform_reduce(const ExecutionPolicy &policy,
+                 InputIterator1 first1, InputIterator1 last1,
+                 InputIterator2 first2, T init,
+                 BinaryOperation1 bOp1, BinaryOperation2 bOp2)
+{
+    return detail::policy_reduce2(policy, first1, last1, first2, init, bOp1, bOp2);
+}
+
+template<class ExecutionPolicy, class InputIterator, class T,
+         class BinaryOperation, class UnaryOperation>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, T>::type
+transform_reduce(const ExecutionPolicy &policy,
+                 InputIterator first, InputIterator last,
+                 T init, BinaryOperation bOp, UnaryOperation uOp)
+{
+    return detail::policy_reduce(policy, first, last, init, bOp, uOp);
+}
+
+template<class ExecutionPolicy, class InputIterator1, class InputIterator2, class T>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, T>::type
+transform_reduce(const ExecutionPolicy &policy,
+                 InputIterator1 first1, InputIterator1 last1,
+                 InputIterator2 first2, T init)
+{
+    return boost::algorithm::transform_reduce(policy, first1, last1, first2, init,
+                            std::plus<T>(), std::multiplies<T>());
+}
+
 }} // namespace boost and algorithm
 
 #endif // BOOST_ALGORITHM_TRANSFORM_REDUCE_HPP
@@ -0,0 +1,254 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    Helpers for the versions of the algorithms that work on arrays of
+    scalars a machine word (or several) at a time.
+
+    * is_contiguous_scalars: whether an iterator walks through scalar values
+      (arithmetic values, enums and pointers) laid out next to each other in
+      memory: pointers, and the iterators of std::vector, std::string and
+      std::wstring.
+    * is_contiguous_iterator: the same, for values of any type.
+    * contiguous_pointer: the address of the element an iterator of either
+      kind refers to, const only when the iterator's elements are, so that
+      a predicate taking them by non-const reference still accepts them.
+    * is_bitwise_comparable: whether two values of a type are equal exactly
+      when their bytes are (integers, enums and pointers, but not floating
+      point values, where 0.0 == -0.0 and NaN != NaN).
+    * is_equal_to: whether a predicate is std::equal_to for a type.
+    * is_constant_evaluated: whether the call is part of the evaluation of a
+      constant expression, where the word at a time code (which reads the
+      values through unsigned char pointers) can't be used. When the
+      compiler can't tell us, the algorithms that are constexpr take their
+      element by element paths always.
+    * load_word, count_trailing_zeros, count_leading_zeros, first_byte_set,
+      last_byte_set, count_bits: reading eight bytes at once, finding the
+      first or last (in memory order) byte that is not zero in a word, and
+      counting the bits that are set.
+    * first_difference: the offset of the first byte that differs between
+      two blocks of memory.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_CONTIGUOUS_HPP
+#define BOOST_ALGORITHM_DETAIL_CONTIGUOUS_HPP
+
+#include <cstddef>
+#include <cstring>      // for std::memcpy, std::memcmp
+#include <functional>   // for std::equal_to
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_enum.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // for _BitScanForward64, _BitScanReverse64
+#endif
+
+#if defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define BOOST_ALGORITHM_HAS_IS_CONSTANT_EVALUATED
+#  endif
+#elif defined(BOOST_GCC) && BOOST_GCC >= 90000
+#  define BOOST_ALGORITHM_HAS_IS_CONSTANT_EVALUATED
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#  define BOOST_ALGORITHM_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+    BOOST_CONSTEXPR inline bool is_constant_evaluated () BOOST_NOEXCEPT {
+#if defined(BOOST_ALGORITHM_HAS_IS_CONSTANT_EVALUATED)
+        return __builtin_is_constant_evaluated ();
+#elif defined(BOOST_NO_CXX14_CONSTEXPR)
+        return false;   //  the callers are not constexpr
+#else
+        return true;    //  can't tell, so take the path that works either way
+#endif
+        }
+
+    template <typename Iterator, typename T, bool IsScalar = boost::is_scalar<T>::value>
+    struct is_contiguous_scalars_impl : public boost::false_type {};
+
+    template <typename Iterator, typename T>
+    struct is_contiguous_scalars_impl<Iterator, T, true> : public boost::integral_constant<bool,
+           boost::is_pointer<Iterator>::value
+        || ( !boost::is_same<T, bool>::value && (
+               boost::is_same<Iterator, typename std::vector<T>::iterator>::value
+            || boost::is_same<Iterator, typename std::vector<T>::const_iterator>::value ))
+        || boost::is_same<Iterator, std::string::iterator>::value
+        || boost::is_same<Iterator, std::string::const_iterator>::value
+        || boost::is_same<Iterator, std::wstring::iterator>::value
+        || boost::is_same<Iterator, std::wstring::const_iterator>::value> {};
+
+    template <typename Iterator>
+    struct is_contiguous_scalars : public is_contiguous_scalars_impl<Iterator,
+        typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type> {};
+
+    template <typename Iterator, typename T = typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type>
+    struct is_contiguous_iterator : public boost::integral_constant<bool,
+           boost::is_pointer<Iterator>::value
+        || ( !boost::is_same<T, bool>::value && (
+               boost::is_same<Iterator, typename std::vector<T>::iterator>::value
+            || boost::is_same<Iterator, typename std::vector<T>::const_iterator>::value ))
+        || boost::is_same<Iterator, std::string::iterator>::value
+        || boost::is_same<Iterator, std::string::const_iterator>::value
+        || boost::is_same<Iterator, std::wstring::iterator>::value
+        || boost::is_same<Iterator, std::wstring::const_iterator>::value> {};
+
+    template <typename T>
+    struct is_bitwise_comparable : public boost::integral_constant<bool,
+        boost::is_integral<T>::value || boost::is_enum<T>::value || boost::is_pointer<T>::value> {};
+
+    template <typename Predicate, typename T>
+    struct is_equal_to : public boost::integral_constant<bool,
+           boost::is_same<Predicate, std::equal_to<T> >::value
+        || boost::is_same<Predicate, std::equal_to<void> >::value> {};
+
+    template <typename Iterator>
+    struct contiguous_element {
+        typedef typename boost::remove_reference<typename std::iterator_traits<Iterator>::reference>::type type;
+        };
+
+    template <typename Iterator>
+    typename contiguous_element<Iterator>::type *contiguous_pointer ( Iterator it ) {
+        return &*it;
+        }
+
+//  The address of the element an iterator refers to, as a pointer to bytes
+    template <typename Iterator>
+    const unsigned char *contiguous_bytes ( Iterator it ) {
+        return reinterpret_cast<const unsigned char *> ( &*it );
+        }
+
+    inline boost::uint64_t load_word ( const unsigned char *p ) {
+        boost::uint64_t w;
+        std::memcpy ( &w, p, sizeof ( w ));
+        return w;
+        }
+
+//  For x != 0
+    inline int count_trailing_zeros ( boost::uint64_t x ) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll ( x );
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long i;
+        _BitScanForward64 ( &i, x );
+        return static_cast<int> ( i );
+#else
+        int n = 0;
+        for ( ; ( x & 1 ) == 0; x >>= 1 )
+            ++n;
+        return n;
+#endif
+        }
+
+//  For x != 0
+    inline int count_leading_zeros ( boost::uint64_t x ) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll ( x );
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long i;
+        _BitScanReverse64 ( &i, x );
+        return 63 - static_cast<int> ( i );
+#else
+        int n = 0;
+        for ( ; ( x >> 63 ) == 0; x <<= 1 )
+            ++n;
+        return n;
+#endif
+        }
+
+    inline int count_bits ( boost::uint64_t x ) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll ( x );
+#else
+        x = x - (( x >> 1 ) & 0x5555555555555555ULL );
+        x = ( x & 0x3333333333333333ULL ) + (( x >> 2 ) & 0x3333333333333333ULL );
+        x = ( x + ( x >> 4 )) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int> (( x * 0x0101010101010101ULL ) >> 56 );
+#endif
+        }
+
+//  The offset of the first byte in memory that is not zero, in a word that
+//  was loaded with load_word. For x != 0
+    inline std::size_t first_byte_set ( boost::uint64_t x ) {
+#if BOOST_ENDIAN_BIG_BYTE
+        return count_leading_zeros ( x ) / 8;
+#else
+        return count_trailing_zeros ( x ) / 8;
+#endif
+        }
+
+//  ... and the offset of the last. For x != 0
+    inline std::size_t last_byte_set ( boost::uint64_t x ) {
+#if BOOST_ENDIAN_BIG_BYTE
+        return 7 - count_trailing_zeros ( x ) / 8;
+#else
+        return 7 - count_leading_zeros ( x ) / 8;
+#endif
+        }
+
+//  The offset of the first byte where a and b differ, or n if they don't.
+//  Thirty two bytes are compared for each test and branch. The loops count
+//  down the bytes that are left rather than up to n, so that the compiler
+//  can see that no word is read past the end.
+    inline std::size_t first_difference_words ( const unsigned char *a, const unsigned char *b, std::size_t n ) {
+        const unsigned char *const start = a;
+        for ( ; n >= 32; a += 32, b += 32, n -= 32 ) {
+            const boost::uint64_t x0 = load_word ( a      ) ^ load_word ( b      );
+            const boost::uint64_t x1 = load_word ( a +  8 ) ^ load_word ( b +  8 );
+            const boost::uint64_t x2 = load_word ( a + 16 ) ^ load_word ( b + 16 );
+            const boost::uint64_t x3 = load_word ( a + 24 ) ^ load_word ( b + 24 );
+            if (( x0 | x1 | x2 | x3 ) != 0 ) {
+                const std::size_t i = static_cast<std::size_t> ( a - start );
+                if ( x0 != 0 ) return i +      first_byte_set ( x0 );
+                if ( x1 != 0 ) return i +  8 + first_byte_set ( x1 );
+                if ( x2 != 0 ) return i + 16 + first_byte_set ( x2 );
+                return i + 24 + first_byte_set ( x3 );
+                }
+            }
+        for ( ; n >= 8; a += 8, b += 8, n -= 8 ) {
+            const boost::uint64_t x = load_word ( a ) ^ load_word ( b );
+            if ( x != 0 )
+                return static_cast<std::size_t> ( a - start ) + first_byte_set ( x );
+            }
+        for ( ; n > 0; ++a, ++b, --n )
+            if ( *a != *b )
+                break;
+        return static_cast<std::size_t> ( a - start );
+        }
+
+//  Long runs of equal bytes are skipped with memcmp (which the C library
+//  vectorizes), a block at a time, and the difference is then found in the block.
+    inline std::size_t first_difference ( const unsigned char *a, const unsigned char *b, std::size_t n ) {
+        const std::size_t block = 256;
+        const unsigned char *const start = a;
+        for ( ; n >= block; a += block, b += block, n -= block )
+            if ( std::memcmp ( a, b, block ) != 0 )
+                return static_cast<std::size_t> ( a - start ) + first_difference_words ( a, b, block );
+        return static_cast<std::size_t> ( a - start ) + first_difference_words ( a, b, n );
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_CONTIGUOUS_HPP
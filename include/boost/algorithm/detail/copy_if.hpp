@@ -0,0 +1,198 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind the faster versions of copy_if and partition_copy,
+    for arrays of numbers (and pointers).
+
+    The element by element loops branch on the result of the predicate,
+    and when the results are mixed most of those branches are mispredicted.
+    Instead, each element of a block of 256 is written to a buffer on the
+    stack, and the position in the buffer is advanced by the result of the
+    predicate; there is nothing to mispredict. The buffer is then copied to
+    the output in one go. Writing to the buffer rather than to the output
+    means that nothing is ever written past the last element the output
+    receives, so the output can be any output iterator.
+
+    When (nearly) every element of a block went the same way, the branches
+    will be predicted well, and the next block is done with the element by
+    element loop, which is then faster.
+
+    If the predicate throws, the elements of the block that were picked
+    before it are copied out of the buffer first, so the output receives
+    just what the element by element loop would have written.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_COPY_IF_HPP
+#define BOOST_ALGORITHM_DETAIL_COPY_IF_HPP
+
+#include <algorithm>    // for std::copy
+#include <cstddef>      // for std::size_t
+#include <utility>      // for std::pair
+
+#include <boost/config.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/detail/contiguous.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  Number of elements in a block
+    const std::size_t copy_if_block = 256;
+
+//  Whether a block where 'count' of 'n' elements were picked suggests that
+//  the branches are predictable
+    inline bool copy_if_predictable ( std::size_t count, std::size_t n ) {
+        return count < n / 32 || count > n - n / 32;
+        }
+
+//  The predicate is applied to the elements of the array themselves (the
+//  parallel versions rely on that), in order, before they are copied. T is
+//  const unless the caller's iterators allow changes.
+    template <typename T, typename OutputIterator, typename Predicate>
+    OutputIterator copy_if_blocks ( T *first, T *last, OutputIterator result, Predicate p ) {
+        typename boost::remove_cv<T>::type buffer [ copy_if_block ];
+        bool branch = false;
+
+        while ( first != last ) {
+            const std::size_t n = static_cast<std::size_t> ( last - first ) < copy_if_block
+                ? static_cast<std::size_t> ( last - first ) : copy_if_block;
+            std::size_t count = 0;
+            if ( branch ) {
+                for ( std::size_t i = 0; i < n; ++i )
+                    if ( p ( first [ i ] )) {
+                        *result++ = first [ i ];
+                        ++count;
+                        }
+                }
+            else {
+                BOOST_TRY {
+                    for ( std::size_t i = 0; i < n; ++i ) {
+                        const bool picked = static_cast<bool> ( p ( first [ i ] ));
+                        buffer [ count ] = first [ i ];
+                        count += picked;
+                        }
+                    }
+                BOOST_CATCH ( ... ) {
+                    std::copy ( buffer, buffer + count, result );
+                    BOOST_RETHROW
+                    }
+                BOOST_CATCH_END
+                result = std::copy ( buffer, buffer + count, result );
+                }
+            branch = copy_if_predictable ( count, n );
+            first += n;
+            }
+        return result;
+        }
+
+    template <typename T, typename OutputIterator1, typename OutputIterator2, typename Predicate>
+    std::pair<OutputIterator1, OutputIterator2>
+    partition_copy_blocks ( T *first, T *last,
+                            OutputIterator1 out_true, OutputIterator2 out_false, Predicate p ) {
+        typename boost::remove_cv<T>::type buffer_true [ copy_if_block ];
+        typename boost::remove_cv<T>::type buffer_false [ copy_if_block ];
+        bool branch = false;
+
+        while ( first != last ) {
+            const std::size_t n = static_cast<std::size_t> ( last - first ) < copy_if_block
+                ? static_cast<std::size_t> ( last - first ) : copy_if_block;
+            std::size_t t = 0;
+            if ( branch ) {
+                for ( std::size_t i = 0; i < n; ++i )
+                    if ( p ( first [ i ] )) {
+                        *out_true++ = first [ i ];
+                        ++t;
+                        }
+                    else
+                        *out_false++ = first [ i ];
+                }
+            else {
+                std::size_t f = 0;
+                BOOST_TRY {
+                    for ( std::size_t i = 0; i < n; ++i ) {
+                        const bool picked = static_cast<bool> ( p ( first [ i ] ));
+                        buffer_true  [ t ] = first [ i ];
+                        buffer_false [ f ] = first [ i ];
+                        t += picked;
+                        f += !picked;
+                        }
+                    }
+                BOOST_CATCH ( ... ) {
+                    std::copy ( buffer_true,  buffer_true  + t, out_true );
+                    std::copy ( buffer_false, buffer_false + f, out_false );
+                    BOOST_RETHROW
+                    }
+                BOOST_CATCH_END
+                out_true  = std::copy ( buffer_true,  buffer_true  + t, out_true );
+                out_false = std::copy ( buffer_false, buffer_false + f, out_false );
+                }
+            branch = copy_if_predictable ( t, n );
+            first += n;
+            }
+        return std::pair<OutputIterator1, OutputIterator2> ( out_true, out_false );
+        }
+
+//  Whether [first, last) can be handed to the block functions
+    template <typename Iterator>
+    struct is_copy_blockwise {
+        typedef boost::integral_constant<bool, is_contiguous_scalars<Iterator>::value> type;
+        };
+
+    template <typename InputIterator, typename OutputIterator, typename Predicate>
+    BOOST_CXX14_CONSTEXPR OutputIterator
+    copy_if ( InputIterator first, InputIterator last, OutputIterator result, Predicate p, boost::false_type )
+    {
+        for ( ; first != last; ++first )
+            if (p(*first))
+                *result++ = *first;
+        return result;
+    }
+
+    template <typename ContiguousIterator, typename OutputIterator, typename Predicate>
+    BOOST_CXX14_CONSTEXPR OutputIterator
+    copy_if ( ContiguousIterator first, ContiguousIterator last, OutputIterator result, Predicate p, boost::true_type )
+    {
+        if ( first == last || is_constant_evaluated ())
+            return detail::copy_if ( first, last, result, p, boost::false_type ());
+        typename contiguous_element<ContiguousIterator>::type *ptr = contiguous_pointer ( first );
+        return detail::copy_if_blocks ( ptr, ptr + ( last - first ), result, p );
+    }
+
+    template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR std::pair<OutputIterator1, OutputIterator2>
+    partition_copy ( InputIterator first, InputIterator last,
+                     OutputIterator1 out_true, OutputIterator2 out_false, UnaryPredicate p, boost::false_type )
+    {
+        for ( ; first != last; ++first )
+            if ( p (*first))
+                *out_true++ = *first;
+            else
+                *out_false++ = *first;
+        return std::pair<OutputIterator1, OutputIterator2> ( out_true, out_false );
+    }
+
+    template <typename ContiguousIterator, typename OutputIterator1, typename OutputIterator2, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR std::pair<OutputIterator1, OutputIterator2>
+    partition_copy ( ContiguousIterator first, ContiguousIterator last,
+                     OutputIterator1 out_true, OutputIterator2 out_false, UnaryPredicate p, boost::true_type )
+    {
+        if ( first == last || is_constant_evaluated ())
+            return detail::partition_copy ( first, last, out_true, out_false, p, boost::false_type ());
+        typename contiguous_element<ContiguousIterator>::type *ptr = contiguous_pointer ( first );
+        return detail::partition_copy_blocks ( ptr, ptr + ( last - first ), out_true, out_false, p );
+    }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_COPY_IF_HPP
@@ -0,0 +1,276 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    Searching arrays of 1, 2, 4 or 8 byte integers (and of IEEE floats and
+    doubles) for the first or last element that is (or is not) equal to a
+    value, and counting the elements that are, eight bytes at a time.
+
+    Each word of the array is xor-ed with the value repeated across a word,
+    which leaves zero in exactly the lanes (elements) that are equal to it.
+    The lanes that are not zero are the word itself; the lanes that are
+    zero are found with
+
+        ~((( w & low_bits ) + low_bits ) | w | low_bits )
+
+    (where low_bits has all the bits of each lane set but the top one),
+    which sets the top bit of the lanes of w that are zero, and no others.
+    Then the first or last lane found is at the first or last byte set,
+    and the number of lanes found is the number of bits set.
+
+    A float or double is equal to a value that is neither zero nor NaN
+    exactly when its bits are the same. NaN is equal to nothing, and
+    0.0 == -0.0, so zero is looked for with the sign bit of each lane
+    masked off.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_FIND_VALUE_HPP
+#define BOOST_ALGORITHM_DETAIL_FIND_VALUE_HPP
+
+#include <cstddef>
+#include <cstring>      // for std::memcpy
+#include <iterator>
+#include <limits>       // for std::numeric_limits
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/type_traits/common_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+    template <typename T, bool Integral = boost::is_integral<T>::value && !boost::is_same<T, bool>::value>
+    struct is_word_lane : public boost::false_type {};
+
+    template <typename T>
+    struct is_word_lane<T, true> : public boost::integral_constant<bool,
+        sizeof ( T ) == 1 || sizeof ( T ) == 2 || sizeof ( T ) == 4 || sizeof ( T ) == 8> {};
+
+//  Whether [first, last) can be searched for x (compared with ==) a word at
+//  a time: a contiguous array of integers, and an integer to look for
+    template <typename Iterator, typename T>
+    struct is_word_searchable {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        typedef typename boost::remove_cv<T>::type key_type;
+        typedef boost::integral_constant<bool,
+               is_contiguous_scalars<Iterator>::value
+            && is_word_lane<value_type>::value
+            && boost::is_integral<key_type>::value && !boost::is_same<key_type, bool>::value> type;
+        };
+
+    template <typename T, bool Float = boost::is_floating_point<T>::value>
+    struct is_float_lane : public boost::false_type {};
+
+    template <typename T>
+    struct is_float_lane<T, true> : public boost::integral_constant<bool,
+        std::numeric_limits<T>::is_iec559 && ( sizeof ( T ) == 4 || sizeof ( T ) == 8 )> {};
+
+//  Whether [first, last) can be searched for (or counted for) x a word at a
+//  time: a contiguous array of integers and an integer to look for, or a
+//  contiguous array of floats or doubles and any number to look for
+    template <typename Iterator, typename T>
+    struct is_value_searchable {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        typedef typename boost::remove_cv<T>::type key_type;
+        typedef boost::integral_constant<bool,
+            is_word_searchable<Iterator, T>::type::value || (
+               is_contiguous_scalars<Iterator>::value
+            && is_float_lane<value_type>::value
+            && boost::is_arithmetic<key_type>::value && !boost::is_same<key_type, bool>::value )> type;
+        };
+
+//  Whether x, converted to the element type V, still compares equal to x.
+//  If it doesn't, no element of type V compares equal to x; if it does, the
+//  elements that compare equal to x are those that are equal to V ( x ).
+    template <typename V, typename T>
+    BOOST_CXX14_CONSTEXPR bool is_lane_value ( const T &x ) {
+        typedef typename boost::common_type<V, T>::type common;
+        return static_cast<common> ( static_cast<V> ( x )) == static_cast<common> ( x );
+        }
+
+    template <std::size_t Size>
+    struct lane_bits {
+        static const boost::uint64_t lane_max = Size == 8 ? ~boost::uint64_t ( 0 )
+                                                          : ( boost::uint64_t ( 1 ) << ( 8 * ( Size % 8 ))) - 1;
+        static const boost::uint64_t ones     = ~boost::uint64_t ( 0 ) / lane_max;      //  1 in each lane
+        static const boost::uint64_t low_bits = ones * ( lane_max >> 1 );
+
+    //  The top bit of each lane of w that is zero
+        static boost::uint64_t zero_lanes ( boost::uint64_t w ) {
+            return ~((( w & low_bits ) + low_bits ) | w | low_bits );
+            }
+        };
+
+//  The word of lanes equal to v
+    template <typename V>
+    boost::uint64_t repeat_lane ( V v ) {
+        boost::uint64_t bits = 0;
+        std::memcpy ( &bits, &v, sizeof ( V ));
+#if BOOST_ENDIAN_BIG_BYTE
+        bits >>= 64 - 8 * sizeof ( V );
+#endif
+        return bits * lane_bits<sizeof ( V )>::ones;
+        }
+
+//  The bits of each lane that decide whether it is equal to v: all of them,
+//  but for the sign bit when looking for a floating point zero
+    template <typename V>
+    boost::uint64_t lane_keep ( V, boost::false_type ) {
+        return ~boost::uint64_t ( 0 );
+        }
+
+    template <typename V>
+    boost::uint64_t lane_keep ( V v, boost::true_type ) {
+        return v == V ( 0 ) ? ~repeat_lane ( V ( -0.0 )) : ~boost::uint64_t ( 0 );
+        }
+
+    template <typename V>
+    boost::uint64_t lane_keep ( V v ) {
+        return lane_keep ( v, boost::is_floating_point<V> ());
+        }
+
+//  Nonzero in the lanes (elements) of w that are the ones looked for: those
+//  equal to the value for Equal, and those that are not otherwise.
+    template <bool Equal, std::size_t Size>
+    inline boost::uint64_t found_lanes ( boost::uint64_t w, boost::uint64_t pattern, boost::uint64_t keep ) {
+        w = ( w & keep ) ^ pattern;
+        return Equal ? lane_bits<Size>::zero_lanes ( w ) : w;
+        }
+
+//  The first element of [first, last) that is equal to v (or not, for
+//  !Equal), or last
+    template <bool Equal, typename V>
+    const V *find_value_forward ( const V *first, const V *last, V v ) {
+        const std::size_t size = sizeof ( V );
+        const unsigned char *p = reinterpret_cast<const unsigned char *> ( first );
+        const std::size_t n = ( last - first ) * size;
+        const boost::uint64_t keep = lane_keep ( v );
+        const boost::uint64_t pattern = repeat_lane ( v ) & keep;
+
+        std::size_t i = 0;
+        for ( ; i + 32 <= n; i += 32 ) {
+            const boost::uint64_t m0 = found_lanes<Equal, size> ( load_word ( p + i      ), pattern, keep );
+            const boost::uint64_t m1 = found_lanes<Equal, size> ( load_word ( p + i +  8 ), pattern, keep );
+            const boost::uint64_t m2 = found_lanes<Equal, size> ( load_word ( p + i + 16 ), pattern, keep );
+            const boost::uint64_t m3 = found_lanes<Equal, size> ( load_word ( p + i + 24 ), pattern, keep );
+            if (( m0 | m1 | m2 | m3 ) != 0 ) {
+                if ( m0 != 0 ) return first + ( i +      first_byte_set ( m0 )) / size;
+                if ( m1 != 0 ) return first + ( i +  8 + first_byte_set ( m1 )) / size;
+                if ( m2 != 0 ) return first + ( i + 16 + first_byte_set ( m2 )) / size;
+                return first + ( i + 24 + first_byte_set ( m3 )) / size;
+                }
+            }
+        for ( ; i + 8 <= n; i += 8 ) {
+            const boost::uint64_t m = found_lanes<Equal, size> ( load_word ( p + i ), pattern, keep );
+            if ( m != 0 )
+                return first + ( i + first_byte_set ( m )) / size;
+            }
+        for ( first += i / size; first != last; ++first )
+            if (( *first == v ) == Equal )
+                return first;
+        return last;
+        }
+
+//  The last element of [first, last) that is equal to v (or not, for
+//  !Equal), or last
+    template <bool Equal, typename V>
+    const V *find_value_backward ( const V *first, const V *last, V v ) {
+        const std::size_t size = sizeof ( V );
+        const unsigned char *p = reinterpret_cast<const unsigned char *> ( first );
+        const boost::uint64_t keep = lane_keep ( v );
+        const boost::uint64_t pattern = repeat_lane ( v ) & keep;
+
+        std::size_t i = ( last - first ) * size;
+        for ( ; i >= 32; i -= 32 ) {
+            const boost::uint64_t m0 = found_lanes<Equal, size> ( load_word ( p + i - 32 ), pattern, keep );
+            const boost::uint64_t m1 = found_lanes<Equal, size> ( load_word ( p + i - 24 ), pattern, keep );
+            const boost::uint64_t m2 = found_lanes<Equal, size> ( load_word ( p + i - 16 ), pattern, keep );
+            const boost::uint64_t m3 = found_lanes<Equal, size> ( load_word ( p + i -  8 ), pattern, keep );
+            if (( m0 | m1 | m2 | m3 ) != 0 ) {
+                if ( m3 != 0 ) return first + ( i -  8 + last_byte_set ( m3 )) / size;
+                if ( m2 != 0 ) return first + ( i - 16 + last_byte_set ( m2 )) / size;
+                if ( m1 != 0 ) return first + ( i - 24 + last_byte_set ( m1 )) / size;
+                return first + ( i - 32 + last_byte_set ( m0 )) / size;
+                }
+            }
+        for ( ; i >= 8; i -= 8 ) {
+            const boost::uint64_t m = found_lanes<Equal, size> ( load_word ( p + i - 8 ), pattern, keep );
+            if ( m != 0 )
+                return first + ( i - 8 + last_byte_set ( m )) / size;
+            }
+        for ( const V *it = first + i / size; it != first; )
+            if (( *--it == v ) == Equal )
+                return it;
+        return last;
+        }
+
+//  The number of elements of [first, last) equal to v, counting no further
+//  than limit. Most blocks of thirty two bytes hold no match, so the lanes
+//  found are only counted in those that do.
+    template <typename V>
+    std::size_t count_value_up_to ( const V *first, const V *last, V v, std::size_t limit ) {
+        const std::size_t size = sizeof ( V );
+        const unsigned char *p = reinterpret_cast<const unsigned char *> ( first );
+        const std::size_t n = ( last - first ) * size;
+        const boost::uint64_t keep = lane_keep ( v );
+        const boost::uint64_t pattern = repeat_lane ( v ) & keep;
+
+        std::size_t count = 0;
+        std::size_t i = 0;
+        for ( ; i + 32 <= n; i += 32 ) {
+            const boost::uint64_t m0 = found_lanes<true, size> ( load_word ( p + i      ), pattern, keep );
+            const boost::uint64_t m1 = found_lanes<true, size> ( load_word ( p + i +  8 ), pattern, keep );
+            const boost::uint64_t m2 = found_lanes<true, size> ( load_word ( p + i + 16 ), pattern, keep );
+            const boost::uint64_t m3 = found_lanes<true, size> ( load_word ( p + i + 24 ), pattern, keep );
+            if (( m0 | m1 | m2 | m3 ) != 0 ) {
+                count += count_bits ( m0 ) + count_bits ( m1 ) + count_bits ( m2 ) + count_bits ( m3 );
+                if ( count >= limit )
+                    return limit;
+                }
+            }
+        for ( ; i + 8 <= n; i += 8 )
+            count += count_bits ( found_lanes<true, size> ( load_word ( p + i ), pattern, keep ));
+        for ( first += i / size; first != last; ++first )
+            if ( *first == v )
+                ++count;
+        return count < limit ? count : limit;
+        }
+
+//  The same, for the iterators of a non-empty range that is_value_searchable,
+//  and a number x. A NaN fails is_lane_value, so it is never looked for by
+//  its bits.
+    template <bool Equal, typename Iterator, typename T>
+    Iterator find_value_in ( Iterator first, Iterator last, const T &x ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        if ( !is_lane_value<value_type> ( x ))
+            return Equal ? last : first;
+        const value_type *p = &*first;
+        return first + ( find_value_forward<Equal> ( p, p + ( last - first ), static_cast<value_type> ( x )) - p );
+        }
+
+    template <typename Iterator, typename T>
+    std::size_t count_value_in ( Iterator first, Iterator last, const T &x, std::size_t limit ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        if ( !is_lane_value<value_type> ( x ))
+            return 0;
+        const value_type *p = &*first;
+        return count_value_up_to ( p, p + ( last - first ), static_cast<value_type> ( x ), limit );
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_FIND_VALUE_HPP
@@ -0,0 +1,274 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind the faster versions of iota and iota_n.
+
+    When the values are numbers, the i'th one is value + i * step, and can
+    be computed without the ones before it. For integers that is always
+    so (the terms are computed in an unsigned type, so they wrap around
+    the way repeated increments do). For floating point values it is so
+    when value and step are whole numbers and every term is small enough
+    to be represented exactly, so that repeated additions never round;
+    otherwise the element by element loop is used.
+
+    Arrays of numbers are then filled by a loop without a dependency from
+    one element to the next, which compilers turn into vector stores of
+    value + { 0, 1, 2, ... } * step, and the execution policy versions
+    give each thread a chunk of the sequence with its first term computed
+    directly.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_IOTA_HPP
+#define BOOST_ALGORITHM_DETAIL_IOTA_HPP
+
+#include <cmath>        // for std::floor, std::fabs, std::ldexp
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::iterator_traits
+#include <limits>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  The values whose terms can be computed directly
+    template <typename T>
+    struct is_iota_number : public boost::integral_constant<bool,
+        boost::is_arithmetic<T>::value && !boost::is_same<T, bool>::value> {};
+
+//  Whether [first, last) can be filled with iota_terms
+    template <typename Iterator, typename T>
+    struct is_iota_blockwise {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        typedef boost::integral_constant<bool,
+               is_contiguous_scalars<Iterator>::value
+            && boost::is_arithmetic<value_type>::value
+            && is_iota_number<T>::value> type;
+        };
+
+//  The unsigned type the terms of an integer sequence are computed in; at
+//  least as wide as unsigned, so that nothing is promoted to int
+    template <typename T>
+    struct iota_unsigned {
+        typedef typename boost::conditional<( sizeof ( T ) <= sizeof ( unsigned )),
+            unsigned, typename boost::make_unsigned<T>::type>::type type;
+        };
+
+//  value + i * step
+    template <typename T, typename Index>
+    T iota_term ( T value, Index i, T step, boost::true_type /* integral */ ) {
+        typedef typename iota_unsigned<T>::type unsigned_type;
+        return static_cast<T> ( static_cast<unsigned_type> (
+            static_cast<unsigned_type> ( value ) + static_cast<unsigned_type> ( i ) * static_cast<unsigned_type> ( step )));
+        }
+
+    template <typename T, typename Index>
+    T iota_term ( T value, Index i, T step, boost::false_type /* integral */ ) {
+        return value + static_cast<T> ( i ) * step;
+        }
+
+//  Whether the n terms starting at value are what repeated additions of
+//  step give
+    template <typename T>
+    bool iota_computable ( T, T, std::size_t, boost::true_type /* integral */ ) {
+        return true;
+        }
+
+    template <typename T>
+    bool iota_computable ( T value, T step, std::size_t n, boost::false_type /* integral */ ) {
+        using std::floor;
+        using std::fabs;
+    //  Every whole number up to 2^digits is exact
+        const T limit = std::ldexp ( static_cast<T> ( 1 ), std::numeric_limits<T>::digits );
+        return value == floor ( value ) && step == floor ( step )
+            && fabs ( value ) <= limit && fabs ( step ) <= limit && static_cast<T> ( n ) <= limit
+            && fabs ( step ) * static_cast<T> ( n ) < limit - fabs ( value );
+        }
+
+    template <typename T>
+    bool iota_computable ( T value, T step, std::size_t n ) {
+        return detail::iota_computable ( value, step, n, typename boost::is_integral<T>::type ());
+        }
+
+//  Writes the n terms starting at value to first. The index within a block
+//  is a 32 bit integer, which vector units convert to floating point, and
+//  whole blocks have a fixed length, which compilers vectorize more readily.
+    template <typename RandomIterator, typename T>
+    void iota_terms ( RandomIterator first, std::size_t n, T value, T step ) {
+        typedef typename std::iterator_traits<RandomIterator>::value_type value_type;
+        typedef typename boost::is_integral<T>::type integral;
+        const boost::int32_t block = 1024;
+        while ( n >= static_cast<std::size_t> ( block )) {
+            for ( boost::int32_t i = 0; i < block; ++i )
+                first [ i ] = static_cast<value_type> ( detail::iota_term ( value, i, step, integral ()));
+            n -= block;
+            if ( n == 0 )
+                return;
+            first += block;
+            value = detail::iota_term ( value, block, step, integral ());
+            }
+        for ( boost::int32_t i = 0; i < static_cast<boost::int32_t> ( n ); ++i )
+            first [ i ] = static_cast<value_type> ( detail::iota_term ( value, i, step, integral ()));
+        }
+
+    template <typename ContiguousIterator, typename T>
+    void iota_terms_contiguous ( ContiguousIterator first, std::size_t n, T value, T step, boost::true_type ) {
+        if ( n != 0 )
+            detail::iota_terms ( &*first, n, value, step );
+        }
+
+    template <typename RandomIterator, typename T>
+    void iota_terms_contiguous ( RandomIterator first, std::size_t n, T value, T step, boost::false_type ) {
+        detail::iota_terms ( first, n, value, step );
+        }
+
+    template <typename ForwardIterator, typename T>
+    BOOST_CXX14_CONSTEXPR void iota ( ForwardIterator first, ForwardIterator last, T value, boost::false_type )
+    {
+        for ( ; first != last; ++first, ++value )
+            *first = value;
+    }
+
+    template <typename ContiguousIterator, typename T>
+    BOOST_CXX14_CONSTEXPR void iota ( ContiguousIterator first, ContiguousIterator last, T value, boost::true_type )
+    {
+        if ( first == last || is_constant_evaluated ()
+          || !detail::iota_computable ( value, static_cast<T> ( 1 ), static_cast<std::size_t> ( last - first )))
+            return detail::iota ( first, last, value, boost::false_type ());
+        detail::iota_terms ( &*first, static_cast<std::size_t> ( last - first ), value, static_cast<T> ( 1 ));
+    }
+
+    template <typename OutputIterator, typename T>
+    BOOST_CXX14_CONSTEXPR OutputIterator iota_n ( OutputIterator out, T value, std::size_t n, boost::false_type )
+    {
+        for ( ; n > 0; --n, ++value )
+            *out++ = value;
+        return out;
+    }
+
+    template <typename ContiguousIterator, typename T>
+    BOOST_CXX14_CONSTEXPR ContiguousIterator iota_n ( ContiguousIterator out, T value, std::size_t n, boost::true_type )
+    {
+        if ( n == 0 || is_constant_evaluated () || !detail::iota_computable ( value, static_cast<T> ( 1 ), n ))
+            return detail::iota_n ( out, value, n, boost::false_type ());
+        detail::iota_terms ( &*out, n, value, static_cast<T> ( 1 ));
+        return out + n;
+    }
+
+    template <typename ForwardIterator, typename T>
+    BOOST_CXX14_CONSTEXPR void iota_step ( ForwardIterator first, ForwardIterator last, T value, T step, boost::false_type )
+    {
+        for ( ; first != last; ++first, value += step )
+            *first = value;
+    }
+
+    template <typename ContiguousIterator, typename T>
+    BOOST_CXX14_CONSTEXPR void iota_step ( ContiguousIterator first, ContiguousIterator last, T value, T step, boost::true_type )
+    {
+        if ( first == last || is_constant_evaluated ()
+          || !detail::iota_computable ( value, step, static_cast<std::size_t> ( last - first )))
+            return detail::iota_step ( first, last, value, step, boost::false_type ());
+        detail::iota_terms ( &*first, static_cast<std::size_t> ( last - first ), value, step );
+    }
+
+    template <typename ForwardIterator, typename T>
+    BOOST_CXX14_CONSTEXPR void iota_step ( ForwardIterator first, ForwardIterator last, T value, T step )
+    {
+        detail::iota_step ( first, last, value, step, typename is_iota_blockwise<ForwardIterator, T>::type ());
+    }
+
+//  Minimum number of elements in a chunk
+    const std::size_t iota_grain = 1 << 16;
+
+//  Chunk 'i' writes its terms, starting with the one for its first element
+    template <typename RandomIterator, typename T>
+    struct iota_chunk {
+        iota_chunk ( RandomIterator first, std::size_t n, std::size_t chunks, T value, T step )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), value_ ( value ), step_ ( step ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t b = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t e = chunk_offset ( i + 1, chunks_, n_ );
+            detail::iota_terms_contiguous ( first_ + b, e - b,
+                detail::iota_term ( value_, b, step_, typename boost::is_integral<T>::type ()), step_,
+                typename is_contiguous_scalars<RandomIterator>::type ());
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        T value_, step_;
+        };
+
+    template <typename ForwardIterator, typename T>
+    void policy_iota ( const execution::sequenced_policy &, ForwardIterator first, ForwardIterator last, T value, T step )
+    {
+        detail::iota_step ( first, last, value, step );
+    }
+
+    template <typename ForwardIterator, typename T>
+    void parallel_iota ( const execution::parallel_policy &, ForwardIterator first, ForwardIterator last, T value, T step,
+                         boost::false_type )
+    {
+        detail::iota_step ( first, last, value, step );
+    }
+
+    template <typename RandomIterator, typename T>
+    void parallel_iota ( const execution::parallel_policy &policy, RandomIterator first, RandomIterator last, T value, T step,
+                         boost::true_type )
+    {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t chunks = parallel_chunk_count ( policy, n, iota_grain );
+        if ( chunks <= 1 || !detail::iota_computable ( value, step, n ))
+            return detail::iota_step ( first, last, value, step );
+        parallel_run ( chunks, iota_chunk<RandomIterator, T> ( first, n, chunks, value, step ));
+    }
+
+//  Only sequences of numbers can be split; the others are filled one
+//  element at a time
+    template <typename ForwardIterator, typename T>
+    void policy_iota ( const execution::parallel_policy &policy, ForwardIterator first, ForwardIterator last, T value, T step )
+    {
+        typedef boost::integral_constant<bool,
+               boost::is_convertible<
+                   typename std::iterator_traits<ForwardIterator>::iterator_category,
+                   std::random_access_iterator_tag>::value
+            && is_iota_number<T>::value> splittable;
+        detail::parallel_iota ( policy, first, last, value, step, splittable ());
+    }
+
+    template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+    void policy_iota ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, T value, boost::true_type /* number */ )
+    {
+        detail::policy_iota ( policy, first, last, value, static_cast<T> ( 1 ));
+    }
+
+    template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+    void policy_iota ( const ExecutionPolicy &, ForwardIterator first, ForwardIterator last, T value, boost::false_type /* number */ )
+    {
+        detail::iota ( first, last, value, boost::false_type ());
+    }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_IOTA_HPP
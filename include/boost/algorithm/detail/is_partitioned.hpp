@@ -0,0 +1,257 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind is_partitioned and is_partitioned_until.
+
+    Arrays of numbers are tested a block of 256 bytes at a time (numbers of
+    eight bytes only where the vector units compare them): the results of
+    the predicate for the block are stored in a buffer and and-ed (while
+    looking for the first element that does not satisfy the predicate) or
+    or-ed (while looking for one that does, after that) together, in a loop
+    without branches that compilers turn into vector compares when the
+    predicate compares each number with a threshold.
+    Only the block where the answer changes is searched one element at a
+    time, in the buffer, so the predicate is still applied to each element
+    at most once.
+
+    The execution policy versions split the sequence into chunks. Each
+    chunk records its first element that does not satisfy the predicate
+    and its first element after that one which does; going through the
+    chunks in order then finds the first element out of place.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_IS_PARTITIONED_HPP
+#define BOOST_ALGORITHM_DETAIL_IS_PARTITIONED_HPP
+
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::iterator_traits
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/is_sorted.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  The first element of [first, last) that satisfies p after one that
+//  doesn't, or last. first_false is set to the first element that doesn't
+//  satisfy p, or last. T is const unless the caller's iterators allow changes.
+    template <typename T, typename Pred>
+    T *partitioned_until_blocks ( T *first, T *last, Pred p, T *&first_false ) {
+        const std::size_t block = 256 / sizeof ( T );
+        unsigned char picked [ block ];
+        std::size_t n;      // picked holds the results for [first, first + n)
+
+        first_false = last;
+    //  The part that satisfies p: whole blocks (which compilers vectorize),
+    //  then what is left
+        for ( ;; ) {
+            n = static_cast<std::size_t> ( last - first );
+            if ( n >= block ) {
+                unsigned char all = 1;
+                for ( std::size_t i = 0; i < block; ++i ) {
+                    picked [ i ] = static_cast<bool> ( p ( first [ i ] ));
+                    all &= picked [ i ];
+                    }
+                n = block;
+                if ( all != 0 ) {
+                    first += block;
+                    continue;
+                    }
+                }
+            else
+                for ( std::size_t i = 0; i < n; ++i )
+                    picked [ i ] = static_cast<bool> ( p ( first [ i ] ));
+            break;
+            }
+
+        std::size_t i = 0;
+        while ( i < n && picked [ i ] )
+            ++i;
+        if ( i == n )
+            return last;
+        first_false = first + i;
+        for ( ++i; i < n; ++i )
+            if ( picked [ i ] )
+                return first + i;
+        first += n;
+
+    //  The part that doesn't
+        for ( ;; ) {
+            n = static_cast<std::size_t> ( last - first );
+            if ( n >= block ) {
+                unsigned char any = 0;
+                for ( std::size_t i = 0; i < block; ++i ) {
+                    picked [ i ] = static_cast<bool> ( p ( first [ i ] ));
+                    any |= picked [ i ];
+                    }
+                n = block;
+                if ( any == 0 ) {
+                    first += block;
+                    continue;
+                    }
+                }
+            else
+                for ( std::size_t i = 0; i < n; ++i )
+                    picked [ i ] = static_cast<bool> ( p ( first [ i ] ));
+            break;
+            }
+
+        for ( i = 0; i < n; ++i )
+            if ( picked [ i ] )
+                return first + i;
+        return last;
+        }
+
+//  Whether [first, last) can be tested with partitioned_until_blocks: the
+//  same numbers that is_sorted_until compares a vector at a time
+    template <typename Iterator>
+    struct is_partitioned_blockwise {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        typedef boost::integral_constant<bool,
+            is_contiguous_scalars<Iterator>::value && is_sorted_lane<value_type>::value> type;
+        };
+
+    template <typename InputIterator, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR InputIterator
+    partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p, InputIterator &first_false, boost::false_type )
+    {
+    //  Run through the part that satisfy the predicate
+        for ( ; first != last; ++first )
+            if ( !p (*first))
+                break;
+        first_false = first;
+        if ( first == last )
+            return last;
+    //  Now the part that does not satisfy the predicate
+        for ( ++first; first != last; ++first )
+            if ( p (*first))
+                return first;
+        return last;
+    }
+
+    template <typename ContiguousIterator, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR ContiguousIterator
+    partitioned_until ( ContiguousIterator first, ContiguousIterator last, UnaryPredicate p, ContiguousIterator &first_false, boost::true_type )
+    {
+        typedef typename contiguous_element<ContiguousIterator>::type element;
+        if ( first == last || is_constant_evaluated ())
+            return detail::partitioned_until ( first, last, p, first_false, boost::false_type ());
+        element *ptr = contiguous_pointer ( first );
+        element *ff = ptr;
+        element *found = partitioned_until_blocks ( ptr, ptr + ( last - first ), p, ff );
+        first_false = first + ( ff - ptr );
+        return first + ( found - ptr );
+    }
+
+    template <typename InputIterator, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR InputIterator
+    partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p, InputIterator &first_false )
+    {
+        return detail::partitioned_until ( first, last, p, first_false, typename is_partitioned_blockwise<InputIterator>::type ());
+    }
+
+    template <typename InputIterator, typename UnaryPredicate>
+    BOOST_CXX14_CONSTEXPR InputIterator partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p )
+    {
+        InputIterator first_false = first;
+        return detail::partitioned_until ( first, last, p, first_false );
+    }
+
+//  Minimum number of elements in a chunk
+    const std::size_t partitioned_grain = 1 << 15;
+
+//  Chunk 'i' records the offsets of its first element that does not
+//  satisfy the predicate and of the first one after that which does (the
+//  end of the chunk if there is none)
+    template <typename RandomIterator, typename Pred>
+    struct partitioned_until_chunk {
+        partitioned_until_chunk ( RandomIterator first, std::size_t n, std::size_t chunks,
+                                  std::size_t *first_false, std::size_t *until, Pred p )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), first_false_ ( first_false ), until_ ( until ), p_ ( p ) {}
+
+        void operator () ( std::size_t i ) const {
+            const RandomIterator b = first_ + chunk_offset ( i,     chunks_, n_ );
+            const RandomIterator e = first_ + chunk_offset ( i + 1, chunks_, n_ );
+            RandomIterator ff = b;
+            const RandomIterator found = detail::partitioned_until ( b, e, p_, ff );
+            first_false_ [ i ] = static_cast<std::size_t> ( ff - first_ );
+            until_ [ i ]       = static_cast<std::size_t> ( found - first_ );
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        std::size_t *first_false_, *until_;
+        Pred p_;
+        };
+
+    template <typename InputIterator, typename Pred>
+    InputIterator policy_partitioned_until ( const execution::sequenced_policy &,
+                                             InputIterator first, InputIterator last, Pred p )
+    {
+        return detail::partitioned_until ( first, last, p );
+    }
+
+    template <typename InputIterator, typename Pred>
+    InputIterator parallel_partitioned_until ( const execution::parallel_policy &,
+                                               InputIterator first, InputIterator last, Pred p, boost::false_type )
+    {
+        return detail::partitioned_until ( first, last, p );
+    }
+
+    template <typename RandomIterator, typename Pred>
+    RandomIterator parallel_partitioned_until ( const execution::parallel_policy &policy,
+                                                RandomIterator first, RandomIterator last, Pred p, boost::true_type )
+    {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t chunks = parallel_chunk_count ( policy, n, partitioned_grain );
+        if ( chunks <= 1 )
+            return detail::partitioned_until ( first, last, p );
+
+        std::vector<std::size_t> first_false ( chunks ), until ( chunks );
+        parallel_run ( chunks, partitioned_until_chunk<RandomIterator, Pred> (
+            first, n, chunks, &first_false [ 0 ], &until [ 0 ], p ));
+
+    //  Once an element that doesn't satisfy p has been seen, a chunk that
+    //  starts with one that does is out of place at its start
+        bool seen_false = false;
+        for ( std::size_t i = 0; i < chunks; ++i ) {
+            const std::size_t b = chunk_offset ( i,     chunks, n );
+            const std::size_t e = chunk_offset ( i + 1, chunks, n );
+            if ( seen_false && first_false [ i ] != b )
+                return first + b;
+            if ( until [ i ] != e )
+                return first + until [ i ];
+            seen_false = seen_false || first_false [ i ] != e;
+            }
+        return last;
+    }
+
+    template <typename InputIterator, typename Pred>
+    InputIterator policy_partitioned_until ( const execution::parallel_policy &policy,
+                                             InputIterator first, InputIterator last, Pred p )
+    {
+        typedef typename boost::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::random_access_iterator_tag>::type random_access;
+        return parallel_partitioned_until ( policy, first, last, p, random_access ());
+    }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_IS_PARTITIONED_HPP
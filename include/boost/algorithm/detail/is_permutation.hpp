@@ -0,0 +1,176 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The ways of checking that two sequences of the same length are
+    permutations of each other, other than comparing every element with
+    every other one:
+
+    * Counting: for integral values of one or two bytes, count each value
+      up for the first sequence and down for the second.
+    * Hashing: count the values of the first sequence in an open addressing
+      table, and count them down again for the second. Used for the other
+      arithmetic values, enums, pointers and strings (with boost::hash), and
+      for any values when the caller supplies a hash function.
+
+    is_permutation picks one of these when the elements are compared with
+    std::equal_to (the default), and the quadratic search otherwise. It
+    never sorts, since it only requires ==; is_permutation_ordered sorts
+    with the ordering it is given.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_IS_PERMUTATION_HPP
+#define BOOST_ALGORITHM_DETAIL_IS_PERMUTATION_HPP
+
+#include <cstddef>
+#include <functional>   // for std::equal_to
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_enum.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+    struct permutation_count_tag {};
+    struct permutation_hash_tag {};
+    struct permutation_quadratic_tag {};
+
+//  Below this length, the quadratic search is quicker than the set up of the others
+    const std::size_t permutation_small = 16;
+
+//  Two byte values are only counted when there are enough of them to pay
+//  for clearing 64K counters; shorter sequences are hashed.
+    const std::size_t permutation_count_wide = 4096;
+
+//  Whether the predicate is plain equality of the values of both sequences
+    template <typename V1, typename V2, typename Predicate>
+    struct is_value_equality : public boost::integral_constant<bool,
+        boost::is_same<V1, V2>::value &&
+        ( boost::is_same<Predicate, std::equal_to<V1> >::value ||
+          boost::is_same<Predicate, std::equal_to<void> >::value )> {};
+
+//  The types that boost::hash is known to hash consistently with operator ==
+    template <typename T>
+    struct is_permutation_hashable : public boost::integral_constant<bool,
+        boost::is_arithmetic<T>::value || boost::is_enum<T>::value || boost::is_pointer<T>::value ||
+        boost::is_same<T, std::string>::value || boost::is_same<T, std::wstring>::value> {};
+
+    template <typename T, bool Equality>
+    struct permutation_strategy_impl {
+        typedef permutation_quadratic_tag type;
+        };
+
+    template <typename T>
+    struct permutation_strategy_impl<T, true> {
+        typedef typename boost::conditional<
+            boost::is_integral<T>::value && sizeof ( T ) <= 2, permutation_count_tag,
+            typename boost::conditional<is_permutation_hashable<T>::value,
+                permutation_hash_tag, permutation_quadratic_tag>::type
+            >::type type;
+        };
+
+    template <typename Iterator1, typename Iterator2, typename Predicate>
+    struct permutation_strategy {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator1>::value_type>::type value_type1;
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator2>::value_type>::type value_type2;
+        typedef typename permutation_strategy_impl<value_type1,
+            is_value_equality<value_type1, value_type2, Predicate>::value>::type type;
+        };
+
+//  Counting
+    template <std::size_t Size> struct permutation_unsigned;
+    template <> struct permutation_unsigned<1> { typedef unsigned char  type; };
+    template <> struct permutation_unsigned<2> { typedef unsigned short type; };
+
+    template <typename T>
+    std::size_t permutation_index ( T v ) {
+        return static_cast<typename permutation_unsigned<sizeof ( T )>::type> ( v );
+        }
+
+//  Preconditions: both sequences have the same length
+    template <typename ForwardIterator1, typename ForwardIterator2>
+    bool is_permutation_count ( ForwardIterator1 first1, ForwardIterator1 last1,
+                                ForwardIterator2 first2, ForwardIterator2 last2 ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ForwardIterator1>::value_type>::type value_type;
+        std::vector<std::size_t> counts ( std::size_t ( 1 ) << ( 8 * sizeof ( value_type )));
+        for ( ; first1 != last1; ++first1 )
+            ++counts [ permutation_index<value_type> ( *first1 ) ];
+    //  The lengths are the same, so if no count goes below zero, they all end at zero
+        for ( ; first2 != last2; ++first2 )
+            if ( counts [ permutation_index<value_type> ( *first2 ) ]-- == 0 )
+                return false;
+        return true;
+        }
+
+//  Hashing
+    template <typename Iterator>
+    struct permutation_slot {
+        permutation_slot () : used ( false ), hash ( 0 ), count ( 0 ), it () {}
+
+        bool used;
+        std::size_t hash;
+        std::size_t count;
+        Iterator it;            //  the first element of the first sequence with this value
+        };
+
+//  Preconditions: both sequences have n elements
+    template <typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate, typename Hash>
+    bool is_permutation_hash ( ForwardIterator1 first1, ForwardIterator1 last1,
+                               ForwardIterator2 first2, ForwardIterator2 last2,
+                               std::size_t n, BinaryPredicate p, Hash h ) {
+        typedef permutation_slot<ForwardIterator1> slot;
+
+    //  At most half full, with a power of two slots
+        std::size_t size = 16;
+        while ( size < 2 * n )
+            size *= 2;
+        const std::size_t mask = size - 1;
+        std::vector<slot> table ( size );
+
+        for ( ; first1 != last1; ++first1 ) {
+            const std::size_t hash = h ( *first1 );
+            std::size_t i = hash & mask;
+            while ( table [ i ].used && !( table [ i ].hash == hash && p ( *table [ i ].it, *first1 )))
+                i = ( i + 1 ) & mask;
+            if ( !table [ i ].used ) {
+                table [ i ].used = true;
+                table [ i ].hash = hash;
+                table [ i ].it   = first1;
+                }
+            ++table [ i ].count;
+            }
+
+    //  The lengths are the same, so if no count goes below zero, they all end at zero
+        for ( ; first2 != last2; ++first2 ) {
+            const std::size_t hash = h ( *first2 );
+            std::size_t i = hash & mask;
+            while ( table [ i ].used && !( table [ i ].hash == hash && p ( *table [ i ].it, *first2 )))
+                i = ( i + 1 ) & mask;
+            if ( !table [ i ].used || table [ i ].count == 0 )
+                return false;
+            --table [ i ].count;
+            }
+        return true;
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_IS_PERMUTATION_HPP
@@ -0,0 +1,220 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind the faster versions of is_sorted_until (and so of
+    is_sorted and the is_increasing family).
+
+    Arrays of numbers compared with std::less, std::greater, std::less_equal
+    or std::greater_equal are checked a block of 256 bytes at a time (numbers
+    of eight bytes only where the vector units compare them): each
+    element of the block is compared with the next one, and the results are
+    or-ed together into an integer the size of an element, in a loop without
+    branches that compilers turn into vector compares. Only the block with
+    the first pair out of order is then searched pair by pair. Each pair is
+    compared exactly as the element by element loop compares it, so NaNs
+    give the same answer.
+
+    The execution policy versions split the pairs of neighbouring elements
+    into chunks (so that the pairs that straddle two chunks are checked
+    too), find the first pair out of order in each chunk concurrently, and
+    take the first chunk that has one.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_IS_SORTED_HPP
+#define BOOST_ALGORITHM_DETAIL_IS_SORTED_HPP
+
+#include <cstddef>      // for std::size_t
+#include <functional>   // for std::less, std::greater and friends
+#include <iterator>     // for std::iterator_traits
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  The orderings that compare two numbers with a single instruction
+    template <typename Pred, typename T>
+    struct is_number_ordering : public boost::integral_constant<bool,
+           boost::is_same<Pred, std::less<T> >::value
+        || boost::is_same<Pred, std::greater<T> >::value
+        || boost::is_same<Pred, std::less_equal<T> >::value
+        || boost::is_same<Pred, std::greater_equal<T> >::value
+        || boost::is_same<Pred, std::less<void> >::value
+        || boost::is_same<Pred, std::greater<void> >::value
+        || boost::is_same<Pred, std::less_equal<void> >::value
+        || boost::is_same<Pred, std::greater_equal<void> >::value> {};
+
+    template <std::size_t Size> struct sorted_lane;
+    template <> struct sorted_lane<1> { typedef boost::uint8_t  type; };
+    template <> struct sorted_lane<2> { typedef boost::uint16_t type; };
+    template <> struct sorted_lane<4> { typedef boost::uint32_t type; };
+    template <> struct sorted_lane<8> { typedef boost::uint64_t type; };
+
+    template <typename T, bool Number = boost::is_arithmetic<T>::value && !boost::is_same<T, bool>::value>
+    struct is_sorted_lane : public boost::false_type {};
+
+//  Without AVX2 (or NEON) pairs of eight byte numbers are compared one at a
+//  time anyway, and the blocks only add work
+#if defined(__AVX2__) || defined(__aarch64__) || defined(_M_ARM64)
+#define BOOST_ALGORITHM_SORTED_WIDE_LANES 1
+#else
+#define BOOST_ALGORITHM_SORTED_WIDE_LANES 0
+#endif
+
+    template <typename T>
+    struct is_sorted_lane<T, true> : public boost::integral_constant<bool,
+        sizeof ( T ) == 1 || sizeof ( T ) == 2 || sizeof ( T ) == 4
+        || ( sizeof ( T ) == 8 && BOOST_ALGORITHM_SORTED_WIDE_LANES )> {};
+
+//  Whether [first, last) can be checked with sorted_until_blocks
+    template <typename Iterator, typename Pred>
+    struct is_sorted_blockwise {
+        typedef typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+        typedef boost::integral_constant<bool,
+               is_contiguous_scalars<Iterator>::value
+            && is_sorted_lane<value_type>::value
+            && is_number_ordering<Pred, value_type>::value> type;
+        };
+
+//  The first element of [first, last) that is ordered before the one
+//  before it, or last
+    template <typename T, typename Pred>
+    const T *sorted_until_blocks ( const T *first, const T *last, Pred p ) {
+        typedef typename sorted_lane<sizeof ( T )>::type lane;
+        const std::size_t block = 256 / sizeof ( T );
+
+        if ( first == last )
+            return last;
+    //  The block needs its last element's successor
+        while ( static_cast<std::size_t> ( last - first ) > block ) {
+            lane unordered = 0;
+            for ( std::size_t i = 0; i < block; ++i )
+                unordered |= static_cast<lane> ( p ( first [ i + 1 ], first [ i ] ));
+            if ( unordered != 0 )
+                break;
+            first += block;
+            }
+        for ( const T *next = first + 1; next != last; ++next )
+            if ( p ( *next, next [ -1 ] ))
+                return next;
+        return last;
+        }
+
+    template <typename ForwardIterator, typename Pred>
+    BOOST_CXX14_CONSTEXPR ForwardIterator sorted_until ( ForwardIterator first, ForwardIterator last, Pred p, boost::false_type )
+    {
+        if ( first == last ) return last;  // the empty sequence is ordered
+        ForwardIterator next = first;
+        while ( ++next != last )
+        {
+            if ( p ( *next, *first ))
+                return next;
+            first = next;
+        }
+        return last;
+    }
+
+    template <typename ContiguousIterator, typename Pred>
+    BOOST_CXX14_CONSTEXPR ContiguousIterator sorted_until ( ContiguousIterator first, ContiguousIterator last, Pred p, boost::true_type )
+    {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIterator>::value_type>::type value_type;
+        if ( first == last || is_constant_evaluated ())
+            return detail::sorted_until ( first, last, p, boost::false_type ());
+        const value_type *ptr = &*first;
+        return first + ( sorted_until_blocks ( ptr, ptr + ( last - first ), p ) - ptr );
+    }
+
+    template <typename ForwardIterator, typename Pred>
+    BOOST_CXX14_CONSTEXPR ForwardIterator sorted_until ( ForwardIterator first, ForwardIterator last, Pred p )
+    {
+        return detail::sorted_until ( first, last, p, typename is_sorted_blockwise<ForwardIterator, Pred>::type ());
+    }
+
+//  Minimum number of elements in a chunk
+    const std::size_t sorted_grain = 1 << 15;
+
+//  Chunk 'i' checks the pairs ( k, k + 1 ) for k in [b, e), and records the
+//  offset of the first element out of order, or n if there is none
+    template <typename RandomIterator, typename Pred>
+    struct sorted_until_chunk {
+        sorted_until_chunk ( RandomIterator first, std::size_t n, std::size_t chunks,
+                             std::size_t *results, Pred p )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), results_ ( results ), p_ ( p ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t b = chunk_offset ( i,     chunks_, n_ - 1 );
+            const std::size_t e = chunk_offset ( i + 1, chunks_, n_ - 1 );
+            const RandomIterator last = first_ + ( e + 1 );
+            const RandomIterator found = detail::sorted_until ( first_ + b, last, p_ );
+            results_ [ i ] = found == last ? n_ : static_cast<std::size_t> ( found - first_ );
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        std::size_t *results_;
+        Pred p_;
+        };
+
+    template <typename ForwardIterator, typename Pred>
+    ForwardIterator policy_sorted_until ( const execution::sequenced_policy &,
+                                          ForwardIterator first, ForwardIterator last, Pred p )
+    {
+        return detail::sorted_until ( first, last, p );
+    }
+
+    template <typename ForwardIterator, typename Pred>
+    ForwardIterator parallel_sorted_until ( const execution::parallel_policy &,
+                                            ForwardIterator first, ForwardIterator last, Pred p, boost::false_type )
+    {
+        return detail::sorted_until ( first, last, p );
+    }
+
+    template <typename RandomIterator, typename Pred>
+    RandomIterator parallel_sorted_until ( const execution::parallel_policy &policy,
+                                           RandomIterator first, RandomIterator last, Pred p, boost::true_type )
+    {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t chunks = n < 2 ? 1 : parallel_chunk_count ( policy, n - 1, sorted_grain );
+        if ( chunks <= 1 )
+            return detail::sorted_until ( first, last, p );
+
+        std::vector<std::size_t> results ( chunks );
+        parallel_run ( chunks, sorted_until_chunk<RandomIterator, Pred> ( first, n, chunks, &results [ 0 ], p ));
+        for ( std::size_t i = 0; i < chunks; ++i )
+            if ( results [ i ] != n )
+                return first + results [ i ];
+        return last;
+    }
+
+    template <typename ForwardIterator, typename Pred>
+    ForwardIterator policy_sorted_until ( const execution::parallel_policy &policy,
+                                          ForwardIterator first, ForwardIterator last, Pred p )
+    {
+        typedef typename boost::is_convertible<
+            typename std::iterator_traits<ForwardIterator>::iterator_category,
+            std::random_access_iterator_tag>::type random_access;
+        return parallel_sorted_until ( policy, first, last, p, random_access ());
+    }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_IS_SORTED_HPP
@@ -0,0 +1,39 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    detail::move_value ( x ) is std::move ( x ) when the compiler has rvalue
+    references, and a const reference to x (so, a copy) when it does not.
+    Unlike std::move, it also accepts the proxy references returned by
+    iterators such as std::vector<bool>::iterator.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_MOVE_HPP
+#define BOOST_ALGORITHM_DETAIL_MOVE_HPP
+
+#include <boost/config.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    template <typename T>
+    typename boost::remove_reference<T>::type &&move_value ( T &&t ) {
+        return static_cast<typename boost::remove_reference<T>::type &&> ( t );
+        }
+#else
+    template <typename T>
+    const T &move_value ( const T &t ) { return t; }
+#endif
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_MOVE_HPP
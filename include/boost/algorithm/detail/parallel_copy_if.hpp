@@ -0,0 +1,292 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The execution policy versions of copy_if and partition_copy.
+
+    The parallel versions work in three phases:
+        1. The predicate is applied to each element of each chunk,
+           concurrently; the results are kept (a byte per element), and the
+           number of elements picked in each chunk is counted.
+        2. The counts are summed, in order, giving the place in the output
+           where each chunk's elements go.
+        3. Each chunk copies its picked elements to its place, concurrently.
+    So the output is in the same order as the sequential versions give,
+    and the predicate is applied exactly once to each element. They need
+    random access to the input and to the outputs; other iterators get the
+    sequential algorithm.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_PARALLEL_COPY_IF_HPP
+#define BOOST_ALGORITHM_DETAIL_PARALLEL_COPY_IF_HPP
+
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::iterator_traits
+#include <utility>      // for std::pair
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/copy_if.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  Minimum number of elements in a chunk
+    const std::size_t copy_if_grain = 1 << 15;
+
+    template <typename Iterator>
+    struct copy_if_is_random_access : public boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category, std::random_access_iterator_tag> {};
+
+//  The result of phase 1 for an element of an array, found from its address;
+//  the block functions apply their predicate to the elements themselves.
+    template <typename T>
+    struct copy_if_flagged {
+        copy_if_flagged ( const T *base, const unsigned char *flags ) : base_ ( base ), flags_ ( flags ) {}
+        bool operator () ( const T &x ) const { return flags_ [ &x - base_ ] != 0; }
+
+    private:
+        const T *base_;
+        const unsigned char *flags_;
+        };
+
+//  Copy the elements of [first, last) whose flags are set
+    template <typename RandomIterator, typename OutputIterator>
+    OutputIterator copy_flagged ( RandomIterator first, RandomIterator last, const unsigned char *flags,
+                                  OutputIterator result, boost::false_type ) {
+        for ( ; first != last; ++first, ++flags )
+            if ( *flags )
+                *result++ = *first;
+        return result;
+        }
+
+    template <typename ContiguousIterator, typename OutputIterator>
+    OutputIterator copy_flagged ( ContiguousIterator first, ContiguousIterator last, const unsigned char *flags,
+                                  OutputIterator result, boost::true_type ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIterator>::value_type>::type value_type;
+        if ( first == last )
+            return result;
+        const value_type *ptr = &*first;
+        return copy_if_blocks ( ptr, ptr + ( last - first ), result, copy_if_flagged<value_type> ( ptr, flags ));
+        }
+
+    template <typename RandomIterator, typename OutputIterator1, typename OutputIterator2>
+    void partition_flagged ( RandomIterator first, RandomIterator last, const unsigned char *flags,
+                             OutputIterator1 out_true, OutputIterator2 out_false, boost::false_type ) {
+        for ( ; first != last; ++first, ++flags )
+            if ( *flags )
+                *out_true++ = *first;
+            else
+                *out_false++ = *first;
+        }
+
+    template <typename ContiguousIterator, typename OutputIterator1, typename OutputIterator2>
+    void partition_flagged ( ContiguousIterator first, ContiguousIterator last, const unsigned char *flags,
+                             OutputIterator1 out_true, OutputIterator2 out_false, boost::true_type ) {
+        typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIterator>::value_type>::type value_type;
+        if ( first == last )
+            return;
+        const value_type *ptr = &*first;
+        partition_copy_blocks ( ptr, ptr + ( last - first ), out_true, out_false, copy_if_flagged<value_type> ( ptr, flags ));
+        }
+
+//  Phase 1: apply the predicate to chunk 'i', and count the elements picked
+    template <typename RandomIterator, typename Predicate>
+    struct copy_if_flag_chunk {
+        copy_if_flag_chunk ( RandomIterator first, std::size_t n, std::size_t chunks,
+                             unsigned char *flags, std::size_t *counts, Predicate p )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), flags_ ( flags ), counts_ ( counts ), p_ ( p ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t b = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t e = chunk_offset ( i + 1, chunks_, n_ );
+        //  Stores through 'flags' may alias anything, so keep everything
+        //  else in locals, where they can stay in registers
+            RandomIterator it = first_ + b;
+            unsigned char *flags = flags_ + b;
+            const Predicate p = p_;
+            std::size_t count = 0;
+            for ( std::size_t k = 0; k != e - b; ++k, ++it ) {
+                const unsigned char picked = static_cast<unsigned char> ( static_cast<bool> ( p ( *it )));
+                flags [ k ] = picked;
+                count += picked;
+                }
+            counts_ [ i ] = count;
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        unsigned char *flags_;
+        std::size_t *counts_;
+        Predicate p_;
+        };
+
+//  Phase 3: copy the picked elements of chunk 'i' to result + offsets [ i ]
+    template <typename RandomIterator, typename RandomOutput>
+    struct copy_if_write_chunk {
+        copy_if_write_chunk ( RandomIterator first, RandomOutput result, std::size_t n, std::size_t chunks,
+                              const unsigned char *flags, const std::size_t *offsets )
+            : first_ ( first ), result_ ( result ), n_ ( n ), chunks_ ( chunks ), flags_ ( flags ), offsets_ ( offsets ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t b = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t e = chunk_offset ( i + 1, chunks_, n_ );
+            copy_flagged ( first_ + b, first_ + e, flags_ + b, result_ + offsets_ [ i ],
+                           typename is_copy_blockwise<RandomIterator>::type ());
+            }
+
+    private:
+        RandomIterator first_;
+        RandomOutput result_;
+        std::size_t n_, chunks_;
+        const unsigned char *flags_;
+        const std::size_t *offsets_;
+        };
+
+//  Phase 3 for partition_copy: offsets [ i ] elements before chunk 'i' were
+//  picked, and the rest were not.
+    template <typename RandomIterator, typename RandomOutput1, typename RandomOutput2>
+    struct partition_copy_write_chunk {
+        partition_copy_write_chunk ( RandomIterator first, RandomOutput1 out_true, RandomOutput2 out_false,
+                                     std::size_t n, std::size_t chunks,
+                                     const unsigned char *flags, const std::size_t *offsets )
+            : first_ ( first ), out_true_ ( out_true ), out_false_ ( out_false ), n_ ( n ), chunks_ ( chunks ),
+              flags_ ( flags ), offsets_ ( offsets ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t b = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t e = chunk_offset ( i + 1, chunks_, n_ );
+            partition_flagged ( first_ + b, first_ + e, flags_ + b,
+                                out_true_ + offsets_ [ i ], out_false_ + ( b - offsets_ [ i ] ),
+                                typename is_copy_blockwise<RandomIterator>::type ());
+            }
+
+    private:
+        RandomIterator first_;
+        RandomOutput1 out_true_;
+        RandomOutput2 out_false_;
+        std::size_t n_, chunks_;
+        const unsigned char *flags_;
+        const std::size_t *offsets_;
+        };
+
+//  Phases 1 and 2: returns the number of chunks, having filled in 'flags'
+//  and 'offsets' (which has an extra entry, the total picked)
+    template <typename RandomIterator, typename Predicate>
+    std::size_t copy_if_flag ( const execution::parallel_policy &policy, RandomIterator first, std::size_t n,
+                               std::vector<unsigned char> &flags, std::vector<std::size_t> &offsets, Predicate p ) {
+        const std::size_t chunks = parallel_chunk_count ( policy, n, copy_if_grain );
+        if ( chunks <= 1 )
+            return chunks;
+
+        flags.resize ( n );
+        std::vector<std::size_t> counts ( chunks );
+        parallel_run ( chunks, copy_if_flag_chunk<RandomIterator, Predicate> ( first, n, chunks, &flags [ 0 ], &counts [ 0 ], p ));
+
+        offsets.resize ( chunks + 1 );
+        offsets [ 0 ] = 0;
+        for ( std::size_t i = 0; i < chunks; ++i )
+            offsets [ i + 1 ] = offsets [ i ] + counts [ i ];
+        return chunks;
+        }
+
+    template <typename RandomIterator, typename RandomOutput, typename Predicate>
+    RandomOutput parallel_copy_if ( const execution::parallel_policy &policy,
+                                    RandomIterator first, RandomIterator last, RandomOutput result,
+                                    Predicate p, boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        std::vector<unsigned char> flags;
+        std::vector<std::size_t> offsets;
+        const std::size_t chunks = copy_if_flag ( policy, first, n, flags, offsets, p );
+        if ( chunks <= 1 )
+            return boost::algorithm::detail::copy_if ( first, last, result, p, typename is_copy_blockwise<RandomIterator>::type ());
+
+        parallel_run ( chunks, copy_if_write_chunk<RandomIterator, RandomOutput> ( first, result, n, chunks, &flags [ 0 ], &offsets [ 0 ] ));
+        return result + offsets [ chunks ];
+        }
+
+    template <typename InputIterator, typename OutputIterator, typename Predicate>
+    OutputIterator parallel_copy_if ( const execution::parallel_policy &,
+                                      InputIterator first, InputIterator last, OutputIterator result,
+                                      Predicate p, boost::false_type ) {
+        return boost::algorithm::detail::copy_if ( first, last, result, p, typename is_copy_blockwise<InputIterator>::type ());
+        }
+
+    template <typename InputIterator, typename OutputIterator, typename Predicate>
+    OutputIterator policy_copy_if ( const execution::sequenced_policy &,
+                                    InputIterator first, InputIterator last, OutputIterator result, Predicate p ) {
+        return boost::algorithm::detail::copy_if ( first, last, result, p, typename is_copy_blockwise<InputIterator>::type ());
+        }
+
+    template <typename InputIterator, typename OutputIterator, typename Predicate>
+    OutputIterator policy_copy_if ( const execution::parallel_policy &policy,
+                                    InputIterator first, InputIterator last, OutputIterator result, Predicate p ) {
+        typedef boost::integral_constant<bool,
+            copy_if_is_random_access<InputIterator>::value && copy_if_is_random_access<OutputIterator>::value> random_access;
+        return parallel_copy_if ( policy, first, last, result, p, random_access ());
+        }
+
+    template <typename RandomIterator, typename RandomOutput1, typename RandomOutput2, typename Predicate>
+    std::pair<RandomOutput1, RandomOutput2>
+    parallel_partition_copy ( const execution::parallel_policy &policy,
+                              RandomIterator first, RandomIterator last,
+                              RandomOutput1 out_true, RandomOutput2 out_false, Predicate p, boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        std::vector<unsigned char> flags;
+        std::vector<std::size_t> offsets;
+        const std::size_t chunks = copy_if_flag ( policy, first, n, flags, offsets, p );
+        if ( chunks <= 1 )
+            return boost::algorithm::detail::partition_copy ( first, last, out_true, out_false, p,
+                                                              typename is_copy_blockwise<RandomIterator>::type ());
+
+        parallel_run ( chunks, partition_copy_write_chunk<RandomIterator, RandomOutput1, RandomOutput2>
+                                   ( first, out_true, out_false, n, chunks, &flags [ 0 ], &offsets [ 0 ] ));
+        return std::pair<RandomOutput1, RandomOutput2> ( out_true + offsets [ chunks ], out_false + ( n - offsets [ chunks ] ));
+        }
+
+    template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Predicate>
+    std::pair<OutputIterator1, OutputIterator2>
+    parallel_partition_copy ( const execution::parallel_policy &,
+                              InputIterator first, InputIterator last,
+                              OutputIterator1 out_true, OutputIterator2 out_false, Predicate p, boost::false_type ) {
+        return boost::algorithm::detail::partition_copy ( first, last, out_true, out_false, p,
+                                                          typename is_copy_blockwise<InputIterator>::type ());
+        }
+
+    template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Predicate>
+    std::pair<OutputIterator1, OutputIterator2>
+    policy_partition_copy ( const execution::sequenced_policy &,
+                            InputIterator first, InputIterator last,
+                            OutputIterator1 out_true, OutputIterator2 out_false, Predicate p ) {
+        return boost::algorithm::detail::partition_copy ( first, last, out_true, out_false, p,
+                                                          typename is_copy_blockwise<InputIterator>::type ());
+        }
+
+    template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Predicate>
+    std::pair<OutputIterator1, OutputIterator2>
+    policy_partition_copy ( const execution::parallel_policy &policy,
+                            InputIterator first, InputIterator last,
+                            OutputIterator1 out_true, OutputIterator2 out_false, Predicate p ) {
+        typedef boost::integral_constant<bool,
+               copy_if_is_random_access<InputIterator>::value
+            && copy_if_is_random_access<OutputIterator1>::value
+            && copy_if_is_random_access<OutputIterator2>::value> random_access;
+        return parallel_partition_copy ( policy, first, last, out_true, out_false, p, random_access ());
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_PARALLEL_COPY_IF_HPP
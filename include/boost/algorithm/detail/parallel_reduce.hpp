@@ -0,0 +1,278 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind reduce and transform_reduce.
+
+    The kernels read the i'th (transformed) element of a random access input
+    through an "element" function object, so that the same code serves
+    reduce, the unary transform_reduce and the two range transform_reduce.
+
+    When the operation is std::plus or std::multiplies on arithmetic types,
+    the elements are combined into four independent accumulators. This
+    breaks the chain of dependent additions and lets the compiler vectorize
+    the loop, at the cost of combining the elements in a different order,
+    which reduce allows.
+
+    The execution policy versions split the input into blocks of a fixed
+    size, reduce each block, and then combine the blocks in a fixed tree.
+    Neither step depends on the number of threads, so the result (even for
+    floating point) is the same from run to run, and for seq and par.
+    The operation is given the elements as they are, as in the sequential
+    loop; the first block starts from init, and each of the others from its
+    first element converted to T.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_PARALLEL_REDUCE_HPP
+#define BOOST_ALGORITHM_DETAIL_PARALLEL_REDUCE_HPP
+
+#include <cstddef>      // for std::size_t
+#include <functional>   // for std::plus and std::multiplies
+#include <iterator>     // for std::iterator_traits
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#include <boost/algorithm/execution.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+    struct reduce_identity {
+        template <typename T>
+        const T &operator () ( const T &t ) const { return t; }
+        };
+
+//  Can the operation be applied in any order?
+    template <typename BinaryOperation, typename T>
+    struct reduce_reassociable : public boost::false_type {};
+
+    template <typename U, typename T>
+    struct reduce_reassociable<std::plus<U>, T>
+        : public boost::integral_constant<bool, boost::is_arithmetic<U>::value && boost::is_arithmetic<T>::value> {};
+
+    template <typename U, typename T>
+    struct reduce_reassociable<std::multiplies<U>, T>
+        : public boost::integral_constant<bool, boost::is_arithmetic<U>::value && boost::is_arithmetic<T>::value> {};
+
+    template <typename Iterator>
+    struct reduce_is_random_access : public boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category, std::random_access_iterator_tag> {};
+
+//  The i'th element of a range, transformed: converted to T to start a
+//  block, or combined with the block's result so far
+    template <typename RandomIterator, typename T, typename UnaryOperation>
+    struct unary_element {
+        unary_element ( RandomIterator first, UnaryOperation uOp ) : first_ ( first ), uOp_ ( uOp ) {}
+        T seed ( std::size_t i ) const { return uOp_ ( first_ [ i ] ); }
+        template <typename BinaryOperation>
+        T add ( const T &acc, std::size_t i, BinaryOperation bOp ) const { return bOp ( acc, uOp_ ( first_ [ i ] )); }
+    private:
+        RandomIterator first_;
+        UnaryOperation uOp_;
+        };
+
+//  The i'th elements of two ranges, combined
+    template <typename RandomIterator1, typename RandomIterator2, typename T, typename BinaryOperation>
+    struct binary_element {
+        binary_element ( RandomIterator1 first1, RandomIterator2 first2, BinaryOperation bOp )
+            : first1_ ( first1 ), first2_ ( first2 ), bOp_ ( bOp ) {}
+        T seed ( std::size_t i ) const { return bOp_ ( first1_ [ i ], first2_ [ i ] ); }
+        template <typename BinaryOperation1>
+        T add ( const T &acc, std::size_t i, BinaryOperation1 bOp1 ) const { return bOp1 ( acc, bOp_ ( first1_ [ i ], first2_ [ i ] )); }
+    private:
+        RandomIterator1 first1_;
+        RandomIterator2 first2_;
+        BinaryOperation bOp_;
+        };
+
+//  Combine acc with elements [ b, l ), in order
+    template <typename T, typename Element, typename BinaryOperation>
+    T block_reduce ( T acc, const Element &e, std::size_t b, std::size_t l, BinaryOperation bOp, boost::false_type ) {
+        for ( ; b != l; ++b )
+            acc = e.add ( acc, b, bOp );
+        return acc;
+        }
+
+//  Combine acc with elements [ b, l ), into four accumulators
+    template <typename T, typename Element, typename BinaryOperation>
+    T block_reduce ( T acc, const Element &e, std::size_t b, std::size_t l, BinaryOperation bOp, boost::true_type ) {
+        if ( l - b < 8 )
+            return block_reduce<T> ( acc, e, b, l, bOp, boost::false_type ());
+
+        T a0 = acc, a1 = e.seed ( b ), a2 = e.seed ( b + 1 ), a3 = e.seed ( b + 2 );
+        a0 = e.add ( a0, b + 3, bOp );
+        for ( b += 4; l - b >= 4; b += 4 ) {
+            a0 = e.add ( a0, b,     bOp );
+            a1 = e.add ( a1, b + 1, bOp );
+            a2 = e.add ( a2, b + 2, bOp );
+            a3 = e.add ( a3, b + 3, bOp );
+            }
+        for ( ; b != l; ++b )
+            a0 = e.add ( a0, b, bOp );
+        return bOp ( bOp ( a0, a1 ), bOp ( a2, a3 ));
+        }
+
+//  The sequential algorithms
+    template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T sequential_reduce ( InputIterator first, InputIterator last, T init,
+                          BinaryOperation bOp, UnaryOperation uOp, boost::false_type ) {
+        for ( ; first != last; ++first )
+            init = bOp ( init, uOp ( *first ));
+        return init;
+        }
+
+    template <typename RandomIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T sequential_reduce ( RandomIterator first, RandomIterator last, T init,
+                          BinaryOperation bOp, UnaryOperation uOp, boost::true_type ) {
+        return block_reduce<T> ( init, unary_element<RandomIterator, T, UnaryOperation> ( first, uOp ),
+                                 0, static_cast<std::size_t> ( last - first ), bOp, boost::true_type ());
+        }
+
+    template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T sequential_reduce ( InputIterator first, InputIterator last, T init, BinaryOperation bOp, UnaryOperation uOp ) {
+        typedef boost::integral_constant<bool,
+            reduce_is_random_access<InputIterator>::value && reduce_reassociable<BinaryOperation, T>::value> fast;
+        return sequential_reduce ( first, last, init, bOp, uOp, fast ());
+        }
+
+    template <typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+    T sequential_reduce2 ( InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+                           BinaryOperation1 bOp1, BinaryOperation2 bOp2, boost::false_type ) {
+        for ( ; first1 != last1; ++first1, (void) ++first2 )
+            init = bOp1 ( init, bOp2 ( *first1, *first2 ));
+        return init;
+        }
+
+    template <typename RandomIterator1, typename RandomIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+    T sequential_reduce2 ( RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, T init,
+                           BinaryOperation1 bOp1, BinaryOperation2 bOp2, boost::true_type ) {
+        return block_reduce<T> ( init, binary_element<RandomIterator1, RandomIterator2, T, BinaryOperation2> ( first1, first2, bOp2 ),
+                                 0, static_cast<std::size_t> ( last1 - first1 ), bOp1, boost::true_type ());
+        }
+
+//  The dot product (std::plus and std::multiplies) is the common case
+    template <typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+    T sequential_reduce2 ( InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+                           BinaryOperation1 bOp1, BinaryOperation2 bOp2 ) {
+        typedef boost::integral_constant<bool,
+            reduce_is_random_access<InputIterator1>::value && reduce_is_random_access<InputIterator2>::value &&
+            reduce_reassociable<BinaryOperation1, T>::value && reduce_reassociable<BinaryOperation2, T>::value> fast;
+        return sequential_reduce2 ( first1, last1, first2, init, bOp1, bOp2, fast ());
+        }
+
+//  Elements in each block of the execution policy versions
+    const std::size_t reduce_block_size = 1 << 14;
+
+    template <typename T, typename Element, typename BinaryOperation>
+    struct reduce_blocks {
+        reduce_blocks ( const Element &e, std::size_t n, std::size_t blocks, std::size_t chunks,
+                        T *results, BinaryOperation bOp )
+            : e_ ( e ), n_ ( n ), blocks_ ( blocks ), chunks_ ( chunks ), results_ ( results ), bOp_ ( bOp ) {}
+
+    //  Reduce the blocks in chunk 'i'. The first block starts from init
+    //  (which results [ 0 ] holds), and each of the others from its first element.
+        void operator () ( std::size_t i ) const {
+            const std::size_t last = chunk_offset ( i + 1, chunks_, blocks_ );
+            for ( std::size_t j = chunk_offset ( i, chunks_, blocks_ ); j != last; ++j ) {
+                const std::size_t b = j * reduce_block_size;
+                const std::size_t l = n_ - b > reduce_block_size ? b + reduce_block_size : n_;
+                if ( j == 0 )
+                    results_ [ j ] = block_reduce<T> ( results_ [ j ], e_, b, l, bOp_, reduce_reassociable<BinaryOperation, T> ());
+                else
+                    results_ [ j ] = block_reduce<T> ( e_.seed ( b ), e_, b + 1, l, bOp_, reduce_reassociable<BinaryOperation, T> ());
+                }
+            }
+
+    private:
+        Element e_;
+        std::size_t n_, blocks_, chunks_;
+        T *results_;
+        BinaryOperation bOp_;
+        };
+
+    template <typename T, typename Element, typename BinaryOperation>
+    T blocked_reduce ( std::size_t chunks, const Element &e, std::size_t n, T init, BinaryOperation bOp ) {
+        if ( n == 0 )
+            return init;
+
+        const std::size_t blocks = ( n + reduce_block_size - 1 ) / reduce_block_size;
+        std::vector<T> results ( blocks, init );
+        parallel_run ( chunks, reduce_blocks<T, Element, BinaryOperation> ( e, n, blocks, chunks, &results[0], bOp ));
+
+    //  Combine neighbouring blocks, then neighbouring pairs, and so on
+        for ( std::size_t width = 1; width < blocks; width *= 2 )
+            for ( std::size_t j = 0; j + width < blocks; j += 2 * width )
+                results [ j ] = bOp ( results [ j ], results [ j + width ] );
+        return results [ 0 ];
+        }
+
+//  How many chunks should the blocks of an 'n' element range be split into?
+    inline std::size_t reduce_chunks ( const execution::sequenced_policy &, std::size_t ) {
+        return 1;
+        }
+
+    inline std::size_t reduce_chunks ( const execution::parallel_policy &policy, std::size_t n ) {
+        const std::size_t blocks = ( n + reduce_block_size - 1 ) / reduce_block_size;
+        return parallel_chunk_count ( policy, blocks, 4 );
+        }
+
+    template <typename ExecutionPolicy, typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T policy_reduce ( const ExecutionPolicy &, InputIterator first, InputIterator last, T init,
+                      BinaryOperation bOp, UnaryOperation uOp, boost::false_type ) {
+        return sequential_reduce ( first, last, init, bOp, uOp, boost::false_type ());
+        }
+
+    template <typename ExecutionPolicy, typename RandomIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T policy_reduce ( const ExecutionPolicy &policy, RandomIterator first, RandomIterator last, T init,
+                      BinaryOperation bOp, UnaryOperation uOp, boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        return blocked_reduce ( reduce_chunks ( policy, n ),
+                                unary_element<RandomIterator, T, UnaryOperation> ( first, uOp ), n, init, bOp );
+        }
+
+    template <typename ExecutionPolicy, typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    T policy_reduce ( const ExecutionPolicy &policy, InputIterator first, InputIterator last, T init,
+                      BinaryOperation bOp, UnaryOperation uOp ) {
+        return policy_reduce ( policy, first, last, init, bOp, uOp, reduce_is_random_access<InputIterator> ());
+        }
+
+    template <typename ExecutionPolicy, typename InputIterator1, typename InputIterator2, typename T,
+              typename BinaryOperation1, typename BinaryOperation2>
+    T policy_reduce2 ( const ExecutionPolicy &, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       T init, BinaryOperation1 bOp1, BinaryOperation2 bOp2, boost::false_type ) {
+        return sequential_reduce2 ( first1, last1, first2, init, bOp1, bOp2, boost::false_type ());
+        }
+
+    template <typename ExecutionPolicy, typename RandomIterator1, typename RandomIterator2, typename T,
+              typename BinaryOperation1, typename BinaryOperation2>
+    T policy_reduce2 ( const ExecutionPolicy &policy, RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2,
+                       T init, BinaryOperation1 bOp1, BinaryOperation2 bOp2, boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last1 - first1 );
+        return blocked_reduce ( reduce_chunks ( policy, n ),
+                                binary_element<RandomIterator1, RandomIterator2, T, BinaryOperation2> ( first1, first2, bOp2 ),
+                                n, init, bOp1 );
+        }
+
+    template <typename ExecutionPolicy, typename InputIterator1, typename InputIterator2, typename T,
+              typename BinaryOperation1, typename BinaryOperation2>
+    T policy_reduce2 ( const ExecutionPolicy &policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       T init, BinaryOperation1 bOp1, BinaryOperation2 bOp2 ) {
+        typedef boost::integral_constant<bool,
+            reduce_is_random_access<InputIterator1>::value && reduce_is_random_access<InputIterator2>::value> random_access;
+        return policy_reduce2 ( policy, first1, last1, first2, init, bOp1, bOp2, random_access ());
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_PARALLEL_REDUCE_HPP
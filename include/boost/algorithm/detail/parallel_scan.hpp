@@ -0,0 +1,221 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The execution policy versions of the scans.
+
+    All four scans are a transform_inclusive_scan or a transform_exclusive_scan,
+    with or without an initial value (the others use an identity transform).
+
+    The parallel version works in three phases:
+        1. Each chunk but the last is reduced to a single value, concurrently.
+        2. Those values are scanned, giving the value each chunk starts from.
+        3. Each chunk is scanned from its starting value, concurrently.
+    This reads the input twice, but writes the output only once, and
+    relies on the operation being associative (as the standard allows).
+    It needs random access to both the input and the output; other
+    iterators get the sequential algorithm.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_PARALLEL_SCAN_HPP
+#define BOOST_ALGORITHM_DETAIL_PARALLEL_SCAN_HPP
+
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::iterator_traits
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#include <boost/algorithm/execution.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  The transform used by inclusive_scan and exclusive_scan
+    struct scan_identity {
+        template <typename T>
+        const T &operator () ( const T &t ) const { return t; }
+        };
+
+//  Minimum number of elements in a chunk
+    const std::size_t scan_grain = 1 << 16;
+
+//  The sequential scans, as in transform_inclusive_scan.hpp and
+//  transform_exclusive_scan.hpp (which include this file).
+    template <bool Inclusive, bool HasInit> struct sequential_scan;
+
+    template <> struct sequential_scan<true, true> {
+        template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+        static OutputIterator call ( InputIterator first, InputIterator last, OutputIterator result,
+                                     T init, BinaryOperation bOp, UnaryOperation uOp ) {
+            for ( ; first != last; ++first, (void) ++result ) {
+                init = bOp ( init, uOp ( *first ));
+                *result = init;
+                }
+            return result;
+            }
+        };
+
+    template <> struct sequential_scan<true, false> {
+        template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+        static OutputIterator call ( InputIterator first, InputIterator last, OutputIterator result,
+                                     const T &, BinaryOperation bOp, UnaryOperation uOp ) {
+            if ( first != last ) {
+                T init = uOp ( *first );
+                *result = init;
+                ++result;
+                return sequential_scan<true, true>::call ( ++first, last, result, init, bOp, uOp );
+                }
+            return result;
+            }
+        };
+
+    template <> struct sequential_scan<false, true> {
+        template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+        static OutputIterator call ( InputIterator first, InputIterator last, OutputIterator result,
+                                     T init, BinaryOperation bOp, UnaryOperation uOp ) {
+            for ( ; first != last; ++first, (void) ++result ) {
+                T saved = init;
+                init = bOp ( init, uOp ( *first ));
+                *result = saved;
+                }
+            return result;
+            }
+        };
+
+//  An exclusive scan always has an initial value
+    template <> struct sequential_scan<false, false> : public sequential_scan<false, true> {};
+
+//  Phase 1: reduce chunk 'i' to a single value
+    template <typename RandomIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    struct scan_reduce_chunk {
+        scan_reduce_chunk ( RandomIterator first, std::size_t n, std::size_t chunks, T *sums,
+                            BinaryOperation bOp, UnaryOperation uOp )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), sums_ ( sums ), bOp_ ( bOp ), uOp_ ( uOp ) {}
+
+        void operator () ( std::size_t i ) const {
+            RandomIterator f = first_ + chunk_offset ( i,     chunks_, n_ );
+            RandomIterator l = first_ + chunk_offset ( i + 1, chunks_, n_ );
+            T acc = uOp_ ( *f );
+            for ( ++f; f != l; ++f )
+                acc = bOp_ ( acc, uOp_ ( *f ));
+            sums_ [ i ] = acc;
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        T *sums_;
+        BinaryOperation bOp_;
+        UnaryOperation uOp_;
+        };
+
+//  Phase 3: scan chunk 'i', starting from offsets [ i ]
+    template <bool Inclusive, bool HasInit, typename RandomIterator, typename RandomOutput,
+              typename T, typename BinaryOperation, typename UnaryOperation>
+    struct scan_chunk {
+        scan_chunk ( RandomIterator first, RandomOutput result, std::size_t n, std::size_t chunks,
+                     const T *offsets, BinaryOperation bOp, UnaryOperation uOp )
+            : first_ ( first ), result_ ( result ), n_ ( n ), chunks_ ( chunks ),
+              offsets_ ( offsets ), bOp_ ( bOp ), uOp_ ( uOp ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t f = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t l = chunk_offset ( i + 1, chunks_, n_ );
+        //  Without an initial value, the first chunk starts from its first element
+            if ( i == 0 )
+                sequential_scan<Inclusive, HasInit>::call ( first_ + f, first_ + l, result_ + f, offsets_ [ i ], bOp_, uOp_ );
+            else
+                sequential_scan<Inclusive, true>::call  ( first_ + f, first_ + l, result_ + f, offsets_ [ i ], bOp_, uOp_ );
+            }
+
+    private:
+        RandomIterator first_;
+        RandomOutput result_;
+        std::size_t n_, chunks_;
+        const T *offsets_;
+        BinaryOperation bOp_;
+        UnaryOperation uOp_;
+        };
+
+    template <bool Inclusive, bool HasInit, typename RandomIterator, typename RandomOutput,
+              typename T, typename BinaryOperation, typename UnaryOperation>
+    RandomOutput parallel_scan ( const execution::parallel_policy &policy,
+                                 RandomIterator first, RandomIterator last, RandomOutput result,
+                                 const T &init, BinaryOperation bOp, UnaryOperation uOp,
+                                 boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t chunks = parallel_chunk_count ( policy, n, scan_grain );
+        if ( chunks <= 1 )
+            return sequential_scan<Inclusive, HasInit>::call ( first, last, result, init, bOp, uOp );
+
+    //  'init' is only a placeholder for the values that are about to be
+    //  computed, so T need not be default constructible.
+        std::vector<T> sums ( chunks - 1, init );
+        parallel_run ( chunks - 1, scan_reduce_chunk<RandomIterator, T, BinaryOperation, UnaryOperation>
+                                         ( first, n, chunks, &sums[0], bOp, uOp ));
+
+        std::vector<T> offsets ( chunks, init );
+        for ( std::size_t i = 1; i < chunks; ++i )
+            offsets [ i ] = ( i == 1 && !HasInit ) ? sums [ 0 ] : bOp ( offsets [ i - 1 ], sums [ i - 1 ] );
+
+        parallel_run ( chunks, scan_chunk<Inclusive, HasInit, RandomIterator, RandomOutput, T, BinaryOperation, UnaryOperation>
+                                         ( first, result, n, chunks, &offsets[0], bOp, uOp ));
+        return result + n;
+        }
+
+    template <bool Inclusive, bool HasInit, typename InputIterator, typename OutputIterator,
+              typename T, typename BinaryOperation, typename UnaryOperation>
+    OutputIterator parallel_scan ( const execution::parallel_policy &,
+                                   InputIterator first, InputIterator last, OutputIterator result,
+                                   const T &init, BinaryOperation bOp, UnaryOperation uOp,
+                                   boost::false_type ) {
+        return sequential_scan<Inclusive, HasInit>::call ( first, last, result, init, bOp, uOp );
+        }
+
+    template <typename Iterator>
+    struct scan_is_random_access : public boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category, std::random_access_iterator_tag> {};
+
+    template <bool Inclusive, bool HasInit, typename InputIterator, typename OutputIterator,
+              typename T, typename BinaryOperation, typename UnaryOperation>
+    OutputIterator policy_scan ( const execution::sequenced_policy &,
+                                 InputIterator first, InputIterator last, OutputIterator result,
+                                 const T &init, BinaryOperation bOp, UnaryOperation uOp ) {
+        return sequential_scan<Inclusive, HasInit>::call ( first, last, result, init, bOp, uOp );
+        }
+
+    template <bool Inclusive, bool HasInit, typename InputIterator, typename OutputIterator,
+              typename T, typename BinaryOperation, typename UnaryOperation>
+    OutputIterator policy_scan ( const execution::parallel_policy &policy,
+                                 InputIterator first, InputIterator last, OutputIterator result,
+                                 const T &init, BinaryOperation bOp, UnaryOperation uOp ) {
+        typedef boost::integral_constant<bool,
+            scan_is_random_access<InputIterator>::value && scan_is_random_access<OutputIterator>::value> random_access;
+        return parallel_scan<Inclusive, HasInit> ( policy, first, last, result, init, bOp, uOp, random_access ());
+        }
+
+//  The scans without an initial value start from the first (transformed) element
+    template <typename ExecutionPolicy, typename InputIterator, typename OutputIterator,
+              typename BinaryOperation, typename UnaryOperation>
+    OutputIterator policy_inclusive_scan ( const ExecutionPolicy &policy,
+                                           InputIterator first, InputIterator last, OutputIterator result,
+                                           BinaryOperation bOp, UnaryOperation uOp ) {
+        if ( first == last )
+            return result;
+        const typename std::iterator_traits<InputIterator>::value_type init = uOp ( *first );
+        return policy_scan<true, false> ( policy, first, last, result, init, bOp, uOp );
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_PARALLEL_SCAN_HPP
@@ -0,0 +1,355 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery behind the execution policy versions of sort_subrange,
+    partition_subrange and top_k_copy.
+
+    To find the window [sub_first, sub_last) of a range, a sample of the
+    range is sorted, and two sample values that (very probably) bracket the
+    window are chosen as pivots. The elements are then classified, in
+    parallel, as below the low pivot, between the pivots, or above the high
+    pivot, and moved (through a buffer, again in parallel) so that the three
+    classes are in that order. If the counts show that the window lies in
+    the middle class, only the middle class is left to work on; it is
+    narrowed again while that pays, and then handed to the sequential
+    algorithm. If the sample was unlucky, nothing has been moved, and the
+    sequential algorithm does the whole job.
+
+    top_k_copy keeps a bounded heap of iterators per thread, and merges the
+    heaps at the end; the input is not changed.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_PARALLEL_SELECT_HPP
+#define BOOST_ALGORITHM_DETAIL_PARALLEL_SELECT_HPP
+
+#include <algorithm>    // for std::sort, std::make_heap and friends
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::iterator_traits
+#include <memory>       // for std::allocator
+#include <new>          // for placement new
+#include <utility>      // for std::pair
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_nothrow_move_assignable.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/move.hpp>
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  Minimum number of elements in a chunk
+    const std::size_t select_grain = 1 << 15;
+
+//  Number of samples taken per chunk
+    const std::size_t select_samples = 1024;
+
+//  The elements are moved to a buffer and back; that must not throw
+//  half way through.
+    template <typename T>
+    struct select_can_relocate : public boost::integral_constant<bool,
+        boost::is_nothrow_move_constructible<T>::value && boost::is_nothrow_move_assignable<T>::value> {};
+
+//  Compare the elements at two offsets
+    template <typename RandomIterator, typename Pred>
+    struct select_offset_less {
+        select_offset_less ( RandomIterator first, Pred p ) : first_ ( first ), p_ ( p ) {}
+        bool operator () ( std::size_t a, std::size_t b ) { return p_ ( first_ [ a ], first_ [ b ] ); }
+    private:
+        RandomIterator first_;
+        Pred p_;
+        };
+
+//  Compare the elements that two iterators refer to
+    template <typename Iterator, typename Pred>
+    struct select_iterator_less {
+        select_iterator_less ( Pred p ) : p_ ( p ) {}
+        bool operator () ( const Iterator &a, const Iterator &b ) { return p_ ( *a, *b ); }
+    private:
+        Pred p_;
+        };
+
+//  Classify the elements of chunk 'i': 0 if below the low pivot, 2 if above
+//  the high one, and 1 otherwise.
+    template <typename RandomIterator, typename Pred>
+    struct select_classify {
+        select_classify ( RandomIterator first, std::size_t n, std::size_t chunks,
+                          const RandomIterator *lo, const RandomIterator *hi,
+                          unsigned char *classes, std::size_t *counts, Pred p )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), lo_ ( lo ), hi_ ( hi ),
+              classes_ ( classes ), counts_ ( counts ), p_ ( p ) {}
+
+        void operator () ( std::size_t i ) const {
+            Pred p ( p_ );  // each thread gets its own copy
+            const std::size_t f = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t l = chunk_offset ( i + 1, chunks_, n_ );
+            std::size_t counts [ 3 ] = { 0, 0, 0 };
+            for ( std::size_t k = f; k < l; ++k ) {
+                const unsigned char c = ( lo_ && p ( first_ [ k ], **lo_ )) ? 0
+                                      : ( hi_ && p ( **hi_, first_ [ k ] )) ? 2 : 1;
+                classes_ [ k ] = c;
+                ++counts [ c ];
+                }
+            for ( int c = 0; c < 3; ++c )
+                counts_ [ 3 * i + c ] = counts [ c ];
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        const RandomIterator *lo_, *hi_;
+        unsigned char *classes_;
+        std::size_t *counts_;
+        Pred p_;
+        };
+
+//  Move the elements of chunk 'i' into the buffer, each class to its place
+    template <typename RandomIterator, typename T>
+    struct select_scatter {
+        select_scatter ( RandomIterator first, std::size_t n, std::size_t chunks,
+                         const unsigned char *classes, const std::size_t *offsets, T *buffer )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), classes_ ( classes ), offsets_ ( offsets ), buffer_ ( buffer ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t f = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t l = chunk_offset ( i + 1, chunks_, n_ );
+            std::size_t next [ 3 ] = { offsets_ [ 3 * i ], offsets_ [ 3 * i + 1 ], offsets_ [ 3 * i + 2 ] };
+            for ( std::size_t k = f; k < l; ++k )
+                ::new ( static_cast<void *> ( buffer_ + next [ classes_ [ k ]]++ )) T ( move_value ( first_ [ k ] ));
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        const unsigned char *classes_;
+        const std::size_t *offsets_;
+        T *buffer_;
+        };
+
+//  Move chunk 'i' of the buffer back
+    template <typename RandomIterator, typename T>
+    struct select_gather {
+        select_gather ( RandomIterator first, std::size_t n, std::size_t chunks, T *buffer )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), buffer_ ( buffer ) {}
+
+        void operator () ( std::size_t i ) const {
+            const std::size_t f = chunk_offset ( i,     chunks_, n_ );
+            const std::size_t l = chunk_offset ( i + 1, chunks_, n_ );
+            for ( std::size_t k = f; k < l; ++k ) {
+                first_ [ k ] = move_value ( buffer_ [ k ] );
+                buffer_ [ k ].~T ();
+                }
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_;
+        T *buffer_;
+        };
+
+//  One round of narrowing [first, last) around [sub_first, sub_last).
+//  Returns false (having moved nothing) if the range can't be narrowed.
+    template <typename RandomIterator, typename Pred>
+    bool select_narrow ( const execution::parallel_policy &policy,
+                         RandomIterator &first, RandomIterator &last,
+                         RandomIterator sub_first, RandomIterator sub_last, Pred p ) {
+        typedef typename std::iterator_traits<RandomIterator>::value_type T;
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t chunks = parallel_chunk_count ( policy, n, select_grain );
+        if ( chunks <= 1 )
+            return false;
+
+    //  Sort a sample (of offsets), one from each stretch of the range at a
+    //  scattered position, so that regular patterns in the data don't matter.
+        const std::size_t m = select_samples * chunks;
+        std::vector<std::size_t> samples ( m );
+        for ( std::size_t j = 0; j < m; ++j ) {
+            const std::size_t s = chunk_offset ( j, m, n ), e = chunk_offset ( j + 1, m, n );
+            samples [ j ] = s + ( j * 2654435761u ) % ( e - s );
+            }
+        std::sort ( samples.begin (), samples.end (), select_offset_less<RandomIterator, Pred> ( first, p ));
+
+    //  The window's place in the sample, widened by about four standard deviations
+        std::size_t margin = 2;
+        while ( margin * margin < 16 * m )
+            ++margin;
+        const double scale = static_cast<double> ( m ) / static_cast<double> ( n );
+        const std::size_t lo_rank = static_cast<std::size_t> ( static_cast<double> ( sub_first - first ) * scale );
+        const std::size_t hi_rank = static_cast<std::size_t> ( static_cast<double> ( sub_last  - first ) * scale ) + 1;
+        RandomIterator lo_pivot = first, hi_pivot = first;
+        const RandomIterator *lo = NULL, *hi = NULL;
+        if ( sub_first != first && lo_rank > margin ) {
+            lo_pivot = first + samples [ lo_rank - margin ];
+            lo = &lo_pivot;
+            }
+        if ( sub_last != last && hi_rank + margin < m ) {
+            hi_pivot = first + samples [ hi_rank + margin ];
+            hi = &hi_pivot;
+            }
+        if ( lo == NULL && hi == NULL )
+            return false;
+
+        std::vector<unsigned char> classes ( n );
+        std::vector<std::size_t> offsets ( 3 * chunks );
+        parallel_run ( chunks, select_classify<RandomIterator, Pred> ( first, n, chunks, lo, hi, &classes [ 0 ], &offsets [ 0 ], p ));
+
+    //  Turn the counts into the offsets in the buffer where each chunk puts each class
+        std::size_t total = 0;
+        for ( int c = 0; c < 3; ++c )
+            for ( std::size_t i = 0; i < chunks; ++i ) {
+                const std::size_t count = offsets [ 3 * i + c ];
+                offsets [ 3 * i + c ] = total;
+                total += count;
+                }
+        const std::size_t below = offsets [ 1 ];
+        const std::size_t above = offsets [ 2 ];
+        if ( below > static_cast<std::size_t> ( sub_first - first )
+                || above < static_cast<std::size_t> ( sub_last - first )
+                || ( below == 0 && above == n ))
+            return false;
+
+        std::allocator<T> alloc;
+        T *buffer = alloc.allocate ( n );
+        parallel_run ( chunks, select_scatter<RandomIterator, T> ( first, n, chunks, &classes [ 0 ], &offsets [ 0 ], buffer ));
+        parallel_run ( chunks, select_gather<RandomIterator, T> ( first, n, chunks, buffer ));
+        alloc.deallocate ( buffer, n );
+
+        last = first + above;
+        first = first + below;
+        return true;
+        }
+
+//  Narrow [first, last) around [sub_first, sub_last) as far as is worthwhile.
+//  Afterwards, everything before 'first' belongs before the window, and
+//  everything after 'last' belongs after it.
+    template <typename RandomIterator, typename Pred>
+    void select_window ( const execution::parallel_policy &policy,
+                         RandomIterator &first, RandomIterator &last,
+                         RandomIterator sub_first, RandomIterator sub_last, Pred p, boost::true_type ) {
+        for ( ;; ) {
+            const std::size_t n = static_cast<std::size_t> ( last - first );
+            if ( !select_narrow ( policy, first, last, sub_first, sub_last, p ))
+                return;
+        //  Another round only pays if this one removed at least half
+            if ( static_cast<std::size_t> ( last - first ) * 2 > n )
+                return;
+            }
+        }
+
+    template <typename RandomIterator, typename Pred>
+    void select_window ( const execution::parallel_policy &,
+                         RandomIterator &, RandomIterator &,
+                         RandomIterator, RandomIterator, Pred, boost::false_type ) {}
+
+    template <typename RandomIterator, typename Pred>
+    void select_window ( const execution::sequenced_policy &,
+                         RandomIterator &, RandomIterator &,
+                         RandomIterator, RandomIterator, Pred ) {}
+
+    template <typename RandomIterator, typename Pred>
+    void select_window ( const execution::parallel_policy &policy,
+                         RandomIterator &first, RandomIterator &last,
+                         RandomIterator sub_first, RandomIterator sub_last, Pred p ) {
+        typedef typename std::iterator_traits<RandomIterator>::value_type T;
+        select_window ( policy, first, last, sub_first, sub_last, p, select_can_relocate<T> ());
+        }
+
+//  Keep the k smallest elements of chunk 'i' in a heap of iterators
+    template <typename RandomIterator, typename Pred>
+    struct top_k_chunk {
+        top_k_chunk ( RandomIterator first, std::size_t n, std::size_t chunks, std::size_t k,
+                      RandomIterator *heaps, std::size_t *sizes, Pred p )
+            : first_ ( first ), n_ ( n ), chunks_ ( chunks ), k_ ( k ), heaps_ ( heaps ), sizes_ ( sizes ), p_ ( p ) {}
+
+        void operator () ( std::size_t i ) const {
+            Pred p ( p_ );
+            select_iterator_less<RandomIterator, Pred> less ( p );
+            RandomIterator it   = first_ + chunk_offset ( i,     chunks_, n_ );
+            RandomIterator last = first_ + chunk_offset ( i + 1, chunks_, n_ );
+            RandomIterator *heap = heaps_ + i * k_;
+            std::size_t size = 0;
+            for ( ; it != last && size < k_; ++it )
+                heap [ size++ ] = it;
+            std::make_heap ( heap, heap + size, less );
+            for ( ; it != last; ++it )
+                if ( p ( *it, *heap [ 0 ] )) {
+                    std::pop_heap ( heap, heap + size, less );
+                    heap [ size - 1 ] = it;
+                    std::push_heap ( heap, heap + size, less );
+                    }
+            sizes_ [ i ] = size;
+            }
+
+    private:
+        RandomIterator first_;
+        std::size_t n_, chunks_, k_;
+        RandomIterator *heaps_;
+        std::size_t *sizes_;
+        Pred p_;
+        };
+
+    template <typename InputIterator, typename RandomOutput, typename Pred>
+    RandomOutput parallel_top_k_copy ( const execution::parallel_policy &,
+                                       InputIterator first, InputIterator last,
+                                       RandomOutput result_first, RandomOutput result_last,
+                                       Pred p, boost::false_type ) {
+        return std::partial_sort_copy ( first, last, result_first, result_last, p );
+        }
+
+    template <typename RandomIterator, typename RandomOutput, typename Pred>
+    RandomOutput parallel_top_k_copy ( const execution::parallel_policy &policy,
+                                       RandomIterator first, RandomIterator last,
+                                       RandomOutput result_first, RandomOutput result_last,
+                                       Pred p, boost::true_type ) {
+        const std::size_t n = static_cast<std::size_t> ( last - first );
+        const std::size_t k = static_cast<std::size_t> ( result_last - result_first );
+        const std::size_t chunks = parallel_chunk_count ( policy, n, select_grain );
+    //  The heaps only pay if each chunk throws most of its elements away
+        if ( chunks <= 1 || k == 0 || k > n / ( 4 * chunks ))
+            return std::partial_sort_copy ( first, last, result_first, result_last, p );
+
+        std::vector<RandomIterator> heaps ( chunks * k );
+        std::vector<std::size_t> sizes ( chunks );
+        parallel_run ( chunks, top_k_chunk<RandomIterator, Pred> ( first, n, chunks, k, &heaps [ 0 ], &sizes [ 0 ], p ));
+
+    //  Every chunk is bigger than k, so every heap is full
+        std::partial_sort ( heaps.begin (), heaps.begin () + k, heaps.end (), select_iterator_less<RandomIterator, Pred> ( p ));
+        for ( std::size_t i = 0; i < k; ++i, ++result_first )
+            *result_first = *heaps [ i ];
+        return result_first;
+        }
+
+    template <typename Iterator>
+    struct select_is_random_access : public boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category, std::random_access_iterator_tag> {};
+
+    template <typename InputIterator, typename RandomOutput, typename Pred>
+    RandomOutput policy_top_k_copy ( const execution::sequenced_policy &,
+                                     InputIterator first, InputIterator last,
+                                     RandomOutput result_first, RandomOutput result_last, Pred p ) {
+        return std::partial_sort_copy ( first, last, result_first, result_last, p );
+        }
+
+    template <typename InputIterator, typename RandomOutput, typename Pred>
+    RandomOutput policy_top_k_copy ( const execution::parallel_policy &policy,
+                                     InputIterator first, InputIterator last,
+                                     RandomOutput result_first, RandomOutput result_last, Pred p ) {
+        return parallel_top_k_copy ( policy, first, last, result_first, result_last, p,
+                                     select_is_random_access<InputIterator> ());
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_PARALLEL_SELECT_HPP
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    Modular exponentiation for power_mod.
+
+    Moduli that fit in 32 bits are worked on in 64 bit arithmetic, where a
+    product can't overflow. Larger odd moduli use Montgomery multiplication,
+    which needs the full 128 bit product of two 64 bit values but never
+    divides by the modulus. Larger even moduli (rare, in practice) reduce the
+    128 bit product directly where the compiler has a 128 bit type, and add
+    and double otherwise.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_POWER_MOD_HPP
+#define BOOST_ALGORITHM_DETAIL_POWER_MOD_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(BOOST_HAS_INT128)
+#include <intrin.h>     // for _umul128
+#endif
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+//  The 128 bit product of a and b, as two 64 bit halves
+    inline boost::uint64_t mul_128 ( boost::uint64_t a, boost::uint64_t b, boost::uint64_t &hi ) {
+#if defined(BOOST_HAS_INT128)
+        const boost::uint128_type p = static_cast<boost::uint128_type> ( a ) * b;
+        hi = static_cast<boost::uint64_t> ( p >> 64 );
+        return static_cast<boost::uint64_t> ( p );
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return _umul128 ( a, b, &hi );
+#else
+        const boost::uint64_t mask = 0xFFFFFFFFu;
+        const boost::uint64_t a_lo = a & mask, a_hi = a >> 32, b_lo = b & mask, b_hi = b >> 32;
+        const boost::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+        const boost::uint64_t mid = ( ll >> 32 ) + ( lh & mask ) + ( hl & mask );
+        hi = hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 );
+        return ( mid << 32 ) | ( ll & mask );
+#endif
+        }
+
+//  ( a + b ) mod m, for a, b < m
+    inline boost::uint64_t add_mod ( boost::uint64_t a, boost::uint64_t b, boost::uint64_t m ) {
+        const boost::uint64_t s = a + b;
+        return ( s < a || s >= m ) ? s - m : s;
+        }
+
+//  Montgomery arithmetic modulo an odd m, with R = 2^64
+    class montgomery_64 {
+    public:
+        explicit montgomery_64 ( boost::uint64_t m ) : m_ ( m ), inv_ ( m ), r2_ ( 0 ) {
+        //  m * inv == 1 mod 2^64, by Newton's iteration (each step doubles the
+        //  number of correct bits, and m is its own inverse mod 8)
+            for ( int i = 0; i < 5; ++i )
+                inv_ *= 2 - m * inv_;
+        //  R^2 mod m, by doubling R mod m 64 times
+            r2_ = ( 0 - m ) % m;
+            for ( int i = 0; i < 64; ++i )
+                r2_ = add_mod ( r2_, r2_, m );
+            }
+
+    //  t / R mod m, for t = hi * 2^64 + lo < m * R. With q = lo * inv mod R,
+    //  t - q * m is a multiple of R, and ( t - q * m ) / R is in ( -m, m ).
+        boost::uint64_t reduce ( boost::uint64_t hi, boost::uint64_t lo ) const {
+            boost::uint64_t qm_hi;
+            (void) mul_128 ( lo * inv_, m_, qm_hi );
+            const boost::uint64_t r = hi - qm_hi;
+            return hi < qm_hi ? r + m_ : r;
+            }
+
+        boost::uint64_t multiply ( boost::uint64_t a, boost::uint64_t b ) const {
+            boost::uint64_t hi;
+            const boost::uint64_t lo = mul_128 ( a, b, hi );
+            return reduce ( hi, lo );
+            }
+
+        boost::uint64_t to_montgomery   ( boost::uint64_t a ) const { return multiply ( a, r2_ ); }
+        boost::uint64_t from_montgomery ( boost::uint64_t a ) const { return reduce ( 0, a ); }
+
+    private:
+        boost::uint64_t m_, inv_, r2_;
+        };
+
+//  a * b mod m, for a, b < m, for any m
+    inline boost::uint64_t mul_mod ( boost::uint64_t a, boost::uint64_t b, boost::uint64_t m ) {
+#if defined(BOOST_HAS_INT128)
+        return static_cast<boost::uint64_t> ( static_cast<boost::uint128_type> ( a ) * b % m );
+#else
+        boost::uint64_t result = 0;
+        for ( ; b != 0; b >>= 1 ) {
+            if ( b & 1 )
+                result = add_mod ( result, a, m );
+            a = add_mod ( a, a, m );
+            }
+        return result;
+#endif
+        }
+
+//  The exponentiations: x < m, m > 1, and n > 0
+    template <typename Integer>
+    boost::uint64_t power_mod_32 ( boost::uint64_t x, Integer n, boost::uint64_t m ) {
+        boost::uint64_t y = 1;
+        for ( ;; ) {
+            if ( n % 2 == 1 )
+                y = y * x % m;
+            n = n / 2;
+            if ( n == 0 )
+                return y;
+            x = x * x % m;
+            }
+        }
+
+    template <typename Integer>
+    boost::uint64_t power_mod_montgomery ( boost::uint64_t x, Integer n, boost::uint64_t m ) {
+        const montgomery_64 mont ( m );
+        boost::uint64_t y = mont.to_montgomery ( 1 );
+        x = mont.to_montgomery ( x );
+        for ( ;; ) {
+            if ( n % 2 == 1 )
+                y = mont.multiply ( y, x );
+            n = n / 2;
+            if ( n == 0 )
+                return mont.from_montgomery ( y );
+            x = mont.multiply ( x, x );
+            }
+        }
+
+    template <typename Integer>
+    boost::uint64_t power_mod_64 ( boost::uint64_t x, Integer n, boost::uint64_t m ) {
+        boost::uint64_t y = 1;
+        for ( ;; ) {
+            if ( n % 2 == 1 )
+                y = mul_mod ( y, x, m );
+            n = n / 2;
+            if ( n == 0 )
+                return y;
+            x = mul_mod ( x, x, m );
+            }
+        }
+
+    template <typename Integer>
+    boost::uint64_t power_mod ( boost::uint64_t x, Integer n, boost::uint64_t m ) {
+        if ( m == 1 )
+            return 0;
+        x %= m;
+        if ( n == 0 )
+            return 1;
+        if ( m <= 0xFFFFFFFFu )
+            return power_mod_32 ( x, n, m );
+        if ( m % 2 == 1 )
+            return power_mod_montgomery ( x, n, m );
+        return power_mod_64 ( x, n, m );
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_POWER_MOD_HPP
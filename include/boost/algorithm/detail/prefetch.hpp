@@ -0,0 +1,28 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    BOOST_ALGORITHM_PREFETCH(p) hints that the memory at address 'p' will be
+    read soon. It never faults, so 'p' may point anywhere, and it does
+    nothing on compilers that don't support it.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_PREFETCH_HPP
+#define BOOST_ALGORITHM_DETAIL_PREFETCH_HPP
+
+#include <boost/config.hpp>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BOOST_ALGORITHM_PREFETCH(p) __builtin_prefetch(static_cast<const void *>(p))
+#elif defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#define BOOST_ALGORITHM_PREFETCH(p) _mm_prefetch(reinterpret_cast<const char *>(p), _MM_HINT_T0)
+#else
+#define BOOST_ALGORITHM_PREFETCH(p) ((void)0)
+#endif
+
+#endif  // BOOST_ALGORITHM_DETAIL_PREFETCH_HPP
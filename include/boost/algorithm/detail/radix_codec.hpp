@@ -0,0 +1,267 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/*
+    The machinery shared by the base64 and base32 codecs.
+
+    Both turn groups of 8-bit values into groups of characters, each character
+    holding 'bits' bits of the input. A Codec describes the shape:
+        bits        - the number of bits per character
+        group_bytes - the number of input values in a whole group
+        group_chars - the number of characters in a whole group
+        bad_input   - the exception thrown for a character not in the alphabet,
+                      or for a value that does not fit in 8 bits
+        alphabet ( flags ), values ( flags )
+                    - the characters, and the value of each character (-1 for
+                      the ones not in the alphabet), for the selected alphabet
+
+    The flags of every codec use the same bits: radix_alternate selects the
+    second alphabet, and radix_no_padding turns off the '=' padding.
+*/
+
+#ifndef BOOST_ALGORITHM_DETAIL_RADIX_CODEC_HPP
+#define BOOST_ALGORITHM_DETAIL_RADIX_CODEC_HPP
+
+#include <cstddef>      // for std::size_t
+#include <iterator>     // for std::back_inserter
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+#include <boost/algorithm/hex.hpp>  // for hex_iterator_traits and the exceptions
+
+/// \cond DOXYGEN_HIDE
+
+namespace boost { namespace algorithm { namespace detail {
+
+    const int radix_alternate  = 1;
+    const int radix_no_padding = 2;
+
+    inline bool radix_padded ( int flags ) {
+        return ( flags & radix_no_padding ) == 0;
+        }
+
+    template <typename T>
+    int radix_digit_value ( const signed char *table, T val ) {
+        typedef typename boost::make_unsigned<T>::type U;
+        const U u = static_cast<U> ( val );
+        return u > 0xFF ? -1 : table [ u ];
+        }
+
+//  The 8-bit value to encode; more than 0xFF if 'val' doesn't fit in 8 bits.
+//  Values one byte wide (including negative chars) are taken as they are.
+    template <typename T>
+    unsigned radix_byte_value ( T val, boost::true_type /* one byte */ ) {
+        return static_cast<unsigned char> ( val );
+        }
+
+    template <typename T>
+    boost::uintmax_t radix_byte_value ( T val, boost::false_type /* one byte */ ) {
+        return ( val & ~static_cast<T> ( 0xFF )) != 0 ? 0x100 : static_cast<boost::uintmax_t> ( val );
+        }
+
+    template <typename T>
+    boost::uintmax_t radix_byte_value ( T val ) {
+        return radix_byte_value ( val, boost::integral_constant<bool, sizeof ( T ) == 1> ());
+        }
+
+//  Can the last group of an encoding be 'n' characters long?
+//  (Some lengths would leave whole characters unused.)
+    template <typename Codec>
+    bool radix_valid_tail ( std::size_t n ) {
+        const std::size_t bytes = n * Codec::bits / 8;
+        return ( bytes * 8 + Codec::bits - 1 ) / Codec::bits == n;
+        }
+
+    template <typename Codec>
+    BOOST_CONSTEXPR std::size_t radix_encoded_size ( std::size_t n, int flags ) {
+        return ( flags & radix_no_padding ) == 0
+            ? Codec::group_chars * (( n + Codec::group_bytes - 1 ) / Codec::group_bytes )
+            : ( n * 8 + Codec::bits - 1 ) / Codec::bits;
+        }
+
+    template <typename Codec>
+    BOOST_CONSTEXPR std::size_t radix_decoded_size ( std::size_t n ) {
+        return n * Codec::bits / 8;
+        }
+
+    template <typename Codec, typename InputIterator, typename OutputIterator, typename EndPred>
+    OutputIterator radix_encode ( InputIterator first, InputIterator last, OutputIterator out,
+                                  int flags, EndPred pred ) {
+        const char *alphabet = Codec::alphabet ( flags );
+        const unsigned mask = ( 1u << Codec::bits ) - 1;
+        unsigned acc = 0;
+        std::size_t bits = 0, chars = 0;
+
+        for ( ; !pred ( first, last ); ++first ) {
+            const boost::uintmax_t byte = radix_byte_value ( *first );
+            if ( byte > 0xFF )
+                BOOST_THROW_EXCEPTION ( typename Codec::bad_input ());
+            acc = ( acc << 8 ) | static_cast<unsigned> ( byte );
+            bits += 8;
+            while ( bits >= Codec::bits ) {
+                bits -= Codec::bits;
+                *out = alphabet [ ( acc >> bits ) & mask ];
+                ++out; ++chars;
+                }
+            acc &= ( 1u << bits ) - 1;
+            }
+
+        if ( bits > 0 ) {
+            *out = alphabet [ ( acc << ( Codec::bits - bits )) & mask ];
+            ++out; ++chars;
+            }
+        if ( radix_padded ( flags ))
+            for ( ; chars % Codec::group_chars != 0; ++chars ) {
+                *out = '=';
+                ++out;
+                }
+        return out;
+        }
+
+    template <typename Codec, typename InputIterator, typename OutputIterator, typename EndPred>
+    typename boost::enable_if<boost::is_integral<typename hex_iterator_traits<OutputIterator>::value_type>, OutputIterator>::type
+    radix_decode ( InputIterator first, InputIterator last, OutputIterator out,
+                   int flags, EndPred pred ) {
+        typedef typename hex_iterator_traits<OutputIterator>::value_type T;
+        const signed char *table = Codec::values ( flags );
+        const bool padded = radix_padded ( flags );
+        unsigned long acc = 0;
+        std::size_t bits = 0, chars = 0;
+
+        for ( ; !pred ( first, last ); ++first ) {
+            if ( padded && *first == '=' )
+                break;
+            const int digit = radix_digit_value ( table, *first );
+            if ( digit < 0 )
+                BOOST_THROW_EXCEPTION ( typename Codec::bad_input () << bad_char ( static_cast<char> ( *first )));
+            acc = ( acc << Codec::bits ) | static_cast<unsigned long> ( digit );
+            bits += Codec::bits;
+            ++chars;
+            if ( bits >= 8 ) {
+                bits -= 8;
+                *out = static_cast<T> (( acc >> bits ) & 0xFF );
+                ++out;
+                acc &= ( 1ul << bits ) - 1;
+                }
+            }
+
+        const std::size_t tail = chars % Codec::group_chars;
+        if ( !radix_valid_tail<Codec> ( tail )) {
+            if ( pred ( first, last ))
+                BOOST_THROW_EXCEPTION ( not_enough_input ());
+            BOOST_THROW_EXCEPTION ( typename Codec::bad_input () << bad_char ( static_cast<char> ( *first )));
+            }
+
+    //  Padding fills out the last group, and nothing may follow it
+        if ( padded ) {
+            if ( tail != 0 )
+                for ( std::size_t i = tail; i < Codec::group_chars; ++i, ++first ) {
+                    if ( pred ( first, last ))
+                        BOOST_THROW_EXCEPTION ( not_enough_input ());
+                    if ( *first != '=' )
+                        BOOST_THROW_EXCEPTION ( typename Codec::bad_input () << bad_char ( static_cast<char> ( *first )));
+                    }
+            if ( !pred ( first, last ))
+                BOOST_THROW_EXCEPTION ( typename Codec::bad_input () << bad_char ( static_cast<char> ( *first )));
+            }
+        return out;
+        }
+
+    template <typename Codec, typename Range, typename OutputIterator>
+    OutputIterator radix_encode_range ( const Range &r, OutputIterator out, int flags ) {
+        return radix_encode<Codec> ( boost::begin ( r ), boost::end ( r ), out, flags,
+                                     iter_end<typename Range::const_iterator> );
+        }
+
+    template <typename Codec, typename Range, typename OutputIterator>
+    OutputIterator radix_decode_range ( const Range &r, OutputIterator out, int flags ) {
+        return radix_decode<Codec> ( boost::begin ( r ), boost::end ( r ), out, flags,
+                                     iter_end<typename Range::const_iterator> );
+        }
+
+    template <typename Codec, typename String>
+    String radix_encode_string ( const String &input, int flags ) {
+        String output;
+        output.reserve ( radix_encoded_size<Codec> ( input.size (), flags ));
+        (void) radix_encode_range<Codec> ( input, std::back_inserter ( output ), flags );
+        return output;
+        }
+
+    template <typename Codec, typename String>
+    String radix_decode_string ( const String &input, int flags ) {
+        String output;
+        output.reserve ( radix_decoded_size<Codec> ( input.size ()));
+        (void) radix_decode_range<Codec> ( input, std::back_inserter ( output ), flags );
+        return output;
+        }
+
+//  The buffer versions work a whole group at a time, with no checks for the
+//  end of the input inside a group. Whatever is left over, or a group with
+//  a bad value, goes through the general versions above.
+    template <typename Codec, typename T, typename CharT>
+    CharT *radix_encode_buffer ( const T *first, std::size_t n, CharT *out, int flags ) {
+        const char *alphabet = Codec::alphabet ( flags );
+        const boost::uint64_t mask = ( 1u << Codec::bits ) - 1;
+        const std::size_t body = n - n % Codec::group_bytes;
+
+        std::size_t i = 0;
+        for ( ; i < body; i += Codec::group_bytes, out += Codec::group_chars ) {
+            boost::uint64_t acc = 0;
+            boost::uintmax_t bad = 0;
+            for ( std::size_t j = 0; j < Codec::group_bytes; ++j ) {
+                const boost::uintmax_t byte = radix_byte_value ( first [ i + j ] );
+                bad |= byte;
+                acc = ( acc << 8 ) | ( byte & 0xFF );
+                }
+            if ( bad > 0xFF )
+                break;
+            for ( std::size_t j = 0; j < Codec::group_chars; ++j )
+                out [ j ] = alphabet [ ( acc >> ( Codec::bits * ( Codec::group_chars - 1 - j ))) & mask ];
+            }
+        return radix_encode<Codec> ( first + i, first + n, out, flags, iter_end<const T *> );
+        }
+
+    template <typename Codec, typename CharT, typename T>
+    T *radix_decode_buffer ( const CharT *first, std::size_t n, T *out, int flags ) {
+        const signed char *table = Codec::values ( flags );
+        const boost::uint64_t mask = ( 1u << Codec::bits ) - 1;
+        std::size_t body = n - n % Codec::group_chars;
+    //  The last whole group may contain padding
+        if ( radix_padded ( flags ) && body == n && body > 0 )
+            body -= Codec::group_chars;
+
+        std::size_t i = 0;
+        for ( ; i < body; i += Codec::group_chars, out += Codec::group_bytes ) {
+            boost::uint64_t acc = 0;
+            int bad = 0;
+            for ( std::size_t j = 0; j < Codec::group_chars; ++j ) {
+                const int digit = radix_digit_value ( table, first [ i + j ] );
+                bad |= digit;
+                acc = ( acc << Codec::bits ) | ( static_cast<boost::uint64_t> ( digit ) & mask );
+                }
+        //  Let the general version find (and report) the bad character
+            if ( bad < 0 )
+                break;
+            for ( std::size_t j = 0; j < Codec::group_bytes; ++j )
+                out [ j ] = static_cast<T> (( acc >> ( 8 * ( Codec::group_bytes - 1 - j ))) & 0xFF );
+            }
+        return radix_decode<Codec> ( first + i, first + n, out, flags, iter_end<const CharT *> );
+        }
+
+}}}
+
+/// \endcond
+
+#endif  // BOOST_ALGORITHM_DETAIL_RADIX_CODEC_HPP
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/// \file  execution.hpp
+/// \brief Execution policies for the parallel overloads of the algorithms.
+/// \author agent
+
+/*
+    The algorithms that have parallel versions take a policy as their first
+    argument, in the style of C++17:
+
+        boost::minmax_element ( boost::algorithm::execution::par, first, last );
+        boost::minmax_element ( boost::algorithm::execution::par ( 4 ), first, last );
+
+    The work is split into contiguous chunks, which are processed on separate
+    threads and then combined in order, so the results are the same as the
+    sequential versions.
+
+    When the standard library does not provide <thread> (or when
+    BOOST_ALGORITHM_NO_THREADS is defined) the chunks are processed one after
+    another on the calling thread.
+*/
+
+#ifndef BOOST_ALGORITHM_EXECUTION_HPP
+#define BOOST_ALGORITHM_EXECUTION_HPP
+
+#include <cstddef>      // for std::size_t
+
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#if !defined(BOOST_ALGORITHM_NO_THREADS) && \
+    ( defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_HDR_EXCEPTION))
+#define BOOST_ALGORITHM_NO_THREADS
+#endif
+
+#ifndef BOOST_ALGORITHM_NO_THREADS
+#include <exception>
+#include <functional>   // for std::ref
+#include <thread>
+#include <vector>
+#endif
+
+namespace boost { namespace algorithm { namespace execution {
+
+/// \struct sequenced_policy
+/// \brief  Run the algorithm on the calling thread.
+struct sequenced_policy {};
+
+/// \struct parallel_policy
+/// \brief  Split the algorithm across a number of threads.
+///         A thread count of zero means "as many as the hardware supports".
+struct parallel_policy {
+    BOOST_CONSTEXPR parallel_policy () : threads_ ( 0 ) {}
+    BOOST_CONSTEXPR explicit parallel_policy ( std::size_t threads ) : threads_ ( threads ) {}
+
+    /// \brief Returns a policy that uses 'threads' threads.
+    BOOST_CONSTEXPR parallel_policy operator () ( std::size_t threads ) const { return parallel_policy ( threads ); }
+
+    /// \brief The number of threads to use.
+    std::size_t threads () const {
+#ifndef BOOST_ALGORITHM_NO_THREADS
+        if ( threads_ == 0 ) {
+            const std::size_t hw = std::thread::hardware_concurrency ();
+            return hw == 0 ? 1 : hw;
+            }
+#endif
+        return threads_ == 0 ? 1 : threads_;
+        }
+
+private:
+    std::size_t threads_;
+    };
+
+BOOST_CONSTEXPR_OR_CONST sequenced_policy seq = sequenced_policy ();
+BOOST_CONSTEXPR_OR_CONST parallel_policy  par = parallel_policy ();
+
+}
+
+/// \struct is_execution_policy
+/// \brief  Whether T is one of the execution policies; used to tell the
+///         policy overloads apart from the others.
+template <typename T> struct is_execution_policy : public boost::false_type {};
+template <> struct is_execution_policy<execution::sequenced_policy> : public boost::true_type {};
+template <> struct is_execution_policy<execution::parallel_policy>  : public boost::true_type {};
+
+}}
+
+namespace boost { namespace algorithm { namespace detail {
+/// \cond DOXYGEN_HIDE
+
+//  How many chunks should 'n' elements be split into, given that a chunk
+//  should have at least 'grain' elements to be worth a thread?
+    inline std::size_t parallel_chunk_count ( const execution::parallel_policy &policy, std::size_t n, std::size_t grain ) {
+        const std::size_t threads = policy.threads ();
+        const std::size_t most = grain == 0 ? n : n / grain;
+        if ( most <= 1 )
+            return 1;
+        return most < threads ? most : threads;
+        }
+
+//  The offset of the start of chunk 'i' when 'n' elements are split into
+//  'chunks' nearly equal pieces. chunk_offset ( chunks, chunks, n ) == n.
+    inline std::size_t chunk_offset ( std::size_t i, std::size_t chunks, std::size_t n ) {
+        const std::size_t rem = n % chunks;
+        return ( n / chunks ) * i + ( i < rem ? i : rem );
+        }
+
+//  Call f ( i ) for each i in [0, chunks), concurrently.
+//  The calling thread does the last chunk. If any call throws, the first
+//  exception (by chunk number) is rethrown once all the threads have finished.
+    template <typename Function>
+    void parallel_run ( std::size_t chunks, Function f ) {
+#ifdef BOOST_ALGORITHM_NO_THREADS
+        for ( std::size_t i = 0; i < chunks; ++i )
+            f ( i );
+#else
+        if ( chunks <= 1 ) {
+            if ( chunks == 1 )
+                f ( 0 );
+            return;
+            }
+
+        struct runner {
+            static void run ( Function &f, std::size_t i, std::exception_ptr &err ) {
+                try { f ( i ); }
+                catch ( ... ) { err = std::current_exception (); }
+                }
+            };
+
+        std::vector<std::exception_ptr> errors ( chunks );
+        std::vector<std::thread> threads;
+        threads.reserve ( chunks - 1 );
+        try {
+            for ( std::size_t i = 0; i + 1 < chunks; ++i )
+                threads.push_back ( std::thread ( &runner::run, std::ref ( f ), i, std::ref ( errors [ i ] )));
+            }
+        catch ( ... ) {
+        //  Couldn't start a thread; do the rest here.
+            for ( std::size_t i = threads.size (); i + 1 < chunks; ++i )
+                runner::run ( f, i, errors [ i ] );
+            }
+        runner::run ( f, chunks - 1, errors [ chunks - 1 ] );
+
+        for ( std::size_t i = 0; i < threads.size (); ++i )
+            threads [ i ].join ();
+        for ( std::size_t i = 0; i < chunks; ++i )
+            if ( errors [ i ] )
+                std::rethrow_exception ( errors [ i ] );
+#endif
+        }
+
+/// \endcond
+}}}
+
+#endif  // BOOST_ALGORITHM_EXECUTION_HPP
@@ -0,0 +1,226 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/// \file  eytzinger_index.hpp
+/// \brief A copy of a sorted sequence laid out for fast repeated searches.
+/// \author agent
+
+#ifndef BOOST_ALGORITHM_EYTZINGER_INDEX_HPP
+#define BOOST_ALGORITHM_EYTZINGER_INDEX_HPP
+
+#include <cstddef>      // for std::size_t
+#include <functional>   // for std::less
+#include <iterator>     // for std::distance
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/prefetch.hpp>
+
+namespace boost { namespace algorithm {
+
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+    template <typename T, typename Compare>
+    struct eytzinger_less {
+        eytzinger_less ( const T &x, Compare comp ) : x_ ( &x ), comp_ ( comp ) {}
+        template <typename U>
+        bool operator () ( const U &e ) const { return comp_ ( e, *x_ ); }
+    private:
+        const T *x_;
+        Compare comp_;
+        };
+
+    template <typename T, typename Compare>
+    struct eytzinger_not_greater {
+        eytzinger_not_greater ( const T &x, Compare comp ) : x_ ( &x ), comp_ ( comp ) {}
+        template <typename U>
+        bool operator () ( const U &e ) const { return !comp_ ( *x_, e ); }
+    private:
+        const T *x_;
+        Compare comp_;
+        };
+
+}
+/// \endcond
+
+/// \class eytzinger_index
+/// \brief A copy of a sorted sequence, built once and then searched any
+///        number of times with partition_point, lower_bound and upper_bound.
+///
+///        The elements are stored in breadth first order of the binary
+///        search tree (the "Eytzinger" layout): the children of the element
+///        at position k are at 2k and 2k+1. The first few levels of the tree,
+///        which every search goes through, share a handful of cache lines,
+///        and the descendants of an element a few levels down are next to
+///        each other in memory, so they can be prefetched while the search
+///        is still several steps above them. The searches do not branch on the
+///        comparisons. The results are positions in the original sequence.
+template <typename T, typename Compare = std::less<T> >
+class eytzinger_index
+{
+public:
+    /// \brief Build the index of the sorted sequence [first, last).
+    ///        The elements are copied.
+    template <typename ForwardIterator>
+    eytzinger_index ( ForwardIterator first, ForwardIterator last, Compare comp = Compare ())
+        : comp_ ( comp ) { build ( first, static_cast<std::size_t> ( std::distance ( first, last ))); }
+
+    /// \brief Build the index of the sorted sequence r
+    template <typename Range>
+    explicit eytzinger_index ( const Range &r, Compare comp = Compare ())
+        : comp_ ( comp ) { build ( boost::begin ( r ), static_cast<std::size_t> ( std::distance ( boost::begin ( r ), boost::end ( r )))); }
+
+    /// \brief The number of elements in the sequence
+    std::size_t size () const { return rank_.size () - 1; }
+
+    /// \brief Whether the sequence is empty
+    bool empty () const { return size () == 0; }
+
+    /// \brief The position of the partition point of the sequence, i.e, of
+    ///        the first element that does not satisfy p (or size() if they all do)
+    template <typename Predicate>
+    std::size_t partition_point ( Predicate p ) const
+    {
+        const std::size_t n = size ();
+        const T *tree = n == 0 ? NULL : &tree_ [ 0 ];
+        std::size_t k = 1;
+        while ( k <= n ) {
+            if ( k * lookahead_ <= n )
+                BOOST_ALGORITHM_PREFETCH ( tree + k * lookahead_ );
+            k = 2 * k + static_cast<bool> ( p ( tree [ k ] ));
+            }
+        return rank_ [ leave ( k ) ];
+    }
+
+    /// \brief The position of the first element that is not less than x
+    template <typename U>
+    std::size_t lower_bound ( const U &x ) const
+    {
+        return partition_point ( detail::eytzinger_less<U, Compare> ( x, comp_ ));
+    }
+
+    /// \brief The position of the first element that is greater than x
+    template <typename U>
+    std::size_t upper_bound ( const U &x ) const
+    {
+        return partition_point ( detail::eytzinger_not_greater<U, Compare> ( x, comp_ ));
+    }
+
+    /// \brief Write lower_bound(x) for each x in [first, last) to out.
+    ///        The searches for a few values at a time go down the tree
+    ///        together, so that their cache misses overlap.
+    /// \return One past the last position written
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator lower_bound ( ForwardIterator first, ForwardIterator last, OutputIterator out ) const
+    {
+        return search_batch<false> ( first, last, out );
+    }
+
+    /// \brief Write upper_bound(x) for each x in [first, last) to out, as
+    ///        the batched lower_bound does
+    /// \return One past the last position written
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator upper_bound ( ForwardIterator first, ForwardIterator last, OutputIterator out ) const
+    {
+        return search_batch<true> ( first, last, out );
+    }
+
+private:
+    //  Number of searches that go down the tree together
+    BOOST_STATIC_CONSTANT ( std::size_t, batch = 8 );
+
+    template <typename ForwardIterator>
+    void build ( ForwardIterator first, std::size_t n )
+    {
+        rank_.resize ( n + 1 );
+        rank_ [ 0 ] = n;
+        if ( n != 0 ) {
+            tree_.assign ( n + 1, *first );
+            std::size_t i = 0;
+            fill ( first, i, 1 );
+            }
+        full_levels_ = 0;
+        while (( std::size_t ( 2 ) << full_levels_ ) - 1 <= n )
+            ++full_levels_;
+    //  The first descendant of k that shares a cache line with its siblings
+        lookahead_ = 2;
+        while ( lookahead_ * 2 * sizeof ( T ) <= 64 )
+            lookahead_ *= 2;
+    }
+
+    //  In order traversal of the subtree at k, taking the elements from 'first'
+    template <typename ForwardIterator>
+    void fill ( ForwardIterator &first, std::size_t &i, std::size_t k )
+    {
+        if ( k >= rank_.size ())
+            return;
+        fill ( first, i, 2 * k );
+        tree_ [ k ] = *first;
+        ++first;
+        rank_ [ k ] = i++;
+        fill ( first, i, 2 * k + 1 );
+    }
+
+    //  When the search falls off the tree at k, the answer is the last
+    //  node where it went left: strip the trailing right turns and that one.
+    static std::size_t leave ( std::size_t k )
+    {
+        return static_cast<std::size_t> ( k >> ( detail::count_trailing_zeros ( ~boost::uint64_t ( k )) + 1 ));
+    }
+
+    template <bool Upper, typename U>
+    bool go_right ( const T &e, const U &x ) const
+    {
+        return Upper ? !comp_ ( x, e ) : static_cast<bool> ( comp_ ( e, x ));
+    }
+
+    template <bool Upper, typename ForwardIterator, typename OutputIterator>
+    OutputIterator search_batch ( ForwardIterator first, ForwardIterator last, OutputIterator out ) const
+    {
+        const std::size_t n = size ();
+        const T *tree = n == 0 ? NULL : &tree_ [ 0 ];
+        while ( first != last ) {
+            ForwardIterator q [ batch ];
+            std::size_t k [ batch ];
+            std::size_t m = 0;
+            for ( ; m < batch && first != last; ++m, ++first ) {
+                q [ m ] = first;
+                k [ m ] = 1;
+                }
+        //  Every search goes through all the full levels
+            for ( std::size_t level = 0; level < full_levels_; ++level )
+                for ( std::size_t j = 0; j < m; ++j ) {
+                    k [ j ] = 2 * k [ j ] + go_right<Upper> ( tree [ k [ j ]], *q [ j ] );
+                    if ( k [ j ] * lookahead_ <= n )
+                        BOOST_ALGORITHM_PREFETCH ( tree + k [ j ] * lookahead_ );
+                    }
+        //  and some go one level further
+            for ( std::size_t j = 0; j < m; ++j ) {
+                if ( k [ j ] <= n )
+                    k [ j ] = 2 * k [ j ] + go_right<Upper> ( tree [ k [ j ]], *q [ j ] );
+                *out++ = rank_ [ leave ( k [ j ] ) ];
+                }
+            }
+        return out;
+    }
+
+    std::vector<T> tree_;               // tree_[k] is node k; tree_[0] is unused
+    std::vector<std::size_t> rank_;     // rank_[k] is the position of node k in the sequence; rank_[0] is size()
+    std::size_t full_levels_;           // the number of levels of the tree that are complete
+    std::size_t lookahead_;             // a power of two: node k * lookahead_ is prefetched at node k
+    Compare comp_;
+};
+
+}}
+
+#endif  // BOOST_ALGORITHM_EYTZINGER_INDEX_HPP
@@ -12,12 +12,19 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/find_value.hpp>
 
 namespace boost { namespace algorithm {
 
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
 template<typename BidiIter, typename T>
 BOOST_CXX14_CONSTEXPR
-BidiIter find_backward(BidiIter first, BidiIter last, const T & x)
+BidiIter find_backward(BidiIter first, BidiIter last, const T & x, boost::false_type)
 {
     BidiIter it = last;
     while (it != first) {
@@ -27,16 +34,24 @@ BidiIter find_backward(BidiIter first, BidiIter last, const T & x)
     return last;
 }
 
-template<typename Range, typename T>
+//  Arrays of integers are searched a word at a time
+template<typename ContiguousIter, typename T>
 BOOST_CXX14_CONSTEXPR
-typename boost::range_iterator<Range>::type find_backward(Range & range, const T & x)
+ContiguousIter find_backward(ContiguousIter first, ContiguousIter last, const T & x, boost::true_type)
 {
-    return ::boost::algorithm::find_backward(boost::begin(range), boost::end(range), x);
+    typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIter>::value_type>::type value_type;
+    if (first == last || is_constant_evaluated())
+        return detail::find_backward(first, last, x, boost::false_type());
+    if (!is_lane_value<value_type>(x))
+        return last;
+    const value_type* p = &*first;
+    const value_type* found = find_value_backward<true>(p, p + (last - first), static_cast<value_type>(x));
+    return first + (found - p);
 }
 
 template<typename BidiIter, typename T>
 BOOST_CXX14_CONSTEXPR
-BidiIter find_not_backward(BidiIter first, BidiIter last, const T & x)
+BidiIter find_not_backward(BidiIter first, BidiIter last, const T & x, boost::false_type)
 {
     BidiIter it = last;
     while (it != first) {
@@ -46,6 +61,56 @@ BidiIter find_not_backward(BidiIter first, BidiIter last, const T & x)
     return last;
 }
 
+template<typename ContiguousIter, typename T>
+BOOST_CXX14_CONSTEXPR
+ContiguousIter find_not_backward(ContiguousIter first, ContiguousIter last, const T & x, boost::true_type)
+{
+    typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIter>::value_type>::type value_type;
+    if (first == last || is_constant_evaluated())
+        return detail::find_not_backward(first, last, x, boost::false_type());
+    if (!is_lane_value<value_type>(x))
+        return last - 1;
+    const value_type* p = &*first;
+    const value_type* found = find_value_backward<false>(p, p + (last - first), static_cast<value_type>(x));
+    return first + (found - p);
+}
+
+}
+/// \endcond
+
+/// \fn find_backward ( BidiIter first, BidiIter last, const T & x )
+/// \return the last element in [first, last) that is equal to x, or last if there is none
+///
+/// \note Arrays of 1, 2, 4 or 8 byte integers are searched a word at a time
+///       (except in constant expressions).
+template<typename BidiIter, typename T>
+BOOST_CXX14_CONSTEXPR
+BidiIter find_backward(BidiIter first, BidiIter last, const T & x)
+{
+    return detail::find_backward(first, last, x,
+        typename detail::is_word_searchable<BidiIter, T>::type());
+}
+
+template<typename Range, typename T>
+BOOST_CXX14_CONSTEXPR
+typename boost::range_iterator<Range>::type find_backward(Range & range, const T & x)
+{
+    return ::boost::algorithm::find_backward(boost::begin(range), boost::end(range), x);
+}
+
+/// \fn find_not_backward ( BidiIter first, BidiIter last, const T & x )
+/// \return the last element in [first, last) that is not equal to x, or last if there is none
+///
+/// \note Arrays of 1, 2, 4 or 8 byte integers are searched a word at a time
+///       (except in constant expressions).
+template<typename BidiIter, typename T>
+BOOST_CXX14_CONSTEXPR
+BidiIter find_not_backward(BidiIter first, BidiIter last, const T & x)
+{
+    return detail::find_not_backward(first, last, x,
+        typename detail::is_word_searchable<BidiIter, T>::type());
+}
+
 template<typename Range, typename T>
 BOOST_CXX14_CONSTEXPR
 typename boost::range_iterator<Range>::type find_not_backward(Range & range, const T & x)
@@ -12,12 +12,20 @@
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
+#include <boost/algorithm/detail/find_value.hpp>
 
 namespace boost { namespace algorithm {
 
-template<typename InputIter, typename Sentinel, typename T>        
+/// \cond DOXYGEN_HIDE
+namespace detail {
+
+template<typename InputIter, typename Sentinel, typename T>
 BOOST_CXX14_CONSTEXPR
-InputIter find_not(InputIter first, Sentinel last, const T & x)
+InputIter find_not(InputIter first, Sentinel last, const T & x, boost::false_type)
 {
     for (; first != last; ++first) {
         if (*first != x)
@@ -26,6 +34,37 @@ InputIter find_not(InputIter first, Sentinel last, const T & x)
     return first;
 }
 
+//  Arrays of integers are searched a word at a time
+template<typename ContiguousIter, typename T>
+BOOST_CXX14_CONSTEXPR
+ContiguousIter find_not(ContiguousIter first, ContiguousIter last, const T & x, boost::true_type)
+{
+    typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIter>::value_type>::type value_type;
+    if (first == last || is_constant_evaluated())
+        return detail::find_not(first, last, x, boost::false_type());
+    if (!is_lane_value<value_type>(x))
+        return first;
+    const value_type* p = &*first;
+    const value_type* found = find_value_forward<false>(p, p + (last - first), static_cast<value_type>(x));
+    return first + (found - p);
+}
+
+}
+/// \endcond
+
+/// \fn find_not ( InputIter first, Sentinel last, const T & x )
+/// \return the first element in [first, last) that is not equal to x, or last if there is none
+///
+/// \note Arrays of 1, 2, 4 or 8 byte integers are searched a word at a time
+///       (except in constant expressions).
+template<typename InputIter, typename Sentinel, typename T>        
+BOOST_CXX14_CONSTEXPR
+InputIter find_not(InputIter first, Sentinel last, const T & x)
+{
+    return detail::find_not(first, last, x, boost::integral_constant<bool,
+        boost::is_same<InputIter, Sentinel>::value && detail::is_word_searchable<InputIter, T>::type::value>());
+}
+
 template<typename Range, typename T>
 BOOST_CXX14_CONSTEXPR
 typename boost::range_iterator<Range>::type find_not(Range & r, const T & x)
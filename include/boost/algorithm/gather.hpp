@@ -21,13 +21,19 @@
 #define BOOST_ALGORITHM_GATHER_HPP
 
 #include <algorithm>                // for std::stable_partition
-#include <functional>
+#include <cstddef>                  // for std::size_t
+#include <iterator>                 // for std::iterator_traits
+#include <new>                      // for placement new
 #include <utility>                  // for std::make_pair
+#include <vector>
 
 #include <boost/config.hpp>
-#include <boost/bind/bind.hpp>      // for boost::bind
 #include <boost/range/begin.hpp>    // for boost::begin(range)
 #include <boost/range/end.hpp>      // for boost::end(range)
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <boost/algorithm/detail/move.hpp>
 
 
 /**************************************************************************************************/
@@ -56,13 +62,15 @@
 
 
     The problem is broken down into two basic steps, namely, moving the items before the pivot
-    and then moving the items from the pivot to the end. These "moves" are done with calls to
-    stable_partition.
+    and then moving the items from the pivot to the end. These "moves" are done with stable
+    partitions of the two halves.
 
     \par Storage Requirements:
 
-    The algorithm uses stable_partition, which will attempt to allocate temporary memory,
-    but will work in-situ if there is none available.
+    When each half is small, the items that move are held in a buffer on the stack.
+    Otherwise the algorithm uses stable_partition, which will attempt to allocate temporary
+    memory, but will work in-situ if there is none available. A caller that gathers often
+    can pass a std::vector to use as the buffer instead; its capacity is reused.
 
     \par Time Complexity:
 
@@ -76,6 +84,122 @@ namespace boost { namespace algorithm {
 
 /**************************************************************************************************/
 
+namespace detail {
+
+/// \cond DOXYGEN_HIDE
+
+//  The predicate, and its negation. Unlike !boost::bind ( pred, _1 ) these
+//  work with any callable (including lambdas) that returns something
+//  convertible to bool.
+template <typename Pred>
+struct gather_pred {
+    gather_pred ( Pred p ) : p_ ( p ) {}
+    template <typename T>
+    bool operator () ( const T &t ) { return p_ ( t ) ? true : false; }
+private:
+    Pred p_;
+    };
+
+template <typename Pred>
+struct gather_not_pred {
+    gather_not_pred ( Pred p ) : p_ ( p ) {}
+    template <typename T>
+    bool operator () ( const T &t ) { return p_ ( t ) ? false : true; }
+private:
+    Pred p_;
+    };
+
+//  Room for the items that move, when gathering small sequences
+const std::size_t gather_stack_bytes = 1024;
+
+template <typename T>
+class gather_stack_buffer {
+public:
+    static const std::size_t capacity = gather_stack_bytes / sizeof ( T );
+
+    gather_stack_buffer () : size_ ( 0 ) {}
+    ~gather_stack_buffer () { clear (); }
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    void push_back ( T &&t ) { ::new ( address ( size_ )) T ( static_cast<T &&> ( t )); ++size_; }
+#endif
+    void push_back ( const T &t ) { ::new ( address ( size_ )) T ( t ); ++size_; }
+
+    std::size_t size () const { return size_; }
+    T &operator [] ( std::size_t i ) { return *static_cast<T *> ( address ( i )); }
+
+    void clear () {
+        for ( ; size_ > 0; --size_ )
+            ( *this ) [ size_ - 1 ].~T ();
+        }
+
+private:
+    gather_stack_buffer ( const gather_stack_buffer & );
+    gather_stack_buffer &operator = ( const gather_stack_buffer & );
+
+    void *address ( std::size_t i ) { return static_cast<T *> ( static_cast<void *> ( &storage_ )) + i; }
+
+    typename boost::aligned_storage<
+        sizeof ( T ) * ( capacity == 0 ? 1 : capacity ), boost::alignment_of<T>::value>::type storage_;
+    std::size_t size_;
+    };
+
+//  Does [first, last) have at most 'n' elements? Takes at most n steps.
+template <typename ForwardIterator>
+bool gather_at_most ( ForwardIterator first, ForwardIterator last, std::size_t n ) {
+    for ( ; first != last; ++first, --n )
+        if ( n == 0 )
+            return false;
+    return true;
+    }
+
+//  A stable partition that moves the items that fail 'pred' through 'buffer'.
+//  The items that satisfy it are moved (forward) only once, and not at all
+//  if they come before the first that fails.
+template <typename ForwardIterator, typename Pred, typename Buffer>
+ForwardIterator gather_partition ( ForwardIterator first, ForwardIterator last, Pred pred, Buffer &buffer ) {
+    ForwardIterator out = first;
+    for ( ; first != last && pred ( *first ); ++first )
+        ++out;
+    for ( ; first != last; ++first )
+        if ( pred ( *first )) {
+            *out = boost::algorithm::detail::move_value ( *first );
+            ++out;
+            }
+        else
+            buffer.push_back ( boost::algorithm::detail::move_value ( *first ));
+
+    ForwardIterator result = out;
+    for ( std::size_t i = 0; i < buffer.size (); ++i, (void) ++out )
+        *out = boost::algorithm::detail::move_value ( buffer [ i ] );
+    buffer.clear ();
+    return result;
+    }
+
+template <typename BidirectionalIterator, typename Pred, typename Buffer>
+std::pair<BidirectionalIterator, BidirectionalIterator> gather_buffered
+        ( BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator pivot, Pred pred, Buffer &buffer )
+{
+    buffer.clear ();
+    BidirectionalIterator start = gather_partition ( first, pivot, gather_not_pred<Pred> ( pred ), buffer );
+    return std::make_pair ( start, gather_partition ( pivot, last, gather_pred<Pred> ( pred ), buffer ));
+}
+
+//  The first call partitions everything up to (but not including) the pivot element,
+//  while the second call partitions the rest of the sequence.
+template <typename BidirectionalIterator, typename Pred>
+std::pair<BidirectionalIterator, BidirectionalIterator> gather_stable_partition
+        ( BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator pivot, Pred pred )
+{
+    return std::make_pair (
+        std::stable_partition ( first, pivot, gather_not_pred<Pred> ( pred )),
+        std::stable_partition ( pivot, last,  gather_pred<Pred> ( pred )));
+}
+
+/// \endcond
+
+}
+
 /*!
     \ingroup gather
     \brief iterator-based gather implementation
@@ -87,12 +211,40 @@ template <
 std::pair<BidirectionalIterator, BidirectionalIterator> gather
         ( BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator pivot, Pred pred )
 {
-//  The first call partitions everything up to (but not including) the pivot element,
-//  while the second call partitions the rest of the sequence.
-    using namespace boost::placeholders;
-    return std::make_pair (
-        std::stable_partition ( first, pivot, !boost::bind<bool> ( pred, _1 )),
-        std::stable_partition ( pivot, last,   boost::bind<bool> ( pred, _1 )));
+    typedef typename std::iterator_traits<BidirectionalIterator>::value_type value_type;
+    typedef detail::gather_stack_buffer<value_type> stack_buffer;
+
+//  Small sequences don't need to allocate
+    if ( stack_buffer::capacity > 0
+            && detail::gather_at_most ( first, pivot, stack_buffer::capacity )
+            && detail::gather_at_most ( pivot, last,  stack_buffer::capacity )) {
+        stack_buffer buffer;
+        return detail::gather_buffered ( first, last, pivot, pred, buffer );
+        }
+
+    return detail::gather_stable_partition ( first, last, pivot, pred );
+}
+
+/**************************************************************************************************/
+
+/*!
+    \ingroup gather
+    \brief iterator-based gather implementation, using a caller-provided buffer
+
+    The items that move are held in \c buffer, which is empty afterwards but
+    keeps its capacity, so that repeated calls need not allocate. The run time
+    is always linear in <code>N</code>.
+*/
+
+template <
+    typename BidirectionalIterator,  // models BidirectionalIterator
+    typename Pred,                   // models UnaryPredicate
+    typename Alloc>
+std::pair<BidirectionalIterator, BidirectionalIterator> gather
+        ( BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator pivot, Pred pred,
+          std::vector<typename std::iterator_traits<BidirectionalIterator>::value_type, Alloc> &buffer )
+{
+    return detail::gather_buffered ( first, last, pivot, pred, buffer );
 }
 
 /**************************************************************************************************/
@@ -118,6 +270,75 @@ gather (
 
 /**************************************************************************************************/
 
+/*!
+    \ingroup gather
+    \brief gather several groups of items at once
+
+    \c group(x) returns the group of each item: a number in [0, n), or any other value
+    (such as -1) for the items that are not selected. The selected items are gathered,
+    as by gather, into a single block around the pivot, with the items of group 0
+    first, then those of group 1, and so on. All the items keep their relative order
+    within their group; the items that are not selected keep theirs on either side
+    of the block.
+
+    The n + 1 boundaries of the groups (the start of each group, then the end of the
+    last one) are written to \c boundaries.
+
+    The sequence is traversed once, and the items that move are held in a
+    temporary buffer; the run time is linear in <code>N</code>.
+*/
+
+template <
+    typename BidirectionalIterator,  // models BidirectionalIterator
+    typename Classify,               // returns an integer
+    typename OutputIterator>         // models OutputIterator, for BidirectionalIterators
+OutputIterator gather_n
+        ( BidirectionalIterator first, BidirectionalIterator last, BidirectionalIterator pivot,
+          std::size_t n, Classify group, OutputIterator boundaries )
+{
+    typedef typename std::iterator_traits<BidirectionalIterator>::value_type value_type;
+    std::vector<value_type> buffer;
+    std::vector<std::size_t> groups;
+    std::vector<std::size_t> counts ( n + 1 );
+
+//  The unselected items before the pivot are moved forward, in place; the
+//  rest go to the buffer. Group 'n' is the unselected items after the pivot.
+    BidirectionalIterator out = first;
+    bool before = true;
+    for ( ; first != last; ++first ) {
+        if ( first == pivot )
+            before = false;
+        std::size_t g = static_cast<std::size_t> ( group ( *first ));
+        if ( g >= n ) {
+            if ( before ) {
+                if ( out != first )
+                    *out = detail::move_value ( *first );
+                ++out;
+                continue;
+                }
+            g = n;
+            }
+        buffer.push_back ( detail::move_value ( *first ));
+        groups.push_back ( g );
+        ++counts [ g ];
+        }
+
+    std::vector<BidirectionalIterator> next;
+    next.reserve ( n + 1 );
+    for ( std::size_t g = 0; g <= n; ++g ) {
+        next.push_back ( out );
+        *boundaries++ = out;
+        std::advance ( out, counts [ g ] );
+        }
+    for ( std::size_t i = 0; i < buffer.size (); ++i ) {
+        *next [ groups [ i ]] = detail::move_value ( buffer [ i ] );
+        ++next [ groups [ i ]];
+        }
+    return boundaries;
+}
+
+/**************************************************************************************************/
+
 }}  // namespace
 
 /**************************************************************************************************/
@@ -20,7 +20,10 @@
 #ifndef BOOST_ALGORITHM_HEXHPP
 #define BOOST_ALGORITHM_HEXHPP
 
+#include <algorithm>    // for std::min
+#include <cstddef>      // for std::size_t
 #include <iterator>     // for std::iterator_traits
+#include <new>          // for std::nothrow_t
 #include <stdexcept>
 
 #include <boost/config.hpp>
@@ -32,6 +35,7 @@
 
 #include <boost/core/enable_if.hpp>
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
 
 
 namespace boost { namespace algorithm {
@@ -53,6 +57,33 @@ struct BOOST_SYMBOL_VISIBLE not_enough_input : virtual hex_decode_error {};
 struct BOOST_SYMBOL_VISIBLE non_hex_input    : virtual hex_decode_error {};
 typedef boost::error_info<struct bad_char_,char> bad_char;
 
+/*!
+    \struct hex_decode_errc
+    \brief  The error codes reported by the non-throwing versions of unhex.
+                They mirror the exceptions thrown by the other versions.
+*/
+struct hex_decode_errc {
+    enum type {
+        ok = 0,             ///< The whole input was decoded
+        non_hex_input,      ///< A non-hex value was encountered
+        not_enough_input    ///< The input sequence ended in the middle of a value
+        };
+    };
+
+/*!
+    \struct unhex_result
+    \brief  The value returned by the non-throwing versions of unhex.
+*/
+template <typename OutputIterator>
+struct unhex_result {
+    OutputIterator          out;        ///< One past the last value written
+    hex_decode_errc::type   error;      ///< What (if anything) went wrong
+    std::size_t             position;   ///< Offset in the input of the offending character;
+                                        ///<    the length of the input for not_enough_input
+
+    bool ok () const { return error == hex_decode_errc::ok; }
+    };
+
 namespace detail {
 /// \cond DOXYGEN_HIDE
 
@@ -135,6 +166,70 @@ namespace detail {
         *out = res;
         return ++out;
         }
+
+//  Maps a character to its value as a hex digit, or -1 if it is not one.
+//  It is a static member of a template so that it can live in a header.
+    template <typename Dummy>
+    struct hex_decode_table {
+        static const signed char values [ 256 ];
+        };
+
+    template <typename Dummy>
+    const signed char hex_decode_table<Dummy>::values [ 256 ] = {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+        -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+        };
+
+    template <typename T>
+    int hex_digit_value ( T val ) {
+        typedef typename boost::make_unsigned<T>::type U;
+        const U u = static_cast<U> ( val );
+        return u > 0xFF ? -1 : hex_decode_table<void>::values [ u ];
+        }
+
+    template <typename OutputIterator>
+    unhex_result<OutputIterator> make_unhex_result ( OutputIterator out, hex_decode_errc::type error, std::size_t position ) {
+        unhex_result<OutputIterator> retval = { out, error, position };
+        return retval;
+        }
+
+//  Like decode_one, but reports errors rather than throwing.
+//  Decodes values until the input runs out or something goes wrong.
+    template <typename InputIterator, typename OutputIterator, typename EndPred>
+    typename boost::enable_if<boost::is_integral<typename hex_iterator_traits<OutputIterator>::value_type>, unhex_result<OutputIterator> >::type
+    decode_nothrow ( InputIterator first, InputIterator last, OutputIterator out, EndPred pred ) {
+        typedef typename hex_iterator_traits<OutputIterator>::value_type T;
+        std::size_t pos = 0;
+
+        while ( !pred ( first, last )) {
+            T res (0);
+            for ( std::size_t i = 0; i < 2 * sizeof ( T ); ++i, ++first, ++pos ) {
+                if ( pred ( first, last ))
+                    return make_unhex_result ( out, hex_decode_errc::not_enough_input, pos );
+                const int digit = hex_digit_value ( *first );
+                if ( digit < 0 )
+                    return make_unhex_result ( out, hex_decode_errc::non_hex_input, pos );
+                res = static_cast<T> (( 16 * res ) + digit );
+                }
+            *out = res;
+            ++out;
+            }
+        return make_unhex_result ( out, hex_decode_errc::ok, pos );
+        }
 /// \endcond
     }
 
@@ -280,6 +375,315 @@ OutputIterator unhex ( const Range &r, OutputIterator out ) {
     }
 
 
+/// \fn unhex ( InputIterator first, InputIterator last, OutputIterator out, const std::nothrow_t & )
+/// \brief   Converts a sequence of hexadecimal characters into a sequence of integers.
+///             Reports errors in the return value instead of throwing.
+///
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param out      An output iterator to the results into
+/// \return         The updated output iterator, and the error (if any) with its position
+template <typename InputIterator, typename OutputIterator>
+unhex_result<OutputIterator> unhex ( InputIterator first, InputIterator last, OutputIterator out, const std::nothrow_t & ) {
+    return detail::decode_nothrow ( first, last, out, detail::iter_end<InputIterator> );
+    }
+
+
+/// \fn unhex ( const T *ptr, OutputIterator out, const std::nothrow_t & )
+/// \brief   Converts a sequence of hexadecimal characters into a sequence of integers.
+///             Reports errors in the return value instead of throwing.
+///
+/// \param ptr      A pointer to a null-terminated input sequence.
+/// \param out      An output iterator to the results into
+/// \return         The updated output iterator, and the error (if any) with its position
+template <typename T, typename OutputIterator>
+unhex_result<OutputIterator> unhex ( const T *ptr, OutputIterator out, const std::nothrow_t & ) {
+    return detail::decode_nothrow ( ptr, (const T *) NULL, out, detail::ptr_end<T> );
+    }
+
+
+/// \fn unhex ( const Range &r, OutputIterator out, const std::nothrow_t & )
+/// \brief   Converts a sequence of hexadecimal characters into a sequence of integers.
+///             Reports errors in the return value instead of throwing.
+///
+/// \param r        The input range
+/// \param out      An output iterator to the results into
+/// \return         The updated output iterator, and the error (if any) with its position
+template <typename Range, typename OutputIterator>
+unhex_result<OutputIterator> unhex ( const Range &r, OutputIterator out, const std::nothrow_t &nt ) {
+    return unhex (boost::begin(r), boost::end(r), out, nt);
+    }
+
+
+/// \fn hex_encoded_size ( std::size_t n )
+/// \brief   The number of characters that hex produces for n values of type T.
+///
+/// \param n        The number of values to be encoded
+template <typename T>
+BOOST_CONSTEXPR std::size_t hex_encoded_size ( std::size_t n ) {
+    return n * 2 * sizeof ( T );
+    }
+
+/// \overload
+BOOST_CONSTEXPR inline std::size_t hex_encoded_size ( std::size_t n ) {
+    return hex_encoded_size<char> ( n );
+    }
+
+
+/// \fn hex_decoded_size ( std::size_t n )
+/// \brief   The number of values of type T that unhex produces from n characters
+///             of valid input.
+///
+/// \param n        The number of characters to be decoded
+template <typename T>
+BOOST_CONSTEXPR std::size_t hex_decoded_size ( std::size_t n ) {
+    return n / ( 2 * sizeof ( T ));
+    }
+
+/// \overload
+BOOST_CONSTEXPR inline std::size_t hex_decoded_size ( std::size_t n ) {
+    return hex_decoded_size<char> ( n );
+    }
+
+
+namespace detail {
+/// \cond DOXYGEN_HIDE
+    template <typename T, typename CharT>
+    CharT *encode_to_buffer ( const T *first, std::size_t n, CharT *out, const char * hexDigits ) {
+        typedef typename boost::make_unsigned<T>::type U;
+        const std::size_t num_hex_digits = 2 * sizeof ( T );
+        for ( std::size_t i = 0; i < n; ++i, out += num_hex_digits ) {
+            U val = static_cast<U> ( first [ i ] );
+            for ( std::size_t j = num_hex_digits; j > 0; --j, val >>= 4 )
+                out [ j - 1 ] = hexDigits [ val & 0x0F ];
+            }
+        return out;
+        }
+/// \endcond
+    }
+
+
+/// \fn hex_to_buffer ( const T *first, std::size_t n, CharT *out )
+/// \brief   Converts a sequence of integral types into a hexadecimal sequence of characters.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of values in the input sequence
+/// \param out      The output buffer; it must have room for hex_encoded_size<T> ( n ) characters
+/// \return         One past the last character written
+template <typename T, typename CharT>
+typename boost::enable_if<boost::is_integral<T>, CharT *>::type
+hex_to_buffer ( const T *first, std::size_t n, CharT *out ) {
+    return detail::encode_to_buffer ( first, n, out, "0123456789ABCDEF" );
+    }
+
+
+/// \fn hex_lower_to_buffer ( const T *first, std::size_t n, CharT *out )
+/// \brief   Converts a sequence of integral types into a lower case hexadecimal sequence of characters.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of values in the input sequence
+/// \param out      The output buffer; it must have room for hex_encoded_size<T> ( n ) characters
+/// \return         One past the last character written
+template <typename T, typename CharT>
+typename boost::enable_if<boost::is_integral<T>, CharT *>::type
+hex_lower_to_buffer ( const T *first, std::size_t n, CharT *out ) {
+    return detail::encode_to_buffer ( first, n, out, "0123456789abcdef" );
+    }
+
+
+/// \fn unhex_to_buffer ( const CharT *first, std::size_t n, T *out )
+/// \brief   Converts a sequence of hexadecimal characters into a sequence of integers.
+///             Never throws; errors are reported in the return value.
+///
+/// \param first    The start of the input sequence
+/// \param n        The number of characters in the input sequence
+/// \param out      The output buffer; it must have room for hex_decoded_size<T> ( n ) values
+/// \return         One past the last value written, and the error (if any) with its position
+template <typename CharT, typename T>
+typename boost::enable_if<boost::is_integral<T>, unhex_result<T *> >::type
+unhex_to_buffer ( const CharT *first, std::size_t n, T *out ) {
+    const std::size_t num_hex_digits = 2 * sizeof ( T );
+    const std::size_t whole = n - n % num_hex_digits;
+    std::size_t pos = 0;
+
+//  The length is known up front, so only complete values are decoded here;
+//  no end-of-input checks are needed inside the loop.
+    for ( ; pos < whole; pos += num_hex_digits, ++out ) {
+        T res (0);
+        for ( std::size_t j = 0; j < num_hex_digits; ++j ) {
+            const int digit = detail::hex_digit_value ( first [ pos + j ] );
+            if ( digit < 0 )
+                return detail::make_unhex_result ( out, hex_decode_errc::non_hex_input, pos + j );
+            res = static_cast<T> (( 16 * res ) + digit );
+            }
+        *out = res;
+        }
+
+//  Any leftover characters are an error; report it the same way unhex would.
+    for ( ; pos < n; ++pos )
+        if ( detail::hex_digit_value ( first [ pos ] ) < 0 )
+            return detail::make_unhex_result ( out, hex_decode_errc::non_hex_input, pos );
+    return detail::make_unhex_result ( out, whole == n ? hex_decode_errc::ok : hex_decode_errc::not_enough_input, n );
+    }
+
+
+/*!
+    \struct hex_stream_result
+    \brief  The value returned by the chunked encoder and decoder.
+*/
+struct hex_stream_result {
+    std::size_t             consumed;   ///< The number of input elements used
+    std::size_t             produced;   ///< The number of output elements written
+    hex_decode_errc::type   error;      ///< non_hex_input if the decoder found a bad character;
+                                        ///<    it is the input element at offset 'consumed'
+    };
+
+
+/*!
+    \class hex_encoder
+    \brief  Converts a sequence of integral types into hexadecimal characters,
+                a chunk at a time. The input and output buffers can be any size;
+                a value that does not fit in the output is finished on the next call.
+*/
+template <typename T = char>
+class hex_encoder {
+public:
+    explicit hex_encoder ( bool lower_case = false )
+        : digits_ ( lower_case ? "0123456789abcdef" : "0123456789ABCDEF" ), value_ ( 0 ), remaining_ ( 0 ) {}
+
+/// \brief Encodes as much of [first, first + n) as fits in [out, out + out_size).
+///     Call with an empty input to flush a value that was only partly written.
+    template <typename CharT>
+    hex_stream_result encode ( const T *first, std::size_t n, CharT *out, std::size_t out_size ) {
+        hex_stream_result res = { 0, 0, hex_decode_errc::ok };
+        res.produced = put_pending ( out, out_size );
+
+        const std::size_t whole = (std::min) ( n, ( out_size - res.produced ) / num_digits );
+        detail::encode_to_buffer ( first, whole, out + res.produced, digits_ );
+        res.consumed  = whole;
+        res.produced += whole * num_digits;
+
+        if ( res.consumed < n && res.produced < out_size ) {
+            value_ = static_cast<U> ( first [ res.consumed++ ] );
+            remaining_ = num_digits;
+            res.produced += put_pending ( out + res.produced, out_size - res.produced );
+            }
+        return res;
+        }
+
+/// \brief Returns true if a value has been read but not completely written.
+    bool pending () const { return remaining_ != 0; }
+
+/// \brief Discards any partly written value.
+    void reset () { remaining_ = 0; }
+
+private:
+    typedef typename boost::make_unsigned<T>::type U;
+    static const std::size_t num_digits = 2 * sizeof ( T );
+
+    template <typename CharT>
+    std::size_t put_pending ( CharT *out, std::size_t out_size ) {
+        std::size_t i = 0;
+        for ( ; i < out_size && remaining_ > 0; ++i, --remaining_ )
+            out [ i ] = digits_ [ ( value_ >> ( 4 * ( remaining_ - 1 ))) & 0x0F ];
+        return i;
+        }
+
+    const char *digits_;
+    U           value_;
+    std::size_t remaining_;     // digits of value_ still to be written
+    };
+
+
+/*!
+    \class hex_decoder
+    \brief  Converts hexadecimal characters into a sequence of integral types,
+                a chunk at a time. A value may be split across any number of
+                input chunks; the digits seen so far are carried between calls.
+*/
+template <typename T = char>
+class hex_decoder {
+public:
+    hex_decoder () : value_ ( 0 ), digits_ ( 0 ) {}
+
+/// \brief Decodes as much of [first, first + n) as fits in [out, out + out_size).
+///     Stops at the first non-hex character, which is not consumed.
+    template <typename CharT>
+    hex_stream_result decode ( const CharT *first, std::size_t n, T *out, std::size_t out_size ) {
+        hex_stream_result res = { 0, 0, hex_decode_errc::ok };
+
+    //  Finish off any value that was started in an earlier chunk
+        while ( digits_ != 0 && res.consumed < n ) {
+            if ( !put_digit ( first [ res.consumed ], out, out_size, res ))
+                return res;
+            }
+
+    //  Whole values can go straight to the output
+        const std::size_t whole = (std::min) (( n - res.consumed ) / num_digits, out_size - res.produced );
+        if ( whole > 0 ) {
+            unhex_result<T *> r = unhex_to_buffer ( first + res.consumed, whole * num_digits, out + res.produced );
+            res.produced = r.out - out;
+            if ( !r.ok ()) {
+            //  Keep the good digits of the value that contained the error
+                const std::size_t bad = res.consumed + r.position;
+                res.consumed += r.position - r.position % num_digits;
+                while ( res.consumed < bad )
+                    put_digit ( first [ res.consumed ], out, out_size, res );
+                res.error = r.error;
+                return res;
+                }
+            res.consumed += whole * num_digits;
+            }
+
+    //  And what's left over is the start of the next value
+        while ( res.consumed < n ) {
+            if ( !put_digit ( first [ res.consumed ], out, out_size, res ))
+                break;
+            }
+        return res;
+        }
+
+/// \brief Returns true if part of a value has been read.
+    bool pending () const { return digits_ != 0; }
+
+/// \brief Call at the end of the input: returns not_enough_input if it ended
+///     in the middle of a value.
+    hex_decode_errc::type finish () const {
+        return digits_ == 0 ? hex_decode_errc::ok : hex_decode_errc::not_enough_input;
+        }
+
+/// \brief Discards any partly read value.
+    void reset () { value_ = 0; digits_ = 0; }
+
+private:
+    static const std::size_t num_digits = 2 * sizeof ( T );
+
+//  Consumes one character. Returns false (and consumes nothing) if it is not
+//  a hex digit, or if it would complete a value and there is no room for it.
+    template <typename CharT>
+    bool put_digit ( CharT c, T *out, std::size_t out_size, hex_stream_result &res ) {
+        const int digit = detail::hex_digit_value ( c );
+        if ( digit < 0 ) {
+            res.error = hex_decode_errc::non_hex_input;
+            return false;
+            }
+        if ( digits_ + 1 == num_digits && res.produced == out_size )
+            return false;
+        value_ = static_cast<T> (( 16 * value_ ) + digit );
+        ++res.consumed;
+        if ( ++digits_ == num_digits ) {
+            out [ res.produced++ ] = value_;
+            value_ = 0;
+            digits_ = 0;
+            }
+        return true;
+        }
+
+    T           value_;
+    std::size_t digits_;    // digits of value_ read so far
+    };
+
+
 /// \fn String hex ( const String &input )
 /// \brief   Converts a sequence of integral types into a hexadecimal sequence of characters.
 ///
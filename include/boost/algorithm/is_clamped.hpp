@@ -14,10 +14,21 @@
 #ifndef BOOST_ALGORITHM_IS_CLAMPED_HPP
 #define BOOST_ALGORITHM_IS_CLAMPED_HPP
 
+#include <cstddef>          //  for std::ptrdiff_t
 #include <functional>       //  for std::less
+#include <iterator>         //  for std::iterator_traits
 #include <cassert>
 
+#include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>            // for boost::enable_if
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/type_identity.hpp> // for boost::type_identity
+#include <boost/algorithm/detail/contiguous.hpp>
 
 namespace boost { namespace algorithm {
 
@@ -67,6 +78,216 @@ namespace boost { namespace algorithm {
     return boost::algorithm::is_clamped ( val, lo, hi, std::less<T>());
   } 
 
+  namespace detail {
+/// \cond DOXYGEN_HIDE
+    template<typename ForwardIterator, typename Pred>
+    BOOST_CXX14_CONSTEXPR ForwardIterator is_clamped_range_until_impl ( ForwardIterator first, ForwardIterator last,
+      typename std::iterator_traits<ForwardIterator>::value_type const & lo,
+      typename std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+    {
+      for ( ; first != last; ++first )
+        if ( !boost::algorithm::is_clamped ( *first, lo, hi, p ))
+          break;
+      return first;
+    }
+
+//  Arrays of arithmetic values (pointers, or the iterators of std::vector,
+//  std::string or std::wstring) with the default comparison are checked a
+//  block at a time, in a loop without branches that compilers vectorize;
+//  only a block with a value out of the range is looked at one by one.
+    template<typename ForwardIterator, typename T>
+    BOOST_CXX14_CONSTEXPR typename boost::enable_if_c<
+           boost::algorithm::detail::is_contiguous_scalars<ForwardIterator>::value
+        && boost::is_arithmetic<T>::value
+        && boost::is_same<typename boost::remove_cv<typename std::iterator_traits<ForwardIterator>::value_type>::type, T>::value,
+        ForwardIterator>::type
+    is_clamped_range_until_impl ( ForwardIterator first, ForwardIterator last,
+      T const & lo_, T const & hi_, std::less<T> )
+    {
+      if ( first == last )
+        return last;
+      typedef typename boost::algorithm::detail::contiguous_element<ForwardIterator>::type element;
+      const T lo = lo_, hi = hi_;
+      const std::ptrdiff_t block = 256 / sizeof ( T ) > 0 ? 256 / sizeof ( T ) : 1;
+      element *const start = boost::algorithm::detail::contiguous_pointer ( first );
+      element *const end = start + ( last - first );
+      element *p = start;
+      for ( ; end - p >= block; p += block ) {
+        unsigned outside = 0;
+        for ( std::ptrdiff_t i = 0; i < block; ++i )
+          outside |= static_cast<unsigned> ( p [ i ] < lo ) | static_cast<unsigned> ( hi < p [ i ] );
+        if ( outside )
+          break;
+        }
+      for ( ; p != end; ++p )
+        if ( *p < lo || hi < *p )
+          break;
+      return first + ( p - start );
+    }
+/// \endcond
+  }
+
+/// \fn is_clamped_range_until ( ForwardIterator first, ForwardIterator last,
+///       std::iterator_traits<ForwardIterator>::value_type const & lo,
+///       std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+/// \returns the first position in [first, last) whose value is not in the 
+///     range [ lo, hi ] using the comparison predicate p, or last if they all are.
+///
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename ForwardIterator, typename Pred>
+  BOOST_CXX14_CONSTEXPR ForwardIterator is_clamped_range_until ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo,
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+  {
+    return detail::is_clamped_range_until_impl ( first, last, lo, hi, p );
+  }
+
+/// \fn is_clamped_range_until ( ForwardIterator first, ForwardIterator last,
+///       std::iterator_traits<ForwardIterator>::value_type const & lo,
+///       std::iterator_traits<ForwardIterator>::value_type const & hi )
+/// \returns the first position in [first, last) whose value is not in the 
+///     range [ lo, hi ] using operator < for comparison, or last if they all are.
+///
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+///
+/// \note For an array of arithmetic values, the values are compared a 
+///     block at a time, in a loop that compilers can vectorize.
+///
+  template<typename ForwardIterator>
+  BOOST_CXX14_CONSTEXPR ForwardIterator is_clamped_range_until ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo,
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi )
+  {
+    typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+    return detail::is_clamped_range_until_impl ( first, last, lo, hi, std::less<value_type>());
+  }
+
+/// \fn is_clamped_range_until ( const Range &r,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi )
+/// \returns the first position in r whose value is not in the range [ lo, hi ],
+///     or the end of r if they all are.
+///
+/// \param r     The range of values to be checked
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+///
+  template<typename Range>
+  BOOST_CXX14_CONSTEXPR typename boost::range_iterator<const Range>::type
+  is_clamped_range_until ( const Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi )
+  {
+    return boost::algorithm::is_clamped_range_until ( boost::begin ( r ), boost::end ( r ), lo, hi );
+  }
+
+/// \fn is_clamped_range_until ( const Range &r,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi, Pred p )
+/// \returns the first position in r whose value is not in the range [ lo, hi ]
+///     using the comparison predicate p, or the end of r if they all are.
+///
+/// \param r     The range of values to be checked
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename Range, typename Pred>
+  BOOST_CXX14_CONSTEXPR typename boost::range_iterator<const Range>::type
+  is_clamped_range_until ( const Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi, Pred p )
+  {
+    return boost::algorithm::is_clamped_range_until ( boost::begin ( r ), boost::end ( r ), lo, hi, p );
+  }
+
+/// \fn is_clamped_range ( ForwardIterator first, ForwardIterator last,
+///       std::iterator_traits<ForwardIterator>::value_type const & lo,
+///       std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+/// \returns true if every value in [first, last) is in the range [ lo, hi ]
+///     using the comparison predicate p.
+///
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename ForwardIterator, typename Pred>
+  BOOST_CXX14_CONSTEXPR bool is_clamped_range ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo,
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi, Pred p )
+  {
+    return boost::algorithm::is_clamped_range_until ( first, last, lo, hi, p ) == last;
+  }
+
+/// \fn is_clamped_range ( ForwardIterator first, ForwardIterator last,
+///       std::iterator_traits<ForwardIterator>::value_type const & lo,
+///       std::iterator_traits<ForwardIterator>::value_type const & hi )
+/// \returns true if every value in [first, last) is in the range [ lo, hi ]
+///     using operator < for comparison.
+///
+/// \param first The start of the range of values
+/// \param last  One past the end of the range of values
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+///
+  template<typename ForwardIterator>
+  BOOST_CXX14_CONSTEXPR bool is_clamped_range ( ForwardIterator first, ForwardIterator last,
+    typename std::iterator_traits<ForwardIterator>::value_type const & lo,
+    typename std::iterator_traits<ForwardIterator>::value_type const & hi )
+  {
+    return boost::algorithm::is_clamped_range_until ( first, last, lo, hi ) == last;
+  }
+
+/// \fn is_clamped_range ( const Range &r,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi )
+/// \returns true if every value in r is in the range [ lo, hi ]
+///
+/// \param r     The range of values to be checked
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+///
+  template<typename Range>
+  BOOST_CXX14_CONSTEXPR bool is_clamped_range ( const Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi )
+  {
+    return boost::algorithm::is_clamped_range ( boost::begin ( r ), boost::end ( r ), lo, hi );
+  }
+
+/// \fn is_clamped_range ( const Range &r,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+///       typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi, Pred p )
+/// \returns true if every value in r is in the range [ lo, hi ]
+///     using the comparison predicate p.
+///
+/// \param r     The range of values to be checked
+/// \param lo    The lower bound of the range
+/// \param hi    The upper bound of the range
+/// \param p     A predicate to use to compare the values.
+///                 p ( a, b ) returns a boolean.
+///
+  template<typename Range, typename Pred>
+  BOOST_CXX14_CONSTEXPR bool is_clamped_range ( const Range &r,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & lo,
+    typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::value_type const & hi, Pred p )
+  {
+    return boost::algorithm::is_clamped_range ( boost::begin ( r ), boost::end ( r ), lo, hi, p );
+  }
+
 }}
 
-#endif // BOOST_ALGORITHM_CLAMP_HPP
+#endif // BOOST_ALGORITHM_IS_CLAMPED_HPP
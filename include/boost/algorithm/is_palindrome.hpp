@@ -17,26 +17,142 @@
 
 #include <iterator>
 #include <functional>
-#include <cstring>
 
 #include <boost/config.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/algorithm/detail/contiguous.hpp>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>     // for _byteswap_uint64
+#endif
 
 namespace boost {  namespace algorithm {
 
-/// \fn is_palindrome ( BidirectionalIterator begin, BidirectionalIterator end, Predicate p )
-/// \return true if the entire sequence is palindrome
+/// \struct ascii_iequal
+/// \brief A predicate that compares two characters for equality, ignoring
+///     the case of the ASCII letters. (Other characters, including those
+///     outside ASCII, have to be equal.)
 ///
-/// \param begin    The start of the input sequence
-/// \param end		One past the end of the input sequence
-/// \param p        A predicate used to compare the values.
-///
-/// \note This function will return true for empty sequences and for palindromes.
-///     For other sequences function will return false.
-///     Complexity: O(N).
+/// \note is_palindrome with this predicate, on contiguous characters, compares
+///     eight characters at a time.
+struct ascii_iequal
+{
+    template <typename T>
+    static T fold(T c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<T>(c + ('a' - 'A')) : c;
+    }
+
+    template <typename T>
+    bool operator()(const T& a, const T& b) const
+    {
+        return fold(a) == fold(b);
+    }
+};
+
+namespace detail {
+
+/// \cond DOXYGEN_HIDE
+//  Sequences of bytes in contiguous memory, compared with std::equal_to or
+//  ascii_iequal, are checked eight bytes at a time: a word from the front
+//  is compared with the byte-reversed word at the same distance from the
+//  back. Four pairs of words are compared before each (early) exit.
+inline boost::uint64_t palindrome_reverse(boost::uint64_t w)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap64(w);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(w);
+#else
+    w = ((w & 0x00FF00FF00FF00FFULL) << 8)  | ((w >> 8)  & 0x00FF00FF00FF00FFULL);
+    w = ((w & 0x0000FFFF0000FFFFULL) << 16) | ((w >> 16) & 0x0000FFFF0000FFFFULL);
+    return (w << 32) | (w >> 32);
+#endif
+}
+
+struct palindrome_exact
+{
+    static boost::uint64_t fold(boost::uint64_t w) { return w; }
+    static unsigned char fold(unsigned char c) { return c; }
+};
+
+//  Lower-case the ASCII capitals in each byte of a word, without branches
+struct palindrome_ascii_nocase
+{
+    static boost::uint64_t fold(boost::uint64_t w)
+    {
+        const boost::uint64_t ones = 0x0101010101010101ULL;
+        const boost::uint64_t low7 = w & (0x7F * ones);
+        const boost::uint64_t ge_A = low7 + (0x80 - 'A') * ones;  // top bit set if >= 'A'
+        const boost::uint64_t gt_Z = low7 + (0x7F - 'Z') * ones;  // top bit set if >  'Z'
+        const boost::uint64_t upper = ge_A & ~gt_Z & ~w & (0x80 * ones);
+        return w | (upper >> 2);
+    }
+    static unsigned char fold(unsigned char c) { return ascii_iequal::fold(c); }
+};
+
+template <typename Fold>
+bool contiguous_palindrome(const unsigned char* first, const unsigned char* last)
+{
+    while (last - first >= 64)
+    {
+        boost::uint64_t diff = 0;
+        for (int i = 0; i < 4; ++i)
+            diff |= Fold::fold(load_word(first + 8 * i))
+                  ^ palindrome_reverse(Fold::fold(load_word(last - 8 * (i + 1))));
+        if (diff != 0)
+            return false;
+        first += 32;
+        last -= 32;
+    }
+    while (last - first >= 16)
+    {
+        if (Fold::fold(load_word(first)) != palindrome_reverse(Fold::fold(load_word(last - 8))))
+            return false;
+        first += 8;
+        last -= 8;
+    }
+    while (last - first >= 2)
+        if (Fold::fold(*first++) != Fold::fold(*--last))
+            return false;
+    return true;
+}
+
+//  How (if at all) the predicate can be applied to whole words
+template <typename Predicate, typename T>
+struct palindrome_fold { typedef void type; };
+
+template <typename T>
+struct palindrome_fold<std::equal_to<T>, T> { typedef palindrome_exact type; };
+
+template <typename T>
+struct palindrome_fold<ascii_iequal, T> { typedef palindrome_ascii_nocase type; };
+
+template <typename T> struct palindrome_is_byte : public boost::false_type {};
+template <> struct palindrome_is_byte<char> : public boost::true_type {};
+template <> struct palindrome_is_byte<signed char> : public boost::true_type {};
+template <> struct palindrome_is_byte<unsigned char> : public boost::true_type {};
+
+template <typename Iterator, typename Predicate, typename T, bool IsByte = palindrome_is_byte<T>::value>
+struct palindrome_words_impl : public boost::false_type {};
+
+template <typename Iterator, typename Predicate, typename T>
+struct palindrome_words_impl<Iterator, Predicate, T, true> : public boost::integral_constant<bool,
+       is_contiguous_scalars<Iterator>::value
+    && !boost::is_same<typename palindrome_fold<Predicate, T>::type, void>::value> {};
+
+template <typename Iterator, typename Predicate>
+struct palindrome_words : public palindrome_words_impl<Iterator, Predicate,
+    typename boost::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type> {};
+
 template <typename BidirectionalIterator, typename Predicate>
-bool is_palindrome(BidirectionalIterator begin, BidirectionalIterator end, Predicate p)
+bool is_palindrome(BidirectionalIterator begin, BidirectionalIterator end, Predicate p, boost::false_type)
 {
     if(begin == end)
     {
@@ -60,6 +176,39 @@ bool is_palindrome(BidirectionalIterator begin, BidirectionalIterator end, Predi
     return true;
 }
 
+template <typename ContiguousIterator, typename Predicate>
+bool is_palindrome(ContiguousIterator begin, ContiguousIterator end, Predicate, boost::true_type)
+{
+    typedef typename boost::remove_cv<typename std::iterator_traits<ContiguousIterator>::value_type>::type value_type;
+    if(begin == end)
+    {
+        return true;
+    }
+    const unsigned char* first = contiguous_bytes(begin);
+    return contiguous_palindrome<typename palindrome_fold<Predicate, value_type>::type>(first, first + (end - begin));
+}
+/// \endcond
+
+}
+
+/// \fn is_palindrome ( BidirectionalIterator begin, BidirectionalIterator end, Predicate p )
+/// \return true if the entire sequence is palindrome
+///
+/// \param begin    The start of the input sequence
+/// \param end		One past the end of the input sequence
+/// \param p        A predicate used to compare the values.
+///
+/// \note This function will return true for empty sequences and for palindromes.
+///     For other sequences function will return false.
+///     Complexity: O(N).
+///     Characters in contiguous memory (arrays, strings and vectors), compared
+///     with std::equal_to or ascii_iequal, are compared a word at a time.
+template <typename BidirectionalIterator, typename Predicate>
+bool is_palindrome(BidirectionalIterator begin, BidirectionalIterator end, Predicate p)
+{
+    return detail::is_palindrome(begin, end, p, detail::palindrome_words<BidirectionalIterator, Predicate>());
+}
+
 /// \fn is_palindrome ( BidirectionalIterator begin, BidirectionalIterator end )
 /// \return true if the entire sequence is palindrome
 ///
@@ -13,9 +13,13 @@
 #define BOOST_ALGORITHM_IS_PARTITIONED_UNTIL_HPP
 
 #include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/is_partitioned.hpp>
+
 namespace boost { namespace algorithm {
 
 /// \fn is_partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p )
@@ -29,18 +33,13 @@ namespace boost { namespace algorithm {
 /// \note Returns the first iterator 'it' in the sequence [first, last) for which is_partitioned(first, it, p) is false.
 ///     Returns last if the entire sequence is partitioned.
 ///     Complexity: O(N).
+/// \note p may be called on elements after the returned position: arrays of
+///     numbers are tested a block at a time. It is still called at most once
+///     on each element.
 template <typename InputIterator, typename UnaryPredicate>
 InputIterator is_partitioned_until ( InputIterator first, InputIterator last, UnaryPredicate p )
 {
-//  Run through the part that satisfy the predicate
-    for ( ; first != last; ++first )
-        if ( !p (*first))
-            break;
-//  Now the part that does not satisfy the predicate
-    for ( ; first != last; ++first )
-        if ( p (*first))
-            return first;
-    return last;
+    return boost::algorithm::detail::partitioned_until ( first, last, p );
 }
 
 /// \fn is_partitioned_until ( const Range &r, UnaryPredicate p )
@@ -53,12 +52,34 @@ InputIterator is_partitioned_until ( InputIterator first, InputIterator last, Un
 /// \note Returns the first iterator 'it' in the sequence [first, last) for which is_partitioned(first, it, p) is false.
 ///     Returns last if the entire sequence is partitioned.
 ///     Complexity: O(N).
+/// \note p may be called on elements after the returned position.
 template <typename Range, typename UnaryPredicate>
 typename boost::range_iterator<const Range>::type is_partitioned_until ( const Range &r, UnaryPredicate p )
 {
     return boost::algorithm::is_partitioned_until (boost::begin(r), boost::end(r), p);
 }
 
+/// \fn is_partitioned_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, UnaryPredicate p )
+/// \brief Tests to see if a sequence is partitioned according to a predicate,
+///     using an execution policy
+///
+/// \param policy   The execution policy (execution::seq or execution::par)
+/// \param first    The start of the input sequence
+/// \param last     One past the end of the input sequence
+/// \param p        The predicate to test the values with
+///
+/// \note Returns the same iterator as is_partitioned_until ( first, last, p ).
+///     With execution::par, a random access sequence is split into chunks
+///     that are tested concurrently; p must be safe to call from several
+///     threads at once.
+/// \note p may be called on elements after the returned position.
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+typename boost::enable_if<is_execution_policy<ExecutionPolicy>, ForwardIterator>::type
+is_partitioned_until ( const ExecutionPolicy &policy, ForwardIterator first, ForwardIterator last, UnaryPredicate p )
+{
+    return boost::algorithm::detail::policy_partitioned_until ( policy, first, last, p );
+}
+
 }}
 
 #endif  // BOOST_ALGORITHM_IS_PARTITIONED_UNTIL_HPP
@@ -26,9 +26,21 @@
  *                         std::max_element(first, last, comp) );
  */
 
+#include <algorithm> // for std::find
+#include <cstddef> // for std::ptrdiff_t
+#include <functional> // for std::less
+#include <iterator> // for std::iterator_traits
 #include <utility> // for std::pair and std::make_pair
+#include <vector>
 
 #include <boost/config.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/contiguous.hpp>
 
 namespace boost {
 
@@ -51,6 +63,111 @@ namespace boost {
       BinaryPredicate m_p;
     };
 
+    // Contiguous ranges of arithmetic values with the default comparison
+    // are searched a block at a time: first for the smallest and largest
+    // value of each block, in a loop that compilers can vectorize, and then
+    // for the position of the answer inside the block it came from.
+    // Comparisons with a NaN make the answer depend on the order in which
+    // the elements are compared, so a range containing one is handed back
+    // to the general algorithm (by returning false).
+
+    template <typename T>
+    inline bool minmax_is_nan(T, boost::false_type) { return false; }
+
+    template <typename T>
+    inline bool minmax_is_nan(T v, boost::true_type) { return v != v; }
+
+    template <bool LastMin, bool LastMax, typename T>
+    bool arithmetic_minmax_blocks(T* first, T* last, std::pair<T*,T*>& result)
+    {
+      typedef typename boost::remove_cv<T>::type value_type;
+      typedef typename boost::is_floating_point<value_type>::type is_float;
+      const std::ptrdiff_t block = 1024;
+
+      if (first == last) {
+        result = std::make_pair(last, last);
+        return true;
+      }
+
+      value_type min_value = *first, max_value = *first;
+      T* min_block = first;
+      T* max_block = first;
+      for (T* p = first; p != last; ) {
+        T* const block_end = (last - p > block) ? p + block : last;
+        value_type lo = *p, hi = *p;
+        bool nan = false;
+        for (T* q = p; q != block_end; ++q) {
+          const value_type v = *q;
+          lo = v < lo ? v : lo;
+          hi = hi < v ? v : hi;
+          nan |= minmax_is_nan(v, is_float());
+        }
+        if (nan)
+          return false;
+
+        if (LastMin ? !(min_value < lo) : lo < min_value) {
+          min_value = lo;
+          min_block = p;
+        }
+        if (LastMax ? !(hi < max_value) : max_value < hi) {
+          max_value = hi;
+          max_block = p;
+        }
+        p = block_end;
+      }
+
+      // equal values are equivalent, as there are no NaNs
+      T* min_end = (last - min_block > block) ? min_block + block : last;
+      T* max_end = (last - max_block > block) ? max_block + block : last;
+      if (LastMin)
+        while (!(*--min_end == min_value)) {}
+      else
+        while (!(*min_block == min_value)) ++min_block;
+      if (LastMax)
+        while (!(*--max_end == max_value)) {}
+      else
+        while (!(*max_block == max_value)) ++max_block;
+
+      result = std::make_pair(LastMin ? min_end : min_block,
+                              LastMax ? max_end : max_block);
+      return true;
+    }
+
+    // The ranges that are searched that way: arithmetic values next to each
+    // other in memory, given as pointers or as the iterators of std::vector
+    // or std::basic_string
+    template <typename Iterator>
+    struct is_arithmetic_minmax : public boost::integral_constant<bool,
+        algorithm::detail::is_contiguous_scalars<Iterator>::value &&
+        boost::is_arithmetic<typename std::iterator_traits<Iterator>::value_type>::value> {};
+
+    template <bool LastMin, bool LastMax, typename ContiguousIter>
+    bool arithmetic_minmax_element(ContiguousIter first, ContiguousIter last,
+                                   std::pair<ContiguousIter,ContiguousIter>& result)
+    {
+      if (first == last) {
+        result = std::make_pair(last, last);
+        return true;
+      }
+      typedef typename algorithm::detail::contiguous_element<ContiguousIter>::type T;
+      T* const p = algorithm::detail::contiguous_pointer(first);
+      std::pair<T*,T*> found;
+      if (!arithmetic_minmax_blocks<LastMin, LastMax>(p, p + (last - first), found))
+        return false;
+      result = std::make_pair(first + (found.first - p), first + (found.second - p));
+      return true;
+    }
+
+    // The comparison used when arithmetic_minmax_element gives up; it is a
+    // different type from less_over_iter, so it selects the general version.
+    template <typename Iterator>
+    struct arithmetic_minmax_fallback {
+      typedef typename boost::remove_cv<
+        typename std::iterator_traits<Iterator>::value_type>::type value_type;
+      typedef binary_pred_over_iter<Iterator, std::less<value_type> > type;
+      static type comp() { return type(std::less<value_type>()); }
+    };
+
     // common base for the two minmax_element overloads
 
     template <typename ForwardIter, class Compare >
@@ -118,6 +235,19 @@ namespace boost {
       return std::make_pair(min_result,max_result);
     }
 
+    template <typename ForwardIter>
+    typename boost::enable_if<is_arithmetic_minmax<ForwardIter>,
+                              std::pair<ForwardIter,ForwardIter> >::type
+    basic_minmax_element(ForwardIter first, ForwardIter last,
+                         less_over_iter<ForwardIter>)
+    {
+      std::pair<ForwardIter,ForwardIter> result;
+      if (arithmetic_minmax_element<false, false>(first, last, result))
+        return result;
+      return basic_minmax_element(first, last,
+               arithmetic_minmax_fallback<ForwardIter>::comp());
+    }
+
   } // namespace detail
 
   template <typename ForwardIter>
@@ -222,6 +352,18 @@ namespace boost {
     return min_result;
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>, ForwardIter>::type
+  basic_first_min_element(ForwardIter first, ForwardIter last,
+                          less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<false, false>(first, last, result))
+      return result.first;
+    return basic_first_min_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   template <typename ForwardIter, class BinaryPredicate>
   ForwardIter
   basic_last_min_element(ForwardIter first, ForwardIter last,
@@ -235,6 +377,18 @@ namespace boost {
     return min_result;
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>, ForwardIter>::type
+  basic_last_min_element(ForwardIter first, ForwardIter last,
+                         less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<true, false>(first, last, result))
+      return result.first;
+    return basic_last_min_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   template <typename ForwardIter, class BinaryPredicate>
   ForwardIter
   basic_first_max_element(ForwardIter first, ForwardIter last,
@@ -248,6 +402,18 @@ namespace boost {
     return max_result;
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>, ForwardIter>::type
+  basic_first_max_element(ForwardIter first, ForwardIter last,
+                          less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<false, false>(first, last, result))
+      return result.second;
+    return basic_first_max_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   template <typename ForwardIter, class BinaryPredicate>
   ForwardIter
   basic_last_max_element(ForwardIter first, ForwardIter last,
@@ -261,6 +427,18 @@ namespace boost {
     return max_result;
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>, ForwardIter>::type
+  basic_last_max_element(ForwardIter first, ForwardIter last,
+                         less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<false, true>(first, last, result))
+      return result.second;
+    return basic_last_max_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   } // namespace detail
 
   template <typename ForwardIter>
@@ -378,6 +556,19 @@ namespace boost {
     return std::make_pair(min_result, max_result);
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  basic_first_min_last_max_element(ForwardIter first, ForwardIter last,
+                                   less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<false, true>(first, last, result))
+      return result;
+    return basic_first_min_last_max_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   template <typename ForwardIter, class BinaryPredicate>
   std::pair<ForwardIter,ForwardIter>
   basic_last_min_first_max_element(ForwardIter first, ForwardIter last,
@@ -423,6 +614,19 @@ namespace boost {
     return std::make_pair(min_result, max_result);
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  basic_last_min_first_max_element(ForwardIter first, ForwardIter last,
+                                   less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<true, false>(first, last, result))
+      return result;
+    return basic_last_min_first_max_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   template <typename ForwardIter, class BinaryPredicate>
   std::pair<ForwardIter,ForwardIter>
   basic_last_min_last_max_element(ForwardIter first, ForwardIter last,
@@ -482,6 +686,19 @@ namespace boost {
     return std::make_pair(min_result,max_result);
   }
 
+  template <typename ForwardIter>
+  typename boost::enable_if<is_arithmetic_minmax<ForwardIter>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  basic_last_min_last_max_element(ForwardIter first, ForwardIter last,
+                                  less_over_iter<ForwardIter>)
+  {
+    std::pair<ForwardIter,ForwardIter> result;
+    if (arithmetic_minmax_element<true, true>(first, last, result))
+      return result;
+    return basic_last_min_last_max_element(first, last,
+             arithmetic_minmax_fallback<ForwardIter>::comp());
+  }
+
   } // namespace detail
 
   template <typename ForwardIter>
@@ -550,6 +767,235 @@ namespace boost {
              detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
   }
 
+  // Execution policy overloads of the minmax_element variants
+
+  namespace detail {
+
+  template <bool LastMin, bool LastMax> struct basic_minmax_variant;
+
+  template <> struct basic_minmax_variant<false, false> {
+    template <typename ForwardIter, class Compare>
+    static std::pair<ForwardIter,ForwardIter>
+    call(ForwardIter first, ForwardIter last, Compare comp)
+    { return basic_minmax_element(first, last, comp); }
+  };
+
+  template <> struct basic_minmax_variant<false, true> {
+    template <typename ForwardIter, class Compare>
+    static std::pair<ForwardIter,ForwardIter>
+    call(ForwardIter first, ForwardIter last, Compare comp)
+    { return basic_first_min_last_max_element(first, last, comp); }
+  };
+
+  template <> struct basic_minmax_variant<true, false> {
+    template <typename ForwardIter, class Compare>
+    static std::pair<ForwardIter,ForwardIter>
+    call(ForwardIter first, ForwardIter last, Compare comp)
+    { return basic_last_min_first_max_element(first, last, comp); }
+  };
+
+  template <> struct basic_minmax_variant<true, true> {
+    template <typename ForwardIter, class Compare>
+    static std::pair<ForwardIter,ForwardIter>
+    call(ForwardIter first, ForwardIter last, Compare comp)
+    { return basic_last_min_last_max_element(first, last, comp); }
+  };
+
+  template <typename Iterator>
+  bool minmax_has_nan(Iterator, Iterator, boost::false_type) { return false; }
+
+  template <typename Iterator>
+  bool minmax_has_nan(Iterator first, Iterator last, boost::true_type)
+  {
+    bool nan = false;
+    for (; first != last; ++first)
+      nan |= !(*first == *first);
+    return nan;
+  }
+
+  template <bool LastMin, bool LastMax, typename RandomIter, class Compare>
+  struct minmax_element_chunk {
+    typedef typename boost::remove_cv<
+      typename std::iterator_traits<RandomIter>::value_type>::type value_type;
+    minmax_element_chunk(RandomIter first, std::size_t n, std::size_t chunks,
+                         std::pair<RandomIter,RandomIter>* results, char* nans,
+                         Compare comp)
+      : m_first(first), m_n(n), m_chunks(chunks), m_results(results),
+        m_nans(nans), m_comp(comp) {}
+    void operator()(std::size_t i) const {
+      const RandomIter first = m_first + algorithm::detail::chunk_offset(i, m_chunks, m_n);
+      const RandomIter last = m_first + algorithm::detail::chunk_offset(i + 1, m_chunks, m_n);
+      m_nans[i] = minmax_has_nan(first, last,
+                    typename boost::is_floating_point<value_type>::type());
+      m_results[i] = basic_minmax_variant<LastMin, LastMax>::call(first, last, m_comp);
+    }
+  private:
+    RandomIter m_first;
+    std::size_t m_n, m_chunks;
+    std::pair<RandomIter,RandomIter>* m_results;
+    char* m_nans;
+    Compare m_comp;
+  };
+
+  template <bool LastMin, bool LastMax, typename ForwardIter, class Compare>
+  std::pair<ForwardIter,ForwardIter>
+  policy_minmax_element(const algorithm::execution::sequenced_policy&,
+                        ForwardIter first, ForwardIter last, Compare comp)
+  {
+    return basic_minmax_variant<LastMin, LastMax>::call(first, last, comp);
+  }
+
+  template <bool LastMin, bool LastMax, typename ForwardIter, class Compare>
+  std::pair<ForwardIter,ForwardIter>
+  parallel_minmax_element(const algorithm::execution::parallel_policy&,
+                          ForwardIter first, ForwardIter last, Compare comp,
+                          std::forward_iterator_tag)
+  {
+    return basic_minmax_variant<LastMin, LastMax>::call(first, last, comp);
+  }
+
+  // Each chunk is searched with the sequential algorithm; the results are
+  // then combined in order, keeping the tie-breaking rule of the variant.
+  // That gives the same answer as one sequential search only when the
+  // comparison is a strict weak ordering. Comparisons with a NaN usually
+  // aren't, and make the answer depend on which elements were compared, so
+  // a floating point range containing one is searched again sequentially.
+  template <bool LastMin, bool LastMax, typename RandomIter, class Compare>
+  std::pair<RandomIter,RandomIter>
+  parallel_minmax_element(const algorithm::execution::parallel_policy& policy,
+                          RandomIter first, RandomIter last, Compare comp,
+                          std::random_access_iterator_tag)
+  {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    const std::size_t chunks = algorithm::detail::parallel_chunk_count(policy, n, 1 << 15);
+    if (chunks <= 1)
+      return basic_minmax_variant<LastMin, LastMax>::call(first, last, comp);
+
+    std::vector<std::pair<RandomIter,RandomIter> > results(chunks);
+    std::vector<char> nans(chunks);
+    algorithm::detail::parallel_run(chunks,
+      minmax_element_chunk<LastMin, LastMax, RandomIter, Compare>(first, n, chunks, &results[0], &nans[0], comp));
+    if (std::find(nans.begin(), nans.end(), 1) != nans.end())
+      return basic_minmax_variant<LastMin, LastMax>::call(first, last, comp);
+
+    std::pair<RandomIter,RandomIter> result = results[0];
+    for (std::size_t i = 1; i < chunks; ++i) {
+      if (LastMin ? !comp(result.first, results[i].first)
+                  : comp(results[i].first, result.first))
+        result.first = results[i].first;
+      if (LastMax ? !comp(results[i].second, result.second)
+                  : comp(result.second, results[i].second))
+        result.second = results[i].second;
+    }
+    return result;
+  }
+
+  template <bool LastMin, bool LastMax, typename ForwardIter, class Compare>
+  std::pair<ForwardIter,ForwardIter>
+  policy_minmax_element(const algorithm::execution::parallel_policy& policy,
+                        ForwardIter first, ForwardIter last, Compare comp)
+  {
+    return parallel_minmax_element<LastMin, LastMax>(policy, first, last, comp,
+             typename std::iterator_traits<ForwardIter>::iterator_category());
+  }
+
+  } // namespace detail
+
+  template <class ExecutionPolicy, typename ForwardIter>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  minmax_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last)
+  {
+    return detail::policy_minmax_element<false, false>(policy, first, last,
+             detail::less_over_iter<ForwardIter>() );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter, class BinaryPredicate>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  minmax_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last,
+                 BinaryPredicate comp)
+  {
+    return detail::policy_minmax_element<false, false>(policy, first, last,
+             detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  first_min_first_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last)
+  {
+    return detail::policy_minmax_element<false, false>(policy, first, last,
+             detail::less_over_iter<ForwardIter>() );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter, class BinaryPredicate>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  first_min_first_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last,
+                              BinaryPredicate comp)
+  {
+    return detail::policy_minmax_element<false, false>(policy, first, last,
+             detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  first_min_last_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last)
+  {
+    return detail::policy_minmax_element<false, true>(policy, first, last,
+             detail::less_over_iter<ForwardIter>() );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter, class BinaryPredicate>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  first_min_last_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last,
+                             BinaryPredicate comp)
+  {
+    return detail::policy_minmax_element<false, true>(policy, first, last,
+             detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  last_min_first_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last)
+  {
+    return detail::policy_minmax_element<true, false>(policy, first, last,
+             detail::less_over_iter<ForwardIter>() );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter, class BinaryPredicate>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  last_min_first_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last,
+                             BinaryPredicate comp)
+  {
+    return detail::policy_minmax_element<true, false>(policy, first, last,
+             detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  last_min_last_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last)
+  {
+    return detail::policy_minmax_element<true, true>(policy, first, last,
+             detail::less_over_iter<ForwardIter>() );
+  }
+
+  template <class ExecutionPolicy, typename ForwardIter, class BinaryPredicate>
+  typename boost::enable_if<algorithm::is_execution_policy<ExecutionPolicy>,
+                            std::pair<ForwardIter,ForwardIter> >::type
+  last_min_last_max_element(const ExecutionPolicy& policy, ForwardIter first, ForwardIter last,
+                            BinaryPredicate comp)
+  {
+    return detail::policy_minmax_element<true, true>(policy, first, last,
+             detail::binary_pred_over_iter<ForwardIter,BinaryPredicate>(comp) );
+  }
+
 } // namespace boost
 
 #endif // BOOST_ALGORITHM_MINMAX_ELEMENT_HPP
@@ -18,16 +18,29 @@
 #ifndef BOOST_ALGORITHM_SORT_SUBRANGE_HPP
 #define BOOST_ALGORITHM_SORT_SUBRANGE_HPP
 
+#include <cstddef>          // For std::size_t
 #include <functional>       // For std::less
 #include <iterator>         // For std::iterator_traits
-#include <algorithm>        // For nth_element and partial_sort
+#include <algorithm>        // For nth_element, partial_sort and sort
 
 #include <boost/config.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/core/enable_if.hpp>
+
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/detail/parallel_select.hpp>
 
 namespace boost { namespace algorithm {
 
+  namespace detail {
+/// \cond DOXYGEN_HIDE
+//	partial_sort finds a window this many times smaller than the rest of
+//	the range faster than a second nth_element and a sort.
+  	const std::size_t subrange_heap_ratio = 128;
+/// \endcond
+  	}
+
 /// \fn sort_subrange ( T const& val, 
 ///               Iterator first,     Iterator last, 
 ///               Iterator sub_first, Iterator sub_last, 
@@ -41,6 +54,10 @@ namespace boost { namespace algorithm {
 /// \param sub_last    The end of the sub range
 /// \param p           A predicate to use to compare the values.
 ///                        p ( a, b ) returns a boolean.
+///
+/// \note Unless the subrange is very small compared to the rest of the range
+///     (when a partial_sort is used), both ends of the subrange are selected
+///     with nth_element, and then only the subrange is sorted.
 ///
   template<typename Iterator, typename Pred> 
   void sort_subrange (
@@ -54,7 +71,17 @@ namespace boost { namespace algorithm {
   		(void) std::nth_element(first, sub_first, last, p);
   		++sub_first;
   		}
-  	std::partial_sort(sub_first, sub_last, last, p);
+
+//	A small window is best found with a heap; otherwise select its end too,
+//	and sort just the window.
+  	if (static_cast<std::size_t>(sub_last - sub_first) * detail::subrange_heap_ratio
+  			< static_cast<std::size_t>(last - sub_first))
+  		std::partial_sort(sub_first, sub_last, last, p);
+  	else {
+  		if (sub_last != last)
+  			(void) std::nth_element(sub_first, sub_last, last, p);
+  		std::sort(sub_first, sub_last, p);
+  		}
   }
 
 
@@ -105,6 +132,256 @@ namespace boost { namespace algorithm {
   	return partition_subrange(first, last, sub_first, sub_last, std::less<value_type>());
   }
 
+/// \fn sort_subrange ( ExecutionPolicy &&policy,
+///               Iterator first,     Iterator last, 
+///               Iterator sub_first, Iterator sub_last, 
+///               Pred p )
+/// \brief Sort the subrange [sub_first, sub_last) that is inside
+///     the range [first, last) as if you had sorted the entire range,
+///     using the execution policy 'policy'.
+/// 
+/// \param policy      The execution policy (execution::seq or execution::par)
+/// \param first       The start of the larger range
+/// \param last        The end of the larger range
+/// \param sub_first   The start of the sub range
+/// \param sub_last    The end of the sub range
+/// \param p           A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+///
+/// \note With execution::par, a sorted sample of the range gives two values
+///     that bracket the subrange, and the elements between them are moved
+///     (in parallel) to the middle of the range; only those are then selected
+///     and sorted. This needs a value type whose moves don't throw; other
+///     types, and small ranges, get the sequential algorithm.
+///
+  template<typename ExecutionPolicy, typename Iterator, typename Pred> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+  sort_subrange (
+  	const ExecutionPolicy &policy,
+  	Iterator first,     Iterator last, 
+  	Iterator sub_first, Iterator sub_last,
+  	Pred p)
+  {
+  	if (sub_first == sub_last) return;
+  	detail::select_window(policy, first, last, sub_first, sub_last, p);
+  	sort_subrange(first, last, sub_first, sub_last, p);
+  }
+
+  template<typename ExecutionPolicy, typename Iterator> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+  sort_subrange (const ExecutionPolicy &policy, Iterator first, Iterator last, Iterator sub_first, Iterator sub_last)
+  {
+  	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+  	sort_subrange(policy, first, last, sub_first, sub_last, std::less<value_type>());
+  }
+
+/// \fn partition_subrange ( ExecutionPolicy &&policy,
+///               Iterator first,     Iterator last, 
+///               Iterator sub_first, Iterator sub_last, 
+///               Pred p )
+/// \brief Gather the elements of the subrange [sub_first, sub_last) that is 
+///     inside the range [first, last) as if you had sorted the entire range,
+///     using the execution policy 'policy'.
+/// 
+/// \param policy      The execution policy (execution::seq or execution::par)
+/// \param first       The start of the larger range
+/// \param last        The end of the larger range
+/// \param sub_first   The start of the sub range
+/// \param sub_last    The end of the sub range
+/// \param p           A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+///
+  template<typename ExecutionPolicy, typename Iterator, typename Pred> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+  partition_subrange (
+  	const ExecutionPolicy &policy,
+  	Iterator first,     Iterator last, 
+  	Iterator sub_first, Iterator sub_last,
+  	Pred p)
+  {
+  	if (sub_first == sub_last) return;
+  	detail::select_window(policy, first, last, sub_first, sub_last, p);
+  	partition_subrange(first, last, sub_first, sub_last, p);
+  }
+
+  template<typename ExecutionPolicy, typename Iterator> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy> >::type
+  partition_subrange (const ExecutionPolicy &policy, Iterator first, Iterator last, Iterator sub_first, Iterator sub_last)
+  {
+  	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+  	partition_subrange(policy, first, last, sub_first, sub_last, std::less<value_type>());
+  }
+
+  namespace detail {
+/// \cond DOXYGEN_HIDE
+//	Partition [first, last) at each of the cuts [cut_first, cut_last), by
+//	selecting the middle cut and then the cuts on either side of it. A cut
+//	at the start or the end of the range needs nothing.
+  	template<typename Iterator, typename CutIterator, typename Pred>
+  	void select_cuts (
+  		Iterator first, Iterator last,
+  		CutIterator cut_first, CutIterator cut_last,
+  		Pred p)
+  	{
+  		while (cut_first != cut_last) {
+  			if (!(first < *cut_first)) { ++cut_first; continue; }
+  			CutIterator cut_mid = cut_first;
+  			std::advance(cut_mid, std::distance(cut_first, cut_last) / 2);
+  			const Iterator mid = *cut_mid;
+  			if (!(mid < last)) { cut_last = cut_mid; continue; }
+
+  			(void) std::nth_element(first, mid, last, p);
+  			select_cuts(first, mid, cut_first, cut_mid, p);
+  			first = mid;
+  			++first;
+  			cut_first = ++cut_mid;
+  			}
+  	}
+/// \endcond
+  	}
+
+/// \fn partition_subranges ( Iterator first, Iterator last, 
+///               CutIterator cut_first, CutIterator cut_last, 
+///               Pred p )
+/// \brief Partition the range [first, last) at each of the positions in
+///     [cut_first, cut_last) as if you had sorted the entire range: the elements
+///     between two adjacent cuts are the ones that would be there after sorting.
+/// 
+/// \param first       The start of the range
+/// \param last        The end of the range
+/// \param cut_first   The start of the (sorted) sequence of positions in [first, last]
+/// \param cut_last    The end of the sequence of positions
+/// \param p           A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+///
+/// \note This takes O(N log K) time for K cuts, rather than O(N K) for K
+///     calls to partition_subrange.
+///
+  template<typename Iterator, typename CutIterator, typename Pred> 
+  void partition_subranges (
+  	Iterator first, Iterator last, 
+  	CutIterator cut_first, CutIterator cut_last,
+  	Pred p)
+  {
+  	detail::select_cuts(first, last, cut_first, cut_last, p);
+  }
+
+  template<typename Iterator, typename CutIterator> 
+  void partition_subranges (Iterator first, Iterator last, CutIterator cut_first, CutIterator cut_last)
+  {
+  	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+  	return partition_subranges(first, last, cut_first, cut_last, std::less<value_type>());
+  }
+
+/// \fn sort_subranges ( Iterator first, Iterator last, 
+///               CutIterator cut_first, CutIterator cut_last, 
+///               Pred p )
+/// \brief Sort the subranges [cut[0], cut[1]), [cut[2], cut[3]), ... of the range
+///     [first, last) as if you had sorted the entire range. If there is an odd
+///     number of cuts, the last subrange runs to the end of the range.
+/// 
+/// \param first       The start of the range
+/// \param last        The end of the range
+/// \param cut_first   The start of the (sorted) sequence of positions in [first, last]
+/// \param cut_last    The end of the sequence of positions
+/// \param p           A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+///
+/// \note The range is partitioned at all the cuts at once, as by
+///     partition_subranges, and then each subrange is sorted.
+///
+  template<typename Iterator, typename CutIterator, typename Pred> 
+  void sort_subranges (
+  	Iterator first, Iterator last, 
+  	CutIterator cut_first, CutIterator cut_last,
+  	Pred p)
+  {
+  	detail::select_cuts(first, last, cut_first, cut_last, p);
+  	while (cut_first != cut_last) {
+  		const Iterator sub_first = *cut_first++;
+  		const Iterator sub_last = cut_first == cut_last ? last : *cut_first++;
+  		std::sort(sub_first, sub_last, p);
+  		}
+  }
+
+  template<typename Iterator, typename CutIterator> 
+  void sort_subranges (Iterator first, Iterator last, CutIterator cut_first, CutIterator cut_last)
+  {
+  	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+  	return sort_subranges(first, last, cut_first, cut_last, std::less<value_type>());
+  }
+
+/// \fn top_k_copy ( InputIterator first, InputIterator last, 
+///               RandomIterator result_first, RandomIterator result_last, 
+///               Pred p )
+/// \brief Copy the smallest min(N, K) elements of [first, last), in order, to
+///     [result_first, result_last), where K is the size of the output; the
+///     input is not changed.
+/// 
+/// \param first        The start of the input sequence
+/// \param last         The end of the input sequence
+/// \param result_first The start of the output range
+/// \param result_last  The end of the output range
+/// \param p            A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+/// \return             The end of the elements written
+///
+  template<typename InputIterator, typename RandomIterator, typename Pred> 
+  RandomIterator top_k_copy (
+  	InputIterator first, InputIterator last, 
+  	RandomIterator result_first, RandomIterator result_last,
+  	Pred p)
+  {
+  	return std::partial_sort_copy(first, last, result_first, result_last, p);
+  }
+
+  template<typename InputIterator, typename RandomIterator> 
+  RandomIterator top_k_copy (InputIterator first, InputIterator last, RandomIterator result_first, RandomIterator result_last)
+  {
+  	typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+  	return top_k_copy(first, last, result_first, result_last, std::less<value_type>());
+  }
+
+/// \fn top_k_copy ( ExecutionPolicy &&policy,
+///               InputIterator first, InputIterator last, 
+///               RandomIterator result_first, RandomIterator result_last, 
+///               Pred p )
+/// \brief Copy the smallest min(N, K) elements of [first, last), in order, to
+///     [result_first, result_last), using the execution policy 'policy'.
+/// 
+/// \param policy       The execution policy (execution::seq or execution::par)
+/// \param first        The start of the input sequence
+/// \param last         The end of the input sequence
+/// \param result_first The start of the output range
+/// \param result_last  The end of the output range
+/// \param p            A predicate to use to compare the values.
+///                        p ( a, b ) returns a boolean.
+/// \return             The end of the elements written
+///
+/// \note With execution::par, each thread keeps a heap of (iterators to) the
+///     K smallest elements of its part of the input, and the heaps are merged
+///     at the end. This pays when K is small compared to N; otherwise, and
+///     for input that isn't random access, it is a partial_sort_copy.
+///
+  template<typename ExecutionPolicy, typename InputIterator, typename RandomIterator, typename Pred> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy>, RandomIterator>::type
+  top_k_copy (
+  	const ExecutionPolicy &policy,
+  	InputIterator first, InputIterator last, 
+  	RandomIterator result_first, RandomIterator result_last,
+  	Pred p)
+  {
+  	return detail::policy_top_k_copy(policy, first, last, result_first, result_last, p);
+  }
+
+  template<typename ExecutionPolicy, typename InputIterator, typename RandomIterator> 
+  typename boost::enable_if<is_execution_policy<ExecutionPolicy>, RandomIterator>::type
+  top_k_copy (const ExecutionPolicy &policy, InputIterator first, InputIterator last, RandomIterator result_first, RandomIterator result_last)
+  {
+  	typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+  	return top_k_copy(policy, first, last, result_first, result_last, std::less<value_type>());
+  }
+
 }}
 
 #endif // BOOST_ALGORITHM_SORT_SUBRANGE_HPP
@@ -0,0 +1,142 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Compares boost::minmax_element and its variants with std::minmax_element
+//  and with separate std::min_element / std::max_element passes, on sorted,
+//  reversed, random and duplicate-heavy input, with the default comparison,
+//  a cheap comparison object and an expensive one. The searches are made
+//  over pointers, so boost's block-wise search for arithmetic values is used
+//  with the default comparison.
+//
+//  Usage: minmax_bench [size [repeats]]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/minmax_element.hpp>
+
+typedef std::chrono::steady_clock clock_type;
+
+int repeats = 20;
+
+//  Keeps the results alive, so the searches are not optimized away
+std::size_t sink = 0;
+
+template <class Iterator>
+void consume(Iterator first, std::pair<Iterator, Iterator> p)
+{
+  sink += static_cast<std::size_t>((p.first - first) + (p.second - first));
+}
+
+template <class Func>
+void time_it(const char* name, std::size_t n, Func f)
+{
+  const clock_type::time_point start = clock_type::now();
+  for (int i = 0; i < repeats; ++i)
+    f();
+  const std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+  std::cout << "    " << std::setw(8) << std::fixed << std::setprecision(3)
+            << elapsed.count() / (double(n) * repeats) << " ns/item  " << name << "\n";
+}
+
+struct cheap_less {
+  template <class T>
+  bool operator()(const T& a, const T& b) const { return a < b; }
+};
+
+//  Strings sharing a long prefix, so every comparison walks most of it
+struct expensive_less {
+  bool operator()(const std::string& a, const std::string& b) const
+  { return a.compare(b) < 0; }
+};
+
+template <class Container>
+void run_default(const Container& v)
+{
+  typedef const typename Container::value_type* iterator;
+  const iterator first = v.data(), last = v.data() + v.size();
+  const std::size_t n = v.size();
+
+  time_it("boost::minmax_element", n, [&] { consume(first, boost::minmax_element(first, last)); });
+  time_it("boost::first_min_last_max_element", n, [&] { consume(first, boost::first_min_last_max_element(first, last)); });
+  time_it("boost::last_min_first_max_element", n, [&] { consume(first, boost::last_min_first_max_element(first, last)); });
+  time_it("boost::last_min_last_max_element", n, [&] { consume(first, boost::last_min_last_max_element(first, last)); });
+  time_it("boost::minmax_element (par)", n, [&] { consume(first, boost::minmax_element(boost::algorithm::execution::par, first, last)); });
+  time_it("std::minmax_element", n, [&] { consume(first, std::minmax_element(first, last)); });
+  time_it("std::min_element + std::max_element", n, [&] {
+    consume(first, std::make_pair(std::min_element(first, last), std::max_element(first, last))); });
+}
+
+template <class Container, class Compare>
+void run_compare(const Container& v, Compare comp)
+{
+  typedef const typename Container::value_type* iterator;
+  const iterator first = v.data(), last = v.data() + v.size();
+  const std::size_t n = v.size();
+
+  time_it("boost::minmax_element", n, [&] { consume(first, boost::minmax_element(first, last, comp)); });
+  time_it("boost::first_min_last_max_element", n, [&] { consume(first, boost::first_min_last_max_element(first, last, comp)); });
+  time_it("boost::last_min_first_max_element", n, [&] { consume(first, boost::last_min_first_max_element(first, last, comp)); });
+  time_it("boost::last_min_last_max_element", n, [&] { consume(first, boost::last_min_last_max_element(first, last, comp)); });
+  time_it("boost::minmax_element (par)", n, [&] { consume(first, boost::minmax_element(boost::algorithm::execution::par, first, last, comp)); });
+  time_it("std::minmax_element", n, [&] { consume(first, std::minmax_element(first, last, comp)); });
+  time_it("std::min_element + std::max_element", n, [&] {
+    consume(first, std::make_pair(std::min_element(first, last, comp), std::max_element(first, last, comp))); });
+}
+
+enum input_kind { sorted_input, reversed_input, random_input, duplicate_input };
+const char* const input_names[] = { "sorted", "reversed", "random", "many duplicates" };
+
+std::vector<int> make_ints(std::size_t n, input_kind kind)
+{
+  std::vector<int> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = kind == duplicate_input ? std::rand() % 8 : kind == random_input ? std::rand() : static_cast<int>(i);
+  if (kind == reversed_input)
+    std::reverse(v.begin(), v.end());
+  return v;
+}
+
+std::vector<std::string> make_strings(const std::vector<int>& ints)
+{
+  const std::string prefix(48, 'x');
+  std::vector<std::string> v;
+  v.reserve(ints.size());
+  for (std::size_t i = 0; i < ints.size(); ++i) {
+    char digits[16];
+    std::sprintf(digits, "%010d", ints[i]);
+    v.push_back(prefix + digits);
+  }
+  return v;
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t n = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 1 << 20;
+  if (argc > 2)
+    repeats = std::atoi(argv[2]);
+
+  for (int k = sorted_input; k <= duplicate_input; ++k) {
+    const std::vector<int> ints = make_ints(n, input_kind(k));
+    std::cout << n << " ints, " << input_names[k] << ", default comparison\n";
+    run_default(ints);
+    std::cout << n << " ints, " << input_names[k] << ", cheap comparison object\n";
+    run_compare(ints, cheap_less());
+
+    const std::vector<std::string> strings = make_strings(ints);
+    std::cout << n << " strings, " << input_names[k] << ", expensive comparison\n";
+    run_compare(strings, expensive_less());
+  }
+
+  std::cout << "(checksum " << sink << ")\n";
+  return 0;
+}
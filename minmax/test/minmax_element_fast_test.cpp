@@ -0,0 +1,179 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The block-wise search for contiguous arithmetic ranges, and the
+//  execution policy overloads, must find the same elements as the
+//  general algorithm.
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/algorithm/minmax_element.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ex = boost::algorithm::execution;
+
+template <class T>
+struct plain_less {
+  bool operator()(const T& x, const T& y) const { return x < y; }
+};
+
+//  A comparison that is not std::less, so it takes the general algorithm
+#define CHECK_VARIANT(fn, v)                                                  \
+  do {                                                                        \
+    typedef plain_less<typename Container::value_type> cmp;                   \
+    T* first = v.empty() ? 0 : &v[0];                                         \
+    T* last = first + v.size();                                               \
+    std::pair<T*,T*> expected = boost::fn(first, last, cmp());                \
+    BOOST_CHECK(boost::fn(first, last) == expected);                          \
+    BOOST_CHECK(boost::fn(ex::seq, first, last) == expected);                 \
+    BOOST_CHECK(boost::fn(ex::par, first, last) == expected);                 \
+    BOOST_CHECK(boost::fn(ex::par(3), first, last) == expected);              \
+    BOOST_CHECK(boost::fn(ex::par(7), first, last, cmp()) == expected);       \
+  } while (false)
+
+template <class Container>
+void test_variants(Container& v)
+{
+  typedef typename Container::value_type T;
+  CHECK_VARIANT(minmax_element, v);
+  CHECK_VARIANT(first_min_first_max_element, v);
+  CHECK_VARIANT(first_min_last_max_element, v);
+  CHECK_VARIANT(last_min_first_max_element, v);
+  CHECK_VARIANT(last_min_last_max_element, v);
+
+  typedef plain_less<T> cmp;
+  T* first = v.empty() ? 0 : &v[0];
+  T* last = first + v.size();
+  BOOST_CHECK(boost::first_min_element(first, last) == boost::first_min_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_min_element(first, last) == boost::last_min_element(first, last, cmp()));
+  BOOST_CHECK(boost::first_max_element(first, last) == boost::first_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_max_element(first, last) == boost::last_max_element(first, last, cmp()));
+}
+
+template <class T>
+void test_type(int range)
+{
+  const int sizes[] = { 0, 1, 2, 3, 1023, 1024, 1025, 5000, 100000, 300001 };
+  for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    std::vector<T> v(sizes[i]);
+    for (std::size_t j = 0; j < v.size(); ++j)
+      v[j] = static_cast<T>(std::rand() % range - range / 2);
+    test_variants(v);
+
+    //  Sorted and reversed: the extremes sit in the first and last blocks
+    for (std::size_t j = 0; j < v.size(); ++j)
+      v[j] = static_cast<T>(j % range);
+    test_variants(v);
+    std::reverse(v.begin(), v.end());
+    test_variants(v);
+  }
+}
+
+void test_nan()
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> v(5000);
+  for (std::size_t j = 0; j < v.size(); ++j)
+    v[j] = static_cast<double>(std::rand() % 100);
+  v[0] = nan;
+  test_variants(v);
+  v[0] = 1.0;
+  v[2500] = nan;
+  test_variants(v);
+  v[4999] = nan;
+  test_variants(v);
+
+  //  Long enough to be split into chunks, with the NaN in a later chunk
+  //  than the extremes, where it changes what the sequential search finds
+  std::vector<double> w(300001);
+  for (std::size_t j = 0; j < w.size(); ++j)
+    w[j] = static_cast<double>(std::rand() % 100);
+  w[10] = -1.0;
+  w[20] = 1000.0;
+  w[200000] = nan;
+  test_variants(w);
+  w[200000] = 5.0;
+  w[0] = nan;
+  test_variants(w);
+  w[0] = 5.0;
+  w[w.size() - 1] = nan;
+  test_variants(w);
+}
+
+//  The iterators of a std::vector take the block-wise search too
+template <class Iterator>
+void check_iterators(Iterator first, Iterator last)
+{
+  typedef plain_less<typename std::iterator_traits<Iterator>::value_type> cmp;
+  BOOST_CHECK(boost::minmax_element(first, last) == boost::minmax_element(first, last, cmp()));
+  BOOST_CHECK(boost::first_min_last_max_element(first, last)
+              == boost::first_min_last_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_min_first_max_element(first, last)
+              == boost::last_min_first_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_min_last_max_element(first, last)
+              == boost::last_min_last_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_min_last_max_element(ex::par(3), first, last)
+              == boost::last_min_last_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::first_min_element(first, last) == boost::first_min_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_min_element(first, last) == boost::last_min_element(first, last, cmp()));
+  BOOST_CHECK(boost::first_max_element(first, last) == boost::first_max_element(first, last, cmp()));
+  BOOST_CHECK(boost::last_max_element(first, last) == boost::last_max_element(first, last, cmp()));
+}
+
+void test_vector_iterators()
+{
+  BOOST_STATIC_ASSERT((boost::detail::is_arithmetic_minmax<std::vector<double>::iterator>::value));
+  BOOST_STATIC_ASSERT((boost::detail::is_arithmetic_minmax<std::vector<int>::const_iterator>::value));
+  BOOST_STATIC_ASSERT((!boost::detail::is_arithmetic_minmax<std::list<int>::iterator>::value));
+
+  std::vector<double> v(5000);
+  for (std::size_t j = 0; j < v.size(); ++j)
+    v[j] = static_cast<double>(std::rand() % 100);
+  const std::vector<double>& cv = v;
+  check_iterators(v.begin(), v.end());
+  check_iterators(cv.begin(), cv.end());
+  v[2500] = std::numeric_limits<double>::quiet_NaN();
+  check_iterators(v.begin(), v.end());
+  check_iterators(cv.begin(), cv.end());
+
+  std::vector<int> w(300001);
+  for (std::size_t j = 0; j < w.size(); ++j)
+    w[j] = std::rand() % 10;
+  check_iterators(w.begin(), w.end());
+}
+
+void test_forward_iterators()
+{
+  std::list<int> l;
+  for (int i = 0; i < 1000; ++i)
+    l.push_back(std::rand() % 10);
+  BOOST_CHECK(boost::minmax_element(ex::par, l.begin(), l.end())
+              == boost::minmax_element(l.begin(), l.end()));
+  BOOST_CHECK(boost::last_min_last_max_element(ex::par, l.begin(), l.end())
+              == boost::last_min_last_max_element(l.begin(), l.end()));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_type<int>(10);           // lots of duplicates
+  test_type<int>(1 << 30);
+  test_type<unsigned char>(256);
+  test_type<long long>(1000);
+  test_type<float>(100);
+  test_type<double>(1 << 20);
+  test_nan();
+  test_vector_iterators();
+  test_forward_iterators();
+}
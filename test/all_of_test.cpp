@@ -8,12 +8,14 @@
 */
 
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/algorithm/cxx11/all_of.hpp>
 
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
 
 #include <functional>
+#include <limits>
 #include <vector>
 #include <list>
 
@@ -88,7 +90,20 @@ void test_all ()
 }
 
 
+//  Arrays of numbers take the word at a time search, which is tested on
+//  its own in count_up_to_test.cpp
+void test_numbers ()
+{
+    BOOST_STATIC_ASSERT (( ba::detail::is_value_searchable<std::vector<double>::iterator, int>::type::value ));
+    std::vector<double> v ( 100, -0.0 );
+    BOOST_CHECK ( ba::all_of_equal ( v.begin (), v.end (), 0 ));
+    v [ 99 ] = std::numeric_limits<double>::quiet_NaN ();
+    BOOST_CHECK ( !ba::all_of_equal ( v, 0.0 ));
+}
+
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_all ();
+  test_numbers ();
 }
@@ -8,6 +8,7 @@
 */
 
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/algorithm/cxx11/any_of.hpp>
 
 #define BOOST_TEST_MAIN
@@ -108,7 +109,21 @@ void test_any ()
 }
 
 
+//  Arrays of numbers take the word at a time search, which is tested on
+//  its own in count_up_to_test.cpp
+void test_numbers ()
+{
+    BOOST_STATIC_ASSERT (( ba::detail::is_value_searchable<std::vector<short>::iterator, int>::type::value ));
+    std::vector<short> v ( 100, 0 );
+    BOOST_CHECK ( !ba::any_of_equal ( v.begin (), v.end (), 5 ));
+    v [ 70 ] = 5;
+    BOOST_CHECK ( ba::any_of_equal ( v, 5 ));
+    BOOST_CHECK ( !ba::any_of_equal ( v, 5 + 65536 ));
+}
+
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_any ();
+  test_numbers ();
 }
@@ -8,15 +8,21 @@
   See http://www.boost.org/ for latest version.
 */
 
+#include <algorithm>
+#include <cstdlib>
+#include <string>
 #include <vector>
 
+#include <boost/config.hpp>
 #include <boost/algorithm/apply_permutation.hpp>
+#include <boost/algorithm/execution.hpp>
 
 #define BOOST_TEST_MAIN
 
 #include <boost/test/included/unit_test.hpp>
 
 namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
 
 
 BOOST_AUTO_TEST_CASE(test_apply_permutation)
@@ -160,3 +166,185 @@ BOOST_AUTO_TEST_CASE(test_apply_reverse_permutation)
         BOOST_CHECK_EQUAL_COLLECTIONS(vec.begin(), vec.end(), result.begin(), result.end());
     }
 }
+
+namespace {
+    std::vector<int> random_permutation(std::size_t size)
+    {
+        std::vector<int> order;
+        for (std::size_t i = 0; i < size; ++i)
+            order.push_back(static_cast<int>(i));
+        for (std::size_t i = size; i > 1; --i)
+            std::swap(order[i - 1], order[std::rand() % i]);
+        return order;
+    }
+
+    bool is_identity(const std::vector<int>& order)
+    {
+        for (std::size_t i = 0; i < order.size(); ++i)
+            if (order[i] != static_cast<int>(i))
+                return false;
+        return true;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_apply_permutation_variants)
+{
+    const std::size_t sizes[] = { 0, 1, 2, 15, 16, 17, 100, 1000, 10007 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const std::size_t size = sizes[s];
+        std::vector<std::string> items;
+        for (std::size_t i = 0; i < size; ++i)
+            items.push_back(std::string(i % 40, 'x') + static_cast<char>('a' + i % 26));
+        const std::vector<int> order = random_permutation(size);
+
+        std::vector<std::string> gathered(size), scattered(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            gathered[i] = items[order[i]];
+            scattered[order[i]] = items[i];
+        }
+
+        //Const indices are left alone
+        {
+            std::vector<std::string> vec = items;
+            ba::apply_permutation(vec, order);
+            BOOST_CHECK(vec == gathered);
+            vec = items;
+            ba::apply_reverse_permutation(vec, order);
+            BOOST_CHECK(vec == scattered);
+            vec = items;
+            ba::apply_permutation(vec.begin(), vec.end(), order.begin(), order.end());
+            BOOST_CHECK(vec == gathered);
+        }
+        //Mutable indices become the identity
+        {
+            std::vector<std::string> vec = items;
+            std::vector<int> ind = order;
+            ba::apply_permutation(vec, ind);
+            BOOST_CHECK(vec == gathered);
+            BOOST_CHECK(is_identity(ind));
+            vec = items;
+            ind = order;
+            ba::apply_reverse_permutation(vec.begin(), vec.end(), ind.begin(), ind.end());
+            BOOST_CHECK(vec == scattered);
+            BOOST_CHECK(is_identity(ind));
+        }
+        //Out of place and buffered
+        {
+            std::vector<std::string> vec(size);
+            BOOST_CHECK(ba::apply_permutation_copy(items.begin(), items.end(), order.begin(), vec.begin()) == vec.end());
+            BOOST_CHECK(vec == gathered);
+            ba::apply_reverse_permutation_copy(items.begin(), items.end(), order.begin(), vec.begin());
+            BOOST_CHECK(vec == scattered);
+            vec = items;
+            ba::apply_permutation_buffered(vec.begin(), vec.end(), order.begin(), order.end());
+            BOOST_CHECK(vec == gathered);
+            vec = items;
+            ba::apply_reverse_permutation_buffered(vec.begin(), vec.end(), order.begin(), order.end());
+            BOOST_CHECK(vec == scattered);
+        }
+        //Items that aren't addressable
+        {
+            std::vector<bool> bits, expected;
+            for (std::size_t i = 0; i < size; ++i)
+                bits.push_back(i % 3 == 0);
+            for (std::size_t i = 0; i < size; ++i)
+                expected.push_back(bits[order[i]]);
+            std::vector<bool> copied(size);
+            ba::apply_permutation_copy(bits.begin(), bits.end(), order.begin(), copied.begin());
+            BOOST_CHECK(copied == expected);
+            ba::apply_permutation(bits, order);
+            BOOST_CHECK(bits == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_apply_permutation)
+{
+    const std::size_t sizes[] = { 0, 1, 2, 1000, 1 << 16, 100003 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const std::size_t size = sizes[s];
+        std::vector<int> order = random_permutation(size);
+        //A few fixed points and short cycles too
+        for (std::size_t i = 0; i + 1 < size; i += 7)
+            std::swap(*std::find(order.begin(), order.end(), static_cast<int>(i)), order[i]);
+        for (std::size_t i = 3; i + 1 < size; i += 11)
+            std::swap(order[i], order[i + 1]);
+        const std::vector<int> saved = order;
+
+        std::vector<int> items(size);
+        std::vector<std::string> names(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            items[i] = static_cast<int>(i * 3);
+            names[i] = std::string(i % 20, 'y') + static_cast<char>('A' + i % 26);
+        }
+        std::vector<int> gathered(size), scattered(size);
+        std::vector<std::string> gathered_names(size), scattered_names(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            gathered[i] = items[order[i]];
+            scattered[order[i]] = items[i];
+            gathered_names[i] = names[order[i]];
+            scattered_names[order[i]] = names[i];
+        }
+
+        std::vector<int> vec = items;
+        ba::apply_permutation(ex::seq, vec, order);
+        BOOST_CHECK(vec == gathered);
+        vec = items;
+        ba::apply_permutation(ex::par, vec, order);
+        BOOST_CHECK(vec == gathered);
+        vec = items;
+        ba::apply_permutation(ex::par(3), vec.begin(), vec.end(), order.begin(), order.end());
+        BOOST_CHECK(vec == gathered);
+        vec = items;
+        ba::apply_reverse_permutation(ex::par(4), vec, order);
+        BOOST_CHECK(vec == scattered);
+        vec = items;
+        ba::apply_reverse_permutation(ex::seq, vec.begin(), vec.end(), order.begin(), order.end());
+        BOOST_CHECK(vec == scattered);
+        BOOST_CHECK(order == saved);
+
+        const ba::permutation_cycles cycles(order);
+        BOOST_CHECK_EQUAL(cycles.size(), size);
+        vec = items;
+        cycles.apply(vec.begin());
+        BOOST_CHECK(vec == gathered);
+        cycles.apply_reverse(vec.begin());
+        BOOST_CHECK(vec == items);
+        std::vector<std::string> str = names;
+        cycles.apply(ex::par(3), str.begin());
+        BOOST_CHECK(str == gathered_names);
+        str = names;
+        cycles.apply_reverse(ex::par, str.begin());
+        BOOST_CHECK(str == scattered_names);
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+        vec = items;
+        str = names;
+        std::vector<int> vec2 = items;
+        cycles.apply_columns(ex::par(5), vec.begin(), str.begin(), vec2.begin());
+        BOOST_CHECK(vec == gathered);
+        BOOST_CHECK(str == gathered_names);
+        BOOST_CHECK(vec2 == gathered);
+        cycles.apply_reverse_columns(ex::seq, vec.begin(), str.begin());
+        BOOST_CHECK(vec == items);
+        BOOST_CHECK(str == names);
+#endif
+
+        //Packed bits share words, so they mustn't be split between threads
+        std::vector<bool> bits(size), gathered_bits(size);
+        for (std::size_t i = 0; i < size; ++i)
+            bits[i] = i % 3 == 0;
+        for (std::size_t i = 0; i < size; ++i)
+            gathered_bits[i] = bits[order[i]];
+        std::vector<bool> b = bits;
+        ba::apply_permutation(ex::par(4), b.begin(), b.end(), order.begin(), order.end());
+        BOOST_CHECK(b == gathered_bits);
+        b = bits;
+        cycles.apply(ex::par(4), b.begin());
+        BOOST_CHECK(b == gathered_bits);
+    }
+}
@@ -0,0 +1,242 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the base64 and base32 codecs; the vectors are from RFC 4648
+*/
+
+#include <boost/config.hpp>
+#include <boost/algorithm/base64.hpp>
+#include <boost/algorithm/base32.hpp>
+#include <boost/exception/get_error_info.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <list>
+#include <cstring>
+
+namespace ba = boost::algorithm;
+
+struct test_vector { const char *plain; const char *encoded; };
+
+const test_vector base64_vectors [] = {
+    { "",       ""         },
+    { "f",      "Zg=="     },
+    { "fo",     "Zm8="     },
+    { "foo",    "Zm9v"     },
+    { "foob",   "Zm9vYg==" },
+    { "fooba",  "Zm9vYmE=" },
+    { "foobar", "Zm9vYmFy" },
+    { NULL, NULL }
+    };
+
+const test_vector base32_vectors [] = {
+    { "",       ""                 },
+    { "f",      "MY======"         },
+    { "fo",     "MZXQ===="         },
+    { "foo",    "MZXW6==="         },
+    { "foob",   "MZXW6YQ="         },
+    { "fooba",  "MZXW6YTB"         },
+    { "foobar", "MZXW6YTBOI======" },
+    { NULL, NULL }
+    };
+
+const test_vector base32hex_vectors [] = {
+    { "",       ""                 },
+    { "f",      "CO======"         },
+    { "fo",     "CPNG===="         },
+    { "foo",    "CPNMU==="         },
+    { "foob",   "CPNMUOG="         },
+    { "fooba",  "CPNMUOJ1"         },
+    { "foobar", "CPNMUOJ1E8======" },
+    { NULL, NULL }
+    };
+
+std::string strip_padding ( std::string s ) {
+    return s.substr ( 0, s.find ( '=' ));
+    }
+
+void test_base64_vectors () {
+    for ( const test_vector *p = base64_vectors; p->plain; ++p ) {
+        const std::string plain ( p->plain ), encoded ( p->encoded );
+        std::string one, two, three;
+        ba::base64_encode ( p->plain, std::back_inserter ( one ));
+        ba::base64_encode ( plain, std::back_inserter ( two ));
+        ba::base64_encode ( plain.begin (), plain.end (), std::back_inserter ( three ));
+        BOOST_CHECK ( one == encoded );
+        BOOST_CHECK ( two == encoded );
+        BOOST_CHECK ( three == encoded );
+        BOOST_CHECK ( ba::base64_encode ( plain ) == encoded );
+        BOOST_CHECK ( ba::base64_encode ( plain, ba::base64_no_padding ) == strip_padding ( encoded ));
+        BOOST_CHECK ( ba::base64_encoded_size ( plain.size ()) == encoded.size ());
+        BOOST_CHECK ( ba::base64_encoded_size ( plain.size (), ba::base64_no_padding ) == strip_padding ( encoded ).size ());
+
+        one.clear (); two.clear (); three.clear ();
+        ba::base64_decode ( p->encoded, std::back_inserter ( one ));
+        ba::base64_decode ( encoded, std::back_inserter ( two ));
+        ba::base64_decode ( encoded.begin (), encoded.end (), std::back_inserter ( three ));
+        BOOST_CHECK ( one == plain );
+        BOOST_CHECK ( two == plain );
+        BOOST_CHECK ( three == plain );
+        BOOST_CHECK ( ba::base64_decode ( encoded ) == plain );
+        BOOST_CHECK ( ba::base64_decode ( strip_padding ( encoded ), ba::base64_no_padding ) == plain );
+        BOOST_CHECK ( ba::base64_decoded_size ( encoded.size ()) >= plain.size ());
+        }
+    }
+
+void test_base32_vectors ( const test_vector *vectors, ba::base32_flags flags ) {
+    for ( const test_vector *p = vectors; p->plain; ++p ) {
+        const std::string plain ( p->plain ), encoded ( p->encoded );
+        std::string one, two;
+        ba::base32_encode ( p->plain, std::back_inserter ( one ), flags );
+        ba::base32_encode ( plain.begin (), plain.end (), std::back_inserter ( two ), flags );
+        BOOST_CHECK ( one == encoded );
+        BOOST_CHECK ( two == encoded );
+        BOOST_CHECK ( ba::base32_encode ( plain, flags ) == encoded );
+        BOOST_CHECK ( ba::base32_encode ( plain, flags | ba::base32_no_padding ) == strip_padding ( encoded ));
+        BOOST_CHECK ( ba::base32_encoded_size ( plain.size (), flags ) == encoded.size ());
+
+        BOOST_CHECK ( ba::base32_decode ( encoded, flags ) == plain );
+        BOOST_CHECK ( ba::base32_decode ( strip_padding ( encoded ), flags | ba::base32_no_padding ) == plain );
+        one.clear ();
+        ba::base32_decode ( p->encoded, std::back_inserter ( one ), flags );
+        BOOST_CHECK ( one == plain );
+        }
+    }
+
+void test_url_alphabet () {
+    const std::string data ( "\xfb\xff\xbf" );
+    BOOST_CHECK ( ba::base64_encode ( data ) == "+/+/" );
+    BOOST_CHECK ( ba::base64_encode ( data, ba::base64_url ) == "-_-_" );
+    BOOST_CHECK ( ba::base64_decode ( std::string ( "-_-_" ), ba::base64_url ) == data );
+    BOOST_CHECK ( ba::base64_encode ( std::string ( "\xfb" ), ba::base64_url | ba::base64_no_padding ) == "-w" );
+    }
+
+void test_other_containers () {
+    const char *text = "Many hands make light work.";
+    std::vector<unsigned char> bytes ( text, text + std::strlen ( text ));
+    std::list<char> encoded;
+    ba::base64_encode ( bytes, std::back_inserter ( encoded ));
+    BOOST_CHECK ( std::string ( encoded.begin (), encoded.end ()) == "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu" );
+
+    std::vector<unsigned char> decoded;
+    ba::base64_decode ( encoded, std::back_inserter ( decoded ));
+    BOOST_CHECK ( decoded == bytes );
+
+    std::wstring wencoded;
+    ba::base32_encode ( bytes, std::back_inserter ( wencoded ));
+    std::vector<unsigned char> wdecoded;
+    ba::base32_decode ( wencoded, std::back_inserter ( wdecoded ));
+    BOOST_CHECK ( wdecoded == bytes );
+    }
+
+void test_buffers () {
+    std::string data;
+    for ( int i = 0; i < 300; ++i )
+        data.push_back ( static_cast<char> ( i * 37 ));
+
+    for ( std::size_t len = 0; len < data.size (); len += 7 ) {
+        const std::string plain = data.substr ( 0, len );
+        const ba::base64_flags flags [] = { ba::base64_standard, ba::base64_url, ba::base64_url | ba::base64_no_padding };
+        for ( std::size_t f = 0; f < 3; ++f ) {
+            std::string buf ( ba::base64_encoded_size ( len, flags [ f ] ), '?' );
+            char *end = ba::base64_encode_to_buffer ( plain.data (), len, &buf[0], flags [ f ] );
+            BOOST_CHECK ( end == &buf[0] + buf.size ());
+            BOOST_CHECK ( buf == ba::base64_encode ( plain, flags [ f ] ));
+
+            std::vector<char> back ( ba::base64_decoded_size ( buf.size ()) + 1 );
+            char *bend = ba::base64_decode_to_buffer ( buf.data (), buf.size (), &back[0], flags [ f ] );
+            BOOST_CHECK ( std::string ( &back[0], bend ) == plain );
+            }
+
+        std::string buf32 ( ba::base32_encoded_size ( len ), '?' );
+        ba::base32_encode_to_buffer ( plain.data (), len, &buf32[0] );
+        BOOST_CHECK ( buf32 == ba::base32_encode ( plain ));
+        std::vector<char> back32 ( ba::base32_decoded_size ( buf32.size ()) + 1 );
+        char *end32 = ba::base32_decode_to_buffer ( buf32.data (), buf32.size (), &back32[0] );
+        BOOST_CHECK ( std::string ( &back32[0], end32 ) == plain );
+        }
+    }
+
+template <typename Exception, typename Decode>
+bool throws ( Decode decode, const std::string &input, char bad = 0 ) {
+    std::string out;
+    try { decode ( input, out ); }
+    catch ( const Exception &ex ) {
+        if ( bad != 0 )
+            BOOST_CHECK ( bad == *boost::get_error_info<ba::bad_char> ( ex ));
+        return true;
+        }
+    catch ( ... ) { return false; }
+    return false;
+    }
+
+void decode64 ( const std::string &in, std::string &out ) { out = ba::base64_decode ( in ); }
+void decode64_unpadded ( const std::string &in, std::string &out ) { out = ba::base64_decode ( in, ba::base64_no_padding ); }
+void decode64_buffer ( const std::string &in, std::string &out ) {
+    out.resize ( ba::base64_decoded_size ( in.size ()));
+    ba::base64_decode_to_buffer ( in.data (), in.size (), &out[0] );
+    }
+void decode32 ( const std::string &in, std::string &out ) { out = ba::base32_decode ( in ); }
+
+void test_errors () {
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode64, "Zm9" ));
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode64, "Zg=" ));
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode64, "Z" ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64, "Zm9v!mFy", '!' ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64, "Z===", '=' ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64, "Zg==Zg==", 'Z' ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64, "Zg=A", 'A' ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64, "Zm9v-_", '-' ));
+    BOOST_CHECK ( throws<ba::hex_decode_error> ( decode64, "Zm9v-_" ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64_unpadded, "Zg==", '=' ));
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode64_unpadded, "Zm9vY" ));
+    BOOST_CHECK ( throws<ba::non_base64_input> ( decode64_buffer, "Zm9vYmFyZm9v$mFy", '$' ));
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode64_buffer, "Zm9vYmFyZm9vYmF" ));
+
+    BOOST_CHECK ( throws<ba::not_enough_input> ( decode32, "MZXW6" ));
+    BOOST_CHECK ( throws<ba::non_base32_input> ( decode32, "MZXW1===", '1' ));
+    BOOST_CHECK ( throws<ba::non_base32_input> ( decode32, "MZX=====", '=' ));
+    }
+
+//  Wider values are encoded if they fit in 8 bits, and rejected otherwise
+void test_wide_input () {
+    std::vector<int> ints;
+    ints.push_back ( 'f' );
+    ints.push_back ( 'o' );
+    ints.push_back ( 0xFF );
+    std::string out;
+    ba::base64_encode ( ints, std::back_inserter ( out ));
+    BOOST_CHECK ( out == ba::base64_encode ( std::string ( "fo\xFF" )));
+
+    std::vector<int> wide ( ints );
+    wide.push_back ( 0x100 );
+    out.clear ();
+    BOOST_CHECK_THROW ( ba::base64_encode ( wide, std::back_inserter ( out )), ba::non_base64_input );
+    wide.back () = -1;
+    BOOST_CHECK_THROW ( ba::base32_encode ( wide.begin (), wide.end (), std::back_inserter ( out )), ba::non_base32_input );
+
+    std::vector<int> group ( 6, 'x' );
+    group [ 4 ] = 300;
+    std::string buf ( ba::base64_encoded_size ( group.size ()), '?' );
+    BOOST_CHECK_THROW ( ba::base64_encode_to_buffer ( &group[0], group.size (), &buf[0] ), ba::non_base64_input );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_base64_vectors ();
+    test_base32_vectors ( base32_vectors, ba::base32_standard );
+    test_base32_vectors ( base32hex_vectors, ba::base32_hex );
+    test_url_alphabet ();
+    test_other_containers ();
+    test_wide_input ();
+    test_buffers ();
+    test_errors ();
+}
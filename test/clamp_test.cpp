@@ -3,10 +3,15 @@
 //  Boost Software License, Version 1.0. (See accompanying file
 //  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <vector>
 
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/algorithm/clamp.hpp>
 
 #define BOOST_TEST_MAIN
@@ -210,6 +215,89 @@ void test_int_range ()
     BOOST_CHECK ( std::equal ( b_e(junk), outputs ));
 }
 
+//  The arrays of arithmetic values, which take the vectorized path, against
+//  clamping the values one at a time; long enough for several blocks and a tail.
+template <typename T>
+void test_contiguous ( T lo, T hi )
+{
+    std::vector<T> in ( 1000 );
+    for ( std::size_t i = 0; i < in.size (); ++i )
+        in [ i ] = static_cast<T> ( static_cast<int> ( i * 37 % 251 ) - 125 );
+    std::vector<T> expected ( in.size ());
+    for ( std::size_t i = 0; i < in.size (); ++i )
+        expected [ i ] = ba::clamp ( in [ i ], lo, hi );
+
+    for ( std::size_t n = 0; n < 200; n += 13 ) {
+        std::vector<T> out ( n + 1, T ( 42 ));
+        const T *first = in.empty () ? NULL : &in [ 0 ];
+        BOOST_CHECK ( ba::clamp_range ( first, first + n, &out [ 0 ], lo, hi ) == &out [ n ] );
+        BOOST_CHECK ( std::equal ( out.begin (), out.begin () + n, expected.begin ()));
+        BOOST_CHECK ( out [ n ] == T ( 42 ));
+
+        std::vector<T> v ( in.begin (), in.begin () + n );
+        ba::clamp_range_inplace ( v.empty () ? NULL : &v [ 0 ], v.empty () ? NULL : &v [ 0 ] + n, lo, hi );
+        BOOST_CHECK ( std::equal ( v.begin (), v.end (), expected.begin ()));
+
+    //  The iterators of std::vector take the same path
+        const std::vector<T> &cin = in;
+        std::fill ( out.begin (), out.end (), T ( 42 ));
+        BOOST_CHECK ( ba::clamp_range ( cin.begin (), cin.begin () + n, out.begin (), lo, hi ) == out.begin () + n );
+        BOOST_CHECK ( std::equal ( out.begin (), out.begin () + n, expected.begin ()));
+        BOOST_CHECK ( out [ n ] == T ( 42 ));
+
+        v.assign ( in.begin (), in.begin () + n );
+        ba::clamp_range_inplace ( v.begin (), v.end (), lo, hi );
+        BOOST_CHECK ( std::equal ( v.begin (), v.end (), expected.begin ()));
+        }
+
+    std::vector<T> v ( in );
+    ba::clamp_range_inplace ( v, lo, hi );
+    BOOST_CHECK ( v == expected );
+
+//  The output overlapping the input
+    v = in;
+    ba::clamp_range ( &v [ 1 ], &v [ 0 ] + v.size (), &v [ 0 ], lo, hi );
+    BOOST_CHECK ( std::equal ( v.begin (), v.end () - 1, expected.begin () + 1 ));
+}
+
+void test_inplace ()
+{
+    BOOST_STATIC_ASSERT (( ba::detail::is_clamp_contiguous<std::vector<int>::const_iterator, std::vector<int>::iterator, int>::value ));
+    BOOST_STATIC_ASSERT (( ba::detail::is_clamp_contiguous<const double *, std::vector<double>::iterator, double>::value ));
+    BOOST_STATIC_ASSERT (( !ba::detail::is_clamp_contiguous<std::vector<int>::iterator, std::vector<long>::iterator, int>::value ));
+    BOOST_STATIC_ASSERT (( !ba::detail::is_clamp_contiguous<std::vector<int>::iterator, std::back_insert_iterator<std::vector<int> >, int>::value ));
+
+    test_contiguous<int> ( -10, 50 );
+    test_contiguous<short> ( -100, 7 );
+    test_contiguous<signed char> ( 0, 100 );
+    test_contiguous<unsigned> ( 5, 100 );
+    test_contiguous<float> ( -2.5f, 99.5f );
+    test_contiguous<double> ( -2.5, 99.5 );
+
+//  NaNs are left alone, as by clamp
+    float f [] = { -5.f, std::numeric_limits<float>::quiet_NaN (), 5.f, 0.5f };
+    ba::clamp_range_inplace ( f, f + 4, 0.f, 1.f );
+    BOOST_CHECK ( f [ 0 ] == 0.f && f [ 1 ] != f [ 1 ] && f [ 2 ] == 1.f && f [ 3 ] == 0.5f );
+
+//  Iterators, predicates and types that don't take the vectorized path
+    std::vector<int> v;
+    for ( int i = -20; i < 20; ++i )
+        v.push_back ( i );
+    std::vector<int> expected;
+    ba::clamp_range ( v.begin (), v.end (), std::back_inserter ( expected ), -3, 8 );
+    ba::clamp_range_inplace ( v.begin (), v.end (), -3, 8 );
+    BOOST_CHECK ( v == expected );
+    ba::clamp_range ( v.begin (), v.end (), expected.begin (), 5, 0, intGreater );
+    ba::clamp_range_inplace ( v, 5, 0, intGreater );
+    BOOST_CHECK ( v == expected );
+
+    std::vector<custom> c;
+    for ( int i = 0; i < 10; ++i )
+        c.push_back ( custom ( i ));
+    ba::clamp_range_inplace ( c.begin (), c.end (), custom ( 2 ), custom ( 6 ), customLess );
+    BOOST_CHECK ( c.front () == custom ( 2 ) && c [ 4 ] == custom ( 4 ) && c.back () == custom ( 6 ));
+}
+
 void test_constexpr()
 {
 
@@ -321,6 +409,7 @@ BOOST_AUTO_TEST_CASE( test_main )
     test_custom ();
     
     test_int_range ();
+    test_inplace ();
 
     test_constexpr ();
 //    test_float_range ();
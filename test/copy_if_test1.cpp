@@ -36,6 +36,7 @@ BOOST_CXX14_CONSTEXPR bool is_zero  ( int v ) { return v == 0; }
 
 BOOST_CXX14_CONSTEXPR bool less_than_ten ( int v ) { return v < 10; }
 BOOST_CXX14_CONSTEXPR bool greater_than_ten ( int v ) { return v > 10; }
+bool is_thousand_even ( int v ) { return ( v / 1000 ) % 2 == 0; }
 
 template <typename Container>
 void test_copy_if ( Container const &c ) {
@@ -451,6 +452,144 @@ BOOST_CXX14_CONSTEXPR inline bool constexpr_test_copy_if_until() {
     return res;
     }
 
+//  Arrays of numbers are copied through a buffer, a block at a time. Check
+//  every length up to a few blocks, with the elements picked at random and in
+//  runs, against the element by element loops; the output is exactly as long
+//  as it needs to be.
+template <typename T>
+struct picked {
+    picked ( const std::vector<unsigned char> &pick, const T *base, int &calls )
+        : pick_ ( &pick ), base_ ( base ), calls_ ( &calls ) {}
+    bool operator () ( const T &v ) const { ++*calls_; return (*pick_) [ &v - base_ ] != 0; }
+private:
+    const std::vector<unsigned char> *pick_;
+    const T *base_;
+    int *calls_;
+    };
+
+template <typename T>
+void test_blocks ( unsigned percent ) {
+    unsigned seed = 12345;
+    for ( std::size_t n = 0; n < 1100; n += 1 + n / 8 ) {
+        std::vector<T> c ( n );
+        std::vector<unsigned char> pick ( n );
+        for ( std::size_t i = 0; i < n; ++i ) {
+            seed = seed * 1103515245u + 12345u;
+            c [ i ] = static_cast<T> ( seed >> 16 );
+            pick [ i ] = ( seed >> 8 ) % 100 < percent;
+            }
+        const T *first = c.empty () ? NULL : &c [ 0 ];
+        int calls = 0;
+        picked<T> p ( pick, first, calls );
+
+        std::vector<T> expected;
+        for ( std::size_t i = 0; i < n; ++i )
+            if ( pick [ i ] )
+                expected.push_back ( c [ i ] );
+        std::vector<T> out ( expected.size ());
+        BOOST_CHECK ( ba::copy_if ( c.begin (), c.end (), out.begin (), p ) == out.end ());
+        BOOST_CHECK ( out == expected );
+        BOOST_CHECK_EQUAL ( calls, static_cast<int> ( n ));
+
+    //  In place, as remove_if would
+        std::vector<T> in_place ( c );
+        in_place.erase ( ba::copy_if ( in_place.begin (), in_place.end (), in_place.begin (),
+                                       picked<T> ( pick, in_place.empty () ? NULL : &in_place [ 0 ], calls )), in_place.end ());
+        BOOST_CHECK ( in_place == expected );
+
+        std::size_t prefix = 0;
+        while ( prefix < n && pick [ prefix ] )
+            ++prefix;
+        std::vector<T> out_prefix ( prefix );
+        calls = 0;
+        std::pair<const T *, typename std::vector<T>::iterator> res =
+            ba::copy_while ( first, first + n, out_prefix.begin (), p );
+        BOOST_CHECK ( res.first == first + prefix );
+        BOOST_CHECK ( res.second == out_prefix.end ());
+        BOOST_CHECK ( std::equal ( out_prefix.begin (), out_prefix.end (), c.begin ()));
+        BOOST_CHECK_EQUAL ( calls, static_cast<int> ( prefix < n ? prefix + 1 : n ));
+
+        prefix = 0;
+        while ( prefix < n && !pick [ prefix ] )
+            ++prefix;
+        std::vector<T> out_until;
+        std::pair<typename std::vector<T>::const_iterator, std::back_insert_iterator<std::vector<T> > > res2 =
+            ba::copy_until ( c, std::back_inserter ( out_until ), p );
+        BOOST_CHECK ( res2.first == c.begin () + prefix );
+        BOOST_CHECK ( out_until.size () == prefix );
+        BOOST_CHECK ( std::equal ( out_until.begin (), out_until.end (), c.begin ()));
+        }
+    }
+
+void test_numbers () {
+    const unsigned percents [] = { 0, 1, 10, 50, 90, 99, 100 };
+    for ( std::size_t i = 0; i < sizeof ( percents ) / sizeof ( percents [ 0 ] ); ++i ) {
+        test_blocks<unsigned char> ( percents [ i ] );
+        test_blocks<int> ( percents [ i ] );
+        test_blocks<double> ( percents [ i ] );
+        }
+
+//  Runs of a thousand elements, picked and not
+    std::vector<int> c ( 5000 );
+    for ( std::size_t i = 0; i < c.size (); ++i )
+        c [ i ] = static_cast<int> ( i );
+    std::vector<int> v;
+    ba::copy_if ( c, std::back_inserter ( v ), is_thousand_even );
+    BOOST_CHECK ( v.size () == 3000 );
+    BOOST_CHECK ( ba::all_of ( v.begin (), v.end (), is_thousand_even ));
+    BOOST_CHECK ( v [ 1000 ] == 2000 && v [ 2999 ] == 4999 );
+    }
+
+//  A predicate that throws part way through a block; the elements picked
+//  before it are still written
+struct odd_until {
+    explicit odd_until ( int stop ) : stop_ ( stop ) {}
+    bool operator () ( int v ) const {
+        if ( v == stop_ )
+            throw v;
+        return v % 2 != 0;
+        }
+private:
+    int stop_;
+    };
+
+void test_throwing () {
+    std::vector<int> c ( 1000 );
+    for ( std::size_t i = 0; i < c.size (); ++i )
+        c [ i ] = static_cast<int> ( i );
+    const int stops [] = { 0, 1, 100, 255, 256, 600, 999 };
+    for ( std::size_t i = 0; i < sizeof ( stops ) / sizeof ( stops [ 0 ] ); ++i ) {
+        std::vector<int> v;
+        try {
+            ba::copy_if ( c, std::back_inserter ( v ), odd_until ( stops [ i ] ));
+            BOOST_CHECK ( false );
+            }
+        catch ( int stop ) {
+            BOOST_CHECK_EQUAL ( stop, stops [ i ] );
+            }
+        BOOST_CHECK_EQUAL ( v.size (), static_cast<std::size_t> ( stops [ i ] / 2 ));
+        BOOST_CHECK ( ba::all_of ( v.begin (), v.end (), is_odd ));
+        }
+    }
+
+//  A predicate may take the elements by non-const reference, and change them
+bool odd_and_zeroed ( int &v ) {
+    const bool odd = v % 2 != 0;
+    v = 0;
+    return odd;
+    }
+
+void test_non_const_predicate () {
+    std::vector<int> v;
+    for ( int i = 0; i < 1000; ++i )
+        v.push_back ( i );
+    std::vector<int> out;
+    ba::copy_if ( v.begin (), v.end (), std::back_inserter ( out ), odd_and_zeroed );
+    BOOST_CHECK_EQUAL ( out.size (), 500u );
+    BOOST_CHECK ( ba::all_of ( out.begin (), out.end (), is_zero ));
+    BOOST_CHECK ( ba::all_of ( v.begin (), v.end (), is_zero ));
+    }
+
 void test_sequence1 () {
     std::vector<int> v;
     for ( int i = 5; i < 15; ++i )
@@ -484,4 +623,7 @@ void test_sequence1 () {
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_sequence1 ();
+  test_numbers ();
+  test_throwing ();
+  test_non_const_predicate ();
 }
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+*/
+
+#include <boost/config.hpp>
+#include <boost/algorithm/count_up_to.hpp>
+#include <boost/algorithm/detail/find_value.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+template<typename T>
+struct is_ {
+    BOOST_CXX14_CONSTEXPR is_ ( T v ) : val_ ( v ) {}
+    BOOST_CXX14_CONSTEXPR bool operator () ( T comp ) const { return val_ == comp; }
+private:
+    is_ (); // need a value
+
+    T val_;
+    };
+
+//  Counts how often it is called, to check that counting stops at the limit
+struct counting_is_one {
+    counting_is_one ( int &calls ) : calls_ ( &calls ) {}
+    bool operator () ( int v ) const { ++*calls_; return v == 1; }
+private:
+    int *calls_;
+    };
+
+namespace ba = boost::algorithm;
+
+void test_sequences ()
+{
+    BOOST_CXX14_CONSTEXPR int some_numbers[] = { 1, 1, 2, 3, 5, 1 };
+    std::vector<int> vi(some_numbers, some_numbers + 6);
+    std::list<int>   li(vi.begin(), vi.end ());
+
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, 0 ), 0 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, -1 ), 0 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, 1 ), 1 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, 2 ), 2 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, 3 ), 3 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 1, 100 ), 3 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi, 4, 100 ), 0 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi.begin (), vi.begin (), 1, 100 ), 0 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( vi.begin () + 1, vi.end (), 1, 100 ), 2 );
+
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( li, 1, 2 ), 2 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( li.begin (), li.end (), 1, 100 ), 3 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( li, 7, 100 ), 0 );
+
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( vi, is_<int> ( 1 ), 0 ), 0 );
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( vi, is_<int> ( 1 ), 2 ), 2 );
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( vi, is_<int> ( 1 ), 100 ), 3 );
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( li.begin (), li.end (), is_<int> ( 5 ), 100 ), 1 );
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( li, is_<int> ( 4 ), 100 ), 0 );
+
+//  Nothing past the second match is looked at
+    int calls = 0;
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( li, counting_is_one ( calls ), 2 ), 2 );
+    BOOST_CHECK_EQUAL ( calls, 2 );
+    calls = 0;
+    BOOST_CHECK_EQUAL ( ba::count_if_up_to ( li, counting_is_one ( calls ), 3 ), 3 );
+    BOOST_CHECK_EQUAL ( calls, 6 );
+
+    std::string s ( "mississippi" );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( s, 's', 3 ), 3 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( s, 's', 5 ), 4 );
+    BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( s.begin (), s.end (), 'p', 5 ), 2 );
+
+    BOOST_CXX14_CONSTEXPR bool constexpr_res =
+        ba::count_equal_up_to ( some_numbers, some_numbers + 6, 1, 2 ) == 2 &&
+        ba::count_equal_up_to ( some_numbers, some_numbers + 6, 1, 9 ) == 3 &&
+        ba::count_if_up_to ( some_numbers, some_numbers + 6, is_<int> ( 2 ), 9 ) == 1 &&
+        true;
+
+    BOOST_CHECK ( constexpr_res );
+}
+
+//  Arrays of numbers are searched and counted thirty two bytes at a time.
+//  The word at a time kernels behind count_equal_up_to and the all_of_equal
+//  family are tested here, directly: every length up to a few blocks, with
+//  the value every 'step' elements, and every limit up to one past the
+//  number of matches
+template<typename T, typename Key>
+void test_blocks ( T fill, T value, Key key )
+{
+    for ( std::size_t n = 0; n < 150; ++n ) {
+        for ( std::size_t step = 1; step < 12; step += 3 ) {
+            std::vector<T> v ( n, fill );
+            for ( std::size_t i = step / 2; i < n; i += step )
+                v [ i ] = value;
+            std::size_t matches = 0;
+            std::size_t first_equal = n;
+            std::size_t first_unequal = n;
+            for ( std::size_t k = 0; k < n; ++k )
+                if ( v [ k ] == key ) {
+                    ++matches;
+                    if ( first_equal == n ) first_equal = k;
+                    }
+                else if ( first_unequal == n )
+                    first_unequal = k;
+
+            const T *first = v.empty () ? 0 : &v [ 0 ];
+            if ( n != 0 ) {
+                BOOST_CHECK ( ba::detail::find_value_in<true> ( first, first + n, key ) == first + first_equal );
+                BOOST_CHECK ( ba::detail::find_value_in<false> ( first, first + n, key ) == first + first_unequal );
+                BOOST_CHECK ( ba::detail::find_value_in<true> ( v.begin (), v.end (), key ) == v.begin () + first_equal );
+                BOOST_CHECK ( ba::detail::find_value_in<false> ( v.begin (), v.end (), key ) == v.begin () + first_unequal );
+                }
+            for ( std::size_t limit = 0; limit <= matches + 1; ++limit ) {
+                const std::size_t expected = matches < limit ? matches : limit;
+                if ( n != 0 ) {
+                    BOOST_CHECK_EQUAL ( ba::detail::count_value_in ( first, first + n, key, limit ), expected );
+                    BOOST_CHECK_EQUAL ( ba::detail::count_value_in ( v.begin (), v.end (), key, limit ), expected );
+                    }
+                BOOST_CHECK_EQUAL ( ba::count_equal_up_to ( v, key, limit ), static_cast<std::ptrdiff_t> ( expected ));
+                }
+            }
+        }
+}
+
+void test_numbers ()
+{
+    test_blocks<char> ( ' ', 'x', 'x' );
+    test_blocks<char> ( ' ', 'x', ' ' );
+    test_blocks<unsigned char> ( 0xFF, 0x7F, 0x7F );
+    test_blocks<short> ( 0, -1, -1 );
+    test_blocks<unsigned short> ( 0x8000, 0x0080, 0x8000u );
+    test_blocks<int> ( 0, -1, -1 );
+    test_blocks<int> ( 0, -1, 0 );
+    test_blocks<unsigned> ( 0x80000000u, 7, 7u );
+    test_blocks<long long> ( -1, 1LL << 40, 1LL << 40 );
+    test_blocks<unsigned long long> ( 0, 1, 0ULL );
+    test_blocks<unsigned long long> ( 0, 1, 1ULL );
+
+//  Values that no element can be equal to
+    test_blocks<unsigned char> ( 0xFF, 0, 0x1FF );
+    test_blocks<char> ( 'a', 'b', 1000 );
+
+//  0.0 == -0.0, NaN is equal to nothing, and 0.1 is not exactly a float
+    test_blocks<float> ( 1.5f, 2.5f, 2.5f );
+    test_blocks<float> ( 1.5f, -0.0f, 0 );
+    test_blocks<float> ( -0.0f, 1.0f, 0 );
+    test_blocks<float> ( 0.1f, 0.5f, 0.1 );
+    test_blocks<double> ( 0.0, -0.0, 0.0 );
+    test_blocks<double> ( 1.0, std::numeric_limits<double>::quiet_NaN (), std::numeric_limits<double>::quiet_NaN ());
+    test_blocks<double> ( std::numeric_limits<double>::quiet_NaN (), 1.0, 1.0 );
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_sequences ();
+  test_numbers ();
+}
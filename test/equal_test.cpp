@@ -7,6 +7,11 @@
     For more information, see http://www.boost.org
 */
 
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <boost/config.hpp>
 #include <boost/algorithm/cxx14/equal.hpp>
 
@@ -123,6 +128,52 @@ void test_equal ()
 }
 
 
+enum colour { red, green, blue };
+
+//  Arrays of integers, enums and pointers are compared with memcmp; check
+//  every length up to 100, with a difference at every position
+template <typename T>
+void test_bytewise ( T a, T b ) {
+    for ( std::size_t n = 0; n < 100; ++n ) {
+        std::vector<T> v1 ( n, a );
+        const std::vector<T> v2 ( v1 );
+        BOOST_CHECK ( ba::equal ( v1.begin (), v1.end (), v2.begin (), v2.end ()));
+        BOOST_CHECK ( ba::equal ( v1.data (), v1.data () + n, v2.data (), v2.data () + n, std::equal_to<T> ()));
+        for ( std::size_t i = 0; i < n; ++i ) {
+            v1 [ i ] = b;
+            BOOST_CHECK ( !ba::equal ( v1.begin (), v1.end (), v2.begin (), v2.end ()));
+            BOOST_CHECK ( !ba::equal ( v2.begin (), v2.end (), v1.begin (), v1.end (), std::equal_to<T> ()));
+            BOOST_CHECK ( ba::equal ( v1.begin (), v1.begin () + i, v2.begin (), v2.begin () + i ));
+            v1 [ i ] = a;
+            }
+        }
+    }
+
+void test_bytewise_equal ()
+{
+    test_bytewise<char> ( 'a', 'b' );
+    test_bytewise<unsigned short> ( 0x1234, 0x1235 );
+    test_bytewise<int> ( -1, 0x7FFFFFFF );
+    test_bytewise<long long> ( 1LL << 40, 1 );
+    test_bytewise<colour> ( green, blue );
+    int x [ 2 ];
+    test_bytewise<int *> ( x, x + 1 );
+
+//  Strings, and arrays of different types
+    const std::string s1 ( "the same string" ), s2 ( "the same strinG" );
+    BOOST_CHECK ( ba::equal ( s1.begin (), s1.end (), s1.begin (), s1.end ()));
+    BOOST_CHECK ( !ba::equal ( s1.begin (), s1.end (), s2.begin (), s2.end ()));
+    const int ints [] = { 1, 2, 3 };
+    const long longs [] = { 1, 2, 3 };
+    BOOST_CHECK ( ba::equal ( ints, ints + 3, longs, longs + 3 ));
+
+//  Floating point values are compared with ==, not by their bytes
+    const double zeros [] = { 0.0, -0.0 };
+    const double nans [] = { 0.0, std::numeric_limits<double>::quiet_NaN () };
+    BOOST_CHECK ( ba::equal ( zeros, zeros + 1, zeros + 1, zeros + 2 ));
+    BOOST_CHECK ( !ba::equal ( nans + 1, nans + 2, nans + 1, nans + 2 ));
+}
+
 BOOST_CXX14_CONSTEXPR bool test_constexpr_equal() {
     int num[] = { 1, 1, 2, 3, 5};
     const int sz = sizeof (num)/sizeof(num[0]);
@@ -151,6 +202,9 @@ BOOST_CXX14_CONSTEXPR bool test_constexpr_equal() {
 //  Different sequences are different
            && !ba::equal ( random_access_iterator<int *>(num + 1), random_access_iterator<int *>(num + sz),
                            random_access_iterator<int *>(num),     random_access_iterator<int *>(num + sz))
+//  Pointers, which are compared with memcmp at run time
+           && ba::equal ( num, num + sz, num, num + sz )
+           && !ba::equal ( num + 1, num + sz, num, num + sz - 1 )
           );
 #endif
     return res;
@@ -160,6 +214,7 @@ BOOST_CXX14_CONSTEXPR bool test_constexpr_equal() {
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_equal ();
+  test_bytewise_equal ();
   BOOST_CXX14_CONSTEXPR bool constexpr_res = test_constexpr_equal ();
   BOOST_CHECK (constexpr_res);
 }
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the Eytzinger layout index
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/eytzinger_index.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+
+struct less_than {
+    less_than ( int limit ) : limit_ ( limit ) {}
+    bool operator () ( int v ) const { return v < limit_; }
+private:
+    int limit_;
+    };
+
+//  Each search of v's index agrees with std::lower_bound and std::upper_bound
+template <typename T, typename Compare>
+void check_index ( const std::vector<T> &v, const std::vector<T> &queries, Compare comp ) {
+    const ba::eytzinger_index<T, Compare> index ( v.begin (), v.end (), comp );
+    BOOST_CHECK ( index.size () == v.size ());
+    BOOST_CHECK ( index.empty () == v.empty ());
+
+    std::vector<std::size_t> lower, upper;
+    for ( std::size_t i = 0; i < queries.size (); ++i ) {
+        lower.push_back ( std::lower_bound ( v.begin (), v.end (), queries [ i ], comp ) - v.begin ());
+        upper.push_back ( std::upper_bound ( v.begin (), v.end (), queries [ i ], comp ) - v.begin ());
+        BOOST_CHECK ( index.lower_bound ( queries [ i ] ) == lower.back ());
+        BOOST_CHECK ( index.upper_bound ( queries [ i ] ) == upper.back ());
+        }
+
+    std::vector<std::size_t> batch ( queries.size ());
+    BOOST_CHECK ( index.lower_bound ( queries.begin (), queries.end (), batch.begin ()) == batch.end ());
+    BOOST_CHECK ( batch == lower );
+    BOOST_CHECK ( index.upper_bound ( queries.begin (), queries.end (), batch.begin ()) == batch.end ());
+    BOOST_CHECK ( batch == upper );
+    }
+
+void test_sizes () {
+//  Every size up to 100, so every shape of the last level of the tree
+    for ( int n = 0; n <= 100; ++n ) {
+        std::vector<int> v, queries;
+        for ( int i = 0; i < n; ++i )
+            v.push_back ( 2 * i );
+        for ( int q = -2; q <= 2 * n + 1; ++q )
+            queries.push_back ( q );
+        check_index ( v, queries, std::less<int> ());
+
+        const ba::eytzinger_index<int> index ( v );
+        for ( int pp = 0; pp <= n; ++pp )
+            BOOST_CHECK ( index.partition_point ( less_than ( 2 * pp )) == static_cast<std::size_t> ( pp ));
+        }
+    }
+
+void test_duplicates () {
+    std::vector<int> v, queries;
+    unsigned seed = 2017;
+    for ( int i = 0; i < 100000; ++i ) {
+        seed = seed * 1103515245u + 12345u;
+        v.push_back ( static_cast<int> (( seed >> 8 ) % 5000 ));
+        }
+    std::sort ( v.begin (), v.end ());
+    for ( int q = -1; q <= 5001; ++q )
+        queries.push_back ( q );
+    check_index ( v, queries, std::less<int> ());
+
+//  A different order
+    std::reverse ( v.begin (), v.end ());
+    check_index ( v, queries, std::greater<int> ());
+    }
+
+void test_types () {
+    std::vector<std::string> words;
+    for ( char c = 'a'; c <= 'z'; ++c )
+        words.push_back ( std::string ( 3, c ));
+    std::vector<std::string> queries ( words );
+    queries.push_back ( "" );
+    queries.push_back ( "b" );
+    queries.push_back ( "zzzz" );
+    check_index ( words, queries, std::less<std::string> ());
+
+    std::vector<double> d;
+    for ( int i = 0; i < 1000; ++i )
+        d.push_back ( i * 0.5 );
+    std::vector<double> dq;
+    for ( int i = -3; i < 1100; ++i )
+        dq.push_back ( i * 0.25 );
+    check_index ( d, dq, std::less<double> ());
+
+//  Built from a list, searched for values of another type
+    std::list<long> l;
+    for ( long i = 0; i < 1000; ++i )
+        l.push_back ( i * 10 );
+    const ba::eytzinger_index<long> index ( l.begin (), l.end ());
+    BOOST_CHECK ( index.lower_bound ( 55 ) == 6 );
+    BOOST_CHECK ( index.upper_bound ( 50 ) == 6 );
+    const int ints [] = { 1, 10, 9990, 10000 };
+    std::size_t out [ 4 ];
+    index.lower_bound ( ints, ints + 4, out );
+    BOOST_CHECK ( out [ 0 ] == 1 && out [ 1 ] == 1 && out [ 2 ] == 999 && out [ 3 ] == 1000 );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_sizes ();
+    test_duplicates ();
+    test_types ();
+}
@@ -411,10 +411,67 @@ void test_find_not_backward()
     BOOST_CHECK(ce_result);
 }
 
+// Arrays of integers are searched a word at a time; check them against the
+// element at a time search for every length up to 80, with the value at
+// every position (and at two positions)
+template <typename T, typename Key>
+void test_word_at_a_time(T fill, T value, Key key)
+{
+    for (std::size_t n = 0; n < 80; ++n) {
+        std::vector<T> v(n, fill);
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (i < n)
+                v[i] = value;
+            for (std::size_t j = 0; j <= i; j += 7) {
+                if (j < n)
+                    v[j] = value;
+                const T* first = v.empty() ? 0 : &v[0];
+                const T* last = first + n;
+                const T* expected = last;
+                for (const T* it = last; it != first; )
+                    if (*--it == key) { expected = it; break; }
+                BOOST_CHECK(ba::find_backward(first, last, key) == expected);
+                BOOST_CHECK(ba::find_backward(v.begin(), v.end(), key) - v.begin() == expected - first);
+
+                const T* expected_not = last;
+                for (const T* it = last; it != first; )
+                    if (!(*--it == key)) { expected_not = it; break; }
+                BOOST_CHECK(ba::find_not_backward(first, last, key) == expected_not);
+                BOOST_CHECK(ba::find_not_backward(v, key) - v.begin() == expected_not - first);
+                if (j < n && j != i)
+                    v[j] = fill;
+            }
+            if (i < n)
+                v[i] = fill;
+        }
+    }
+}
+
+void test_find_word_at_a_time()
+{
+    test_word_at_a_time<char>(' ', '\n', '\n');
+    test_word_at_a_time<char>(' ', '\n', ' ');
+    test_word_at_a_time<unsigned char>(0, 0xFF, 0xFF);
+    test_word_at_a_time<signed char>(-1, 0, -1);
+    test_word_at_a_time<short>(-2, 0x7F00, 0x7F00);
+    test_word_at_a_time<unsigned short>(0x8000, 0x0080, 0x0080u);
+    test_word_at_a_time<int>(0, -1, -1);
+    test_word_at_a_time<int>(0, 1 << 24, 0L);
+    test_word_at_a_time<unsigned>(7, 0x80000000u, 0x80000000u);
+    test_word_at_a_time<long long>(0, -1, -1);
+    test_word_at_a_time<unsigned long long>(1, 1ULL << 63, 1ULL << 63);
+
+// A value that no element can be equal to
+    test_word_at_a_time<unsigned char>(0, 0xFF, 0x1FF);
+    test_word_at_a_time<char>('a', 'b', 1000);
+    test_word_at_a_time<short>(-1, 0, 0x10000 - 1);
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
     test_find_backward();
     test_find_if_backward();
     test_find_if_not_backward();
     test_find_not_backward();
+    test_find_word_at_a_time();
 }
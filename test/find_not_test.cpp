@@ -128,7 +128,56 @@ void test_sequence()
 }
 
 
+// Arrays of integers are searched a word at a time; check them against the
+// element at a time search for every length up to 80, with a different
+// value at every position (and at two positions)
+template <typename T, typename Key>
+void test_word_at_a_time(T fill, T value, Key key)
+{
+    for (std::size_t n = 0; n < 80; ++n) {
+        std::vector<T> v(n, fill);
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (i < n)
+                v[i] = value;
+            for (std::size_t j = i; j <= n; j += 7) {
+                if (j < n)
+                    v[j] = value;
+                const T* first = v.empty() ? 0 : &v[0];
+                const T* last = first + n;
+                const T* expected = first;
+                while (expected != last && *expected == key)
+                    ++expected;
+                BOOST_CHECK(ba::find_not(first, last, key) == expected);
+                BOOST_CHECK(ba::find_not(v.begin(), v.end(), key) - v.begin() == expected - first);
+                BOOST_CHECK(ba::find_not(v, key) - v.begin() == expected - first);
+                if (j < n && j != i)
+                    v[j] = fill;
+            }
+            if (i < n)
+                v[i] = fill;
+        }
+    }
+}
+
+void test_find_not_word_at_a_time()
+{
+    test_word_at_a_time<char>(' ', 'x', ' ');
+    test_word_at_a_time<unsigned char>(0xFF, 0x7F, 0xFF);
+    test_word_at_a_time<signed char>(-1, 0, -1);
+    test_word_at_a_time<short>(0, 1, 0);
+    test_word_at_a_time<unsigned short>(0x8000, 0x0080, 0x8000u);
+    test_word_at_a_time<int>(0, -1, 0);
+    test_word_at_a_time<unsigned>(0x80000000u, 7, 0x80000000u);
+    test_word_at_a_time<long long>(-1, 1LL << 40, -1);
+    test_word_at_a_time<unsigned long long>(0, 1, 0ULL);
+
+// A value that no element can be equal to
+    test_word_at_a_time<unsigned char>(0xFF, 0, 0x1FF);
+    test_word_at_a_time<char>('a', 'b', 1000);
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
     test_sequence();
+    test_find_not_word_at_a_time();
 }
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test gather with a caller's buffer, on small and large sequences, and gather_n
+*/
+
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/gather.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+
+//  Each item remembers where it started, so that stability can be checked
+struct item {
+    item ( int k, std::size_t p ) : key ( k ), pos ( p ), name ( std::string ( p % 30, 'z' )) {}
+    int key;
+    std::size_t pos;
+    std::string name;
+    };
+
+bool operator == ( const item &a, const item &b ) { return a.pos == b.pos && a.key == b.key && a.name == b.name; }
+
+struct key_is {
+    key_is ( int k ) : k_ ( k ) {}
+    bool operator () ( const item &i ) const { return i.key == k_; }
+    int k_;
+    };
+
+//  Returns something convertible to bool, rather than bool
+struct key_is_odd {
+    int operator () ( const item &i ) const { return i.key & 1; }
+    };
+
+struct odd_group {
+    int operator () ( const item &i ) const { return i.key & 1 ? 0 : -1; }
+    };
+
+struct key_group {
+    int operator () ( const item &i ) const { return i.key < 3 ? i.key : -1; }
+    };
+
+//  What gather should produce, built up the slow way
+template <typename Pred>
+std::vector<item> expected_gather ( const std::vector<item> &v, std::size_t pivot, Pred pred, std::size_t &first, std::size_t &second ) {
+    std::vector<item> res;
+    for ( std::size_t i = 0; i < pivot; ++i )
+        if ( !pred ( v [ i ] )) res.push_back ( v [ i ] );
+    first = res.size ();
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        if ( pred ( v [ i ] )) res.push_back ( v [ i ] );
+    second = res.size ();
+    for ( std::size_t i = pivot; i < v.size (); ++i )
+        if ( !pred ( v [ i ] )) res.push_back ( v [ i ] );
+    return res;
+    }
+
+template <typename Pred>
+void test_gather ( const std::vector<item> &v, std::size_t pivot, Pred pred ) {
+    std::size_t f, s;
+    const std::vector<item> expected = expected_gather ( v, pivot, pred, f, s );
+
+    std::vector<item> a ( v );
+    std::pair<std::vector<item>::iterator, std::vector<item>::iterator> res = ba::gather ( a.begin (), a.end (), a.begin () + pivot, pred );
+    BOOST_CHECK ( a == expected );
+    BOOST_CHECK ( res.first == a.begin () + f && res.second == a.begin () + s );
+
+    std::vector<item> buffer;
+    a = v;
+    res = ba::gather ( a.begin (), a.end (), a.begin () + pivot, pred, buffer );
+    BOOST_CHECK ( a == expected );
+    BOOST_CHECK ( res.first == a.begin () + f && res.second == a.begin () + s );
+    BOOST_CHECK ( buffer.empty ());
+
+    std::list<item> l ( v.begin (), v.end ());
+    std::list<item>::iterator lp = l.begin ();
+    std::advance ( lp, pivot );
+    ba::gather ( l.begin (), l.end (), lp, pred, buffer );
+    BOOST_CHECK ( std::vector<item> ( l.begin (), l.end ()) == expected );
+    }
+
+void test_gather_n ( const std::vector<item> &v, std::size_t pivot ) {
+    const key_group group;
+    std::vector<item> expected;
+    for ( std::size_t i = 0; i < pivot; ++i )
+        if ( group ( v [ i ] ) < 0 ) expected.push_back ( v [ i ] );
+    std::size_t bounds [ 4 ] = { expected.size () };
+    for ( int g = 0; g < 3; ++g ) {
+        for ( std::size_t i = 0; i < v.size (); ++i )
+            if ( group ( v [ i ] ) == g ) expected.push_back ( v [ i ] );
+        bounds [ g + 1 ] = expected.size ();
+        }
+    for ( std::size_t i = pivot; i < v.size (); ++i )
+        if ( group ( v [ i ] ) < 0 ) expected.push_back ( v [ i ] );
+
+    std::vector<item> a ( v );
+    std::vector<std::vector<item>::iterator> res;
+    ba::gather_n ( a.begin (), a.end (), a.begin () + pivot, 3, group, std::back_inserter ( res ));
+    BOOST_CHECK ( a == expected );
+    BOOST_REQUIRE ( res.size () == 4 );
+    for ( std::size_t g = 0; g < 4; ++g )
+        BOOST_CHECK ( res [ g ] == a.begin () + bounds [ g ] );
+
+//  With one group, gather_n is gather
+    std::size_t f, s;
+    a = v;
+    res.clear ();
+    ba::gather_n ( a.begin (), a.end (), a.begin () + pivot, 1, odd_group (), std::back_inserter ( res ));
+    expected = expected_gather ( v, pivot, key_is_odd (), f, s );
+    BOOST_CHECK ( a == expected );
+    BOOST_REQUIRE ( res.size () == 2 );
+    BOOST_CHECK ( res [ 0 ] == a.begin () + f && res [ 1 ] == a.begin () + s );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    const std::size_t sizes [] = { 0, 1, 2, 10, 30, 31, 100, 5000 };
+    for ( std::size_t i = 0; i < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++i ) {
+        std::vector<item> v;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j )
+            v.push_back ( item ( std::rand () % 5, j ));
+        const std::size_t pivots [] = { 0, v.size () / 3, v.size () };
+        for ( std::size_t p = 0; p < 3; ++p ) {
+            test_gather ( v, pivots [ p ], key_is ( 2 ));
+            test_gather ( v, pivots [ p ], key_is ( 7 ));
+            test_gather ( v, pivots [ p ], key_is_odd ());
+#ifndef BOOST_NO_CXX11_LAMBDAS
+            test_gather ( v, pivots [ p ], [] ( const item &x ) { return x.key != 0; } );
+#endif
+            test_gather_n ( v, pivots [ p ] );
+            }
+        }
+}
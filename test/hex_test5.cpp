@@ -0,0 +1,158 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the non-throwing and buffer versions of hex/unhex
+*/
+
+#include <boost/config.hpp>
+#include <boost/algorithm/hex.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace ba = boost::algorithm;
+
+void test_nothrow_success () {
+    std::string s;
+    ba::unhex_result<std::back_insert_iterator<std::string> > res =
+        ba::unhex ( "2122234556FF", std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( res.ok ());
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::ok );
+    BOOST_CHECK ( res.position == 12 );
+    BOOST_CHECK ( s == ba::unhex ( std::string ( "2122234556FF" )));
+
+    const std::string in ( "616263646566" );
+    s.clear ();
+    BOOST_CHECK ( ba::unhex ( in, std::back_inserter(s), std::nothrow ).ok ());
+    BOOST_CHECK ( s == "abcdef" );
+
+    s.clear ();
+    BOOST_CHECK ( ba::unhex ( in.begin (), in.end (), std::back_inserter(s), std::nothrow ).ok ());
+    BOOST_CHECK ( s == "abcdef" );
+
+    s.clear ();
+    BOOST_CHECK ( ba::unhex ( "", std::back_inserter(s), std::nothrow ).ok ());
+    BOOST_CHECK ( s.empty ());
+    }
+
+void test_nothrow_errors () {
+    std::string s;
+
+//  Short input - the output contains the values decoded before the error
+    ba::unhex_result<std::back_insert_iterator<std::string> > res =
+        ba::unhex ( std::string ( "61626" ), std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( !res.ok ());
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::not_enough_input );
+    BOOST_CHECK ( res.position == 5 );
+    BOOST_CHECK ( s == "ab" );
+
+    s.clear ();
+    res = ba::unhex ( "A", std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::not_enough_input );
+    BOOST_CHECK ( res.position == 1 );
+
+//  Non-hex input
+    s.clear ();
+    res = ba::unhex ( "01234FG1234", std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( res.position == 6 );
+    BOOST_CHECK ( s.size () == 3 );
+
+    s.clear ();
+    res = ba::unhex ( "P1234FA1234", std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( res.position == 0 );
+    BOOST_CHECK ( s.empty ());
+
+//  Characters that are not hex digits once truncated to 8 bits
+    res = ba::unhex ( std::wstring ( L"4\x0141" ), std::back_inserter(s), std::nothrow );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( res.position == 1 );
+
+//  Wide output needs four characters per value
+    std::wstring wout;
+    ba::unhex_result<std::back_insert_iterator<std::wstring> > wres =
+        ba::unhex ( "112233", std::back_inserter(wout), std::nothrow );
+    BOOST_CHECK ( wres.error == ba::hex_decode_errc::not_enough_input );
+    BOOST_CHECK ( wres.position == 6 );
+    BOOST_CHECK ( wout.size () == 6 / ( 2 * sizeof ( wchar_t )));
+    }
+
+void test_sizes () {
+    BOOST_CHECK ( ba::hex_encoded_size ( 0 ) == 0 );
+    BOOST_CHECK ( ba::hex_encoded_size ( 5 ) == 10 );
+    BOOST_CHECK ( ba::hex_encoded_size<wchar_t> ( 3 ) == 6 * sizeof ( wchar_t ));
+    BOOST_CHECK ( ba::hex_decoded_size ( 10 ) == 5 );
+    BOOST_CHECK ( ba::hex_decoded_size ( 11 ) == 5 );
+    BOOST_CHECK ( ba::hex_decoded_size<wchar_t> ( 8 * sizeof ( wchar_t )) == 4 );
+
+#ifndef BOOST_NO_CXX11_CONSTEXPR
+    static_assert ( ba::hex_encoded_size ( 16 ) == 32, "hex_encoded_size" );
+    static_assert ( ba::hex_decoded_size ( 32 ) == 16, "hex_decoded_size" );
+#endif
+    }
+
+void test_buffers () {
+    const char *tests [] = { "", "a", "\001", "12", "asdfadsfsad", "\xFF\x80\x7F", NULL };
+    for ( const char **p = tests; *p; ++p ) {
+        const std::size_t len = std::strlen ( *p );
+        std::string expected = ba::hex ( std::string ( *p ));
+        std::string buf ( ba::hex_encoded_size ( len ), '?' );
+        char *end = ba::hex_to_buffer ( *p, len, &buf[0] );
+        BOOST_CHECK ( end == &buf[0] + buf.size ());
+        BOOST_CHECK ( buf == expected );
+
+        std::string lbuf ( ba::hex_encoded_size ( len ), '?' );
+        ba::hex_lower_to_buffer ( *p, len, &lbuf[0] );
+        BOOST_CHECK ( lbuf == ba::hex_lower ( std::string ( *p )));
+
+        std::vector<char> back ( ba::hex_decoded_size ( buf.size ()) + 1 );
+        ba::unhex_result<char *> res = ba::unhex_to_buffer ( buf.data (), buf.size (), &back[0] );
+        BOOST_CHECK ( res.ok ());
+        BOOST_CHECK ( res.position == buf.size ());
+        BOOST_CHECK ( res.out == &back[0] + len );
+        BOOST_CHECK ( std::string ( &back[0], res.out ) == *p );
+        }
+
+//  Wide values in, narrow characters out - and back again
+    const wchar_t wide [] = { 0x1234, 0x00FF, 0x0001 };
+    char wbuf [ ba::hex_encoded_size<wchar_t> ( 3 ) + 1 ];
+    *ba::hex_to_buffer ( wide, 3, wbuf ) = '\0';
+    wchar_t wback [ 3 ];
+    ba::unhex_result<wchar_t *> wres = ba::unhex_to_buffer ( wbuf, std::strlen ( wbuf ), wback );
+    BOOST_CHECK ( wres.ok ());
+    BOOST_CHECK ( std::equal ( wide, wide + 3, wback ));
+
+//  Errors
+    char out [ 8 ];
+    ba::unhex_result<char *> res = ba::unhex_to_buffer ( "0102X3", 6, out );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( res.position == 4 );
+    BOOST_CHECK ( res.out == out + 2 );
+
+    res = ba::unhex_to_buffer ( "01020", 5, out );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::not_enough_input );
+    BOOST_CHECK ( res.position == 5 );
+    BOOST_CHECK ( res.out == out + 2 );
+
+    res = ba::unhex_to_buffer ( "0102g", 5, out );
+    BOOST_CHECK ( res.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( res.position == 4 );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_nothrow_success ();
+    test_nothrow_errors ();
+    test_sizes ();
+    test_buffers ();
+}
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the chunked encoder and decoder
+*/
+
+#include <boost/config.hpp>
+#include <boost/algorithm/hex.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+namespace ba = boost::algorithm;
+
+//  Encode 'input' feeding it 'in_chunk' values at a time into an output
+//  buffer of 'out_chunk' characters.
+template <typename T>
+std::string chunked_hex ( const std::basic_string<T> &input, std::size_t in_chunk, std::size_t out_chunk, bool lower ) {
+    ba::hex_encoder<T> enc ( lower );
+    std::string result;
+    std::vector<char> buf ( out_chunk );
+    std::size_t pos = 0;
+    while ( pos < input.size () || enc.pending ()) {
+        const std::size_t n = (std::min) ( in_chunk, input.size () - pos );
+        ba::hex_stream_result r = enc.encode ( input.data () + pos, n, &buf[0], buf.size ());
+        BOOST_CHECK ( r.error == ba::hex_decode_errc::ok );
+        BOOST_CHECK ( r.consumed <= n );
+        BOOST_CHECK ( r.produced <= buf.size ());
+        pos += r.consumed;
+        result.append ( buf.begin (), buf.begin () + r.produced );
+        }
+    return result;
+    }
+
+template <typename T>
+std::basic_string<T> chunked_unhex ( const std::string &input, std::size_t in_chunk, std::size_t out_chunk ) {
+    ba::hex_decoder<T> dec;
+    std::basic_string<T> result;
+    std::vector<T> buf ( out_chunk );
+    std::size_t pos = 0;
+    while ( pos < input.size ()) {
+        const std::size_t n = (std::min) ( in_chunk, input.size () - pos );
+        ba::hex_stream_result r = dec.decode ( input.data () + pos, n, &buf[0], buf.size ());
+        BOOST_CHECK ( r.error == ba::hex_decode_errc::ok );
+        BOOST_CHECK ( r.consumed <= n );
+        BOOST_CHECK ( r.produced <= buf.size ());
+        pos += r.consumed;
+        result.append ( buf.begin (), buf.begin () + r.produced );
+        }
+    BOOST_CHECK ( dec.finish () == ba::hex_decode_errc::ok );
+    BOOST_CHECK ( !dec.pending ());
+    return result;
+    }
+
+void test_round_trip () {
+    const std::string data ( "The quick brown fox jumps over the lazy dog \001\177\200\377" );
+    const std::string expected = ba::hex ( data );
+    const std::string expected_lower = ba::hex_lower ( data );
+    const std::wstring wdata ( L"\x1234\xABCD" L"wide" );
+    std::string wexpected;
+    ba::hex ( wdata, std::back_inserter ( wexpected ));
+
+    for ( std::size_t in_chunk = 1; in_chunk < 10; ++in_chunk )
+        for ( std::size_t out_chunk = 1; out_chunk < 12; ++out_chunk ) {
+            BOOST_CHECK ( chunked_hex ( data, in_chunk, out_chunk, false ) == expected );
+            BOOST_CHECK ( chunked_hex ( data, in_chunk, out_chunk, true ) == expected_lower );
+            BOOST_CHECK ( chunked_unhex<char> ( expected, in_chunk, out_chunk ) == data );
+            BOOST_CHECK ( chunked_unhex<char> ( expected_lower, in_chunk, out_chunk ) == data );
+            BOOST_CHECK ( chunked_hex ( wdata, in_chunk, out_chunk, false ) == wexpected );
+            BOOST_CHECK ( chunked_unhex<wchar_t> ( wexpected, in_chunk, out_chunk ) == wdata );
+            }
+    }
+
+void test_decode_errors () {
+    char out [ 16 ];
+
+//  A value split across chunks
+    ba::hex_decoder<> dec;
+    ba::hex_stream_result r = dec.decode ( "414", 3, out, sizeof ( out ));
+    BOOST_CHECK ( r.error == ba::hex_decode_errc::ok );
+    BOOST_CHECK ( r.consumed == 3 && r.produced == 1 && out [ 0 ] == 'A' );
+    BOOST_CHECK ( dec.pending ());
+    BOOST_CHECK ( dec.finish () == ba::hex_decode_errc::not_enough_input );
+    r = dec.decode ( "2", 1, out, sizeof ( out ));
+    BOOST_CHECK ( r.consumed == 1 && r.produced == 1 && out [ 0 ] == 'B' );
+    BOOST_CHECK ( dec.finish () == ba::hex_decode_errc::ok );
+
+//  A bad character stops the decoder; it is not consumed
+    r = dec.decode ( "41424X43", 8, out, sizeof ( out ));
+    BOOST_CHECK ( r.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( r.consumed == 5 && r.produced == 2 );
+    BOOST_CHECK ( dec.pending ());
+
+//  Skipping the bad character picks up where it left off
+    r = dec.decode ( "3", 1, out, sizeof ( out ));
+    BOOST_CHECK ( r.error == ba::hex_decode_errc::ok );
+    BOOST_CHECK ( r.consumed == 1 && r.produced == 1 && out [ 0 ] == 'C' );
+
+//  Bad character while finishing a split value
+    dec.reset ();
+    BOOST_CHECK ( !dec.pending ());
+    r = dec.decode ( "4", 1, out, sizeof ( out ));
+    r = dec.decode ( "G", 1, out, sizeof ( out ));
+    BOOST_CHECK ( r.error == ba::hex_decode_errc::non_hex_input );
+    BOOST_CHECK ( r.consumed == 0 && r.produced == 0 );
+
+//  No room in the output: the final digit of a value is not consumed
+    dec.reset ();
+    r = dec.decode ( "4142", 4, out, 1 );
+    BOOST_CHECK ( r.error == ba::hex_decode_errc::ok );
+    BOOST_CHECK ( r.consumed == 3 && r.produced == 1 );
+    r = dec.decode ( "2", 1, out, 0 );
+    BOOST_CHECK ( r.consumed == 0 && r.produced == 0 );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_round_trip ();
+    test_decode_errors ();
+}
@@ -13,6 +13,7 @@
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
 
+#include <deque>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -78,6 +79,70 @@ void test_ints () {
     BOOST_CHECK ( test_iota_results ( l.rbegin (), l.rend (), 123 ));
     }
     
+//  The reference: one increment at a time
+template <typename Iterator, typename T, typename Step>
+bool check_steps ( Iterator first, Iterator last, T value, Step step ) {
+    for ( ; first != last; ++first, value += step )
+        if ( *first != static_cast<typename std::iterator_traits<Iterator>::value_type> ( value ))
+            return false;
+    return true;
+    }
+
+//  Arrays of numbers, which are filled without counting
+template <typename V, typename T>
+void test_numbers ( T value ) {
+    const std::size_t sizes [] = { 0, 1, 7, 16, 1000, 65535, 65536, 65537, 200001 };
+    for ( std::size_t i = 0; i < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++i ) {
+        std::vector<V> v ( sizes [ i ] );
+        boost::algorithm::iota ( v.begin (), v.end (), value );
+        BOOST_CHECK ( check_steps ( v.begin (), v.end (), value, 1 ));
+
+        std::vector<V> w ( sizes [ i ] );
+        BOOST_CHECK ( boost::algorithm::iota_n ( w.begin (), value, w.size ()) == w.end ());
+        BOOST_CHECK ( w == v );
+
+        boost::algorithm::iota ( v.begin (), v.end (), value, 3 );
+        BOOST_CHECK ( check_steps ( v.begin (), v.end (), value, 3 ));
+        boost::algorithm::iota ( v.begin (), v.end (), value, -2 );
+        BOOST_CHECK ( check_steps ( v.begin (), v.end (), value, -2 ));
+        }
+    }
+
+void test_arrays () {
+    test_numbers<int> ( 23 );
+    test_numbers<int> ( -100000 );
+    test_numbers<long long> ( 1LL << 40 );
+    test_numbers<double> ( 5.0 );
+    test_numbers<double> ( -7 );        // int values, double elements
+    test_numbers<float> ( 1.0f );
+    test_numbers<short> ( 100 );        // wraps around, as the increments do
+    test_numbers<unsigned char> ( 250 );
+    test_numbers<unsigned> ( 4294967000u );
+
+//  Values that repeated increments round, so they are counted
+    std::vector<double> d ( 1000 );
+    boost::algorithm::iota ( d.begin (), d.end (), 0.1 );
+    BOOST_CHECK ( check_steps ( d.begin (), d.end (), 0.1, 1.0 ));
+    boost::algorithm::iota ( d.begin (), d.end (), 0.0, 0.1 );
+    BOOST_CHECK ( check_steps ( d.begin (), d.end (), 0.0, 0.1 ));
+    std::vector<float> f ( 100 );
+    boost::algorithm::iota ( f.begin (), f.end (), 16777200.0f );     // near 2^24, where ++ stops
+    BOOST_CHECK ( check_steps ( f.begin (), f.end (), 16777200.0f, 1.0f ));
+
+//  Other sequences
+    std::deque<int> q ( 1000 );
+    boost::algorithm::iota ( q.begin (), q.end (), 5, 7 );
+    BOOST_CHECK ( check_steps ( q.begin (), q.end (), 5, 7 ));
+    std::list<std::string::size_type> l ( 10 );
+    boost::algorithm::iota ( l.begin (), l.end (), 3u, 2u );
+    BOOST_CHECK ( check_steps ( l.begin (), l.end (), 3u, 2u ));
+    int a [ 100 ];
+    boost::algorithm::iota ( a, a + 100, 1, 10 );
+    BOOST_CHECK ( check_steps ( a, a + 100, 1, 10 ));
+    BOOST_CHECK ( boost::algorithm::iota_n ( a, 4, 50 ) == a + 50 );
+    BOOST_CHECK ( check_steps ( a, a + 50, 4, 1 ));
+    }
+
 BOOST_CXX14_CONSTEXPR inline bool test_constexpr_iota() {
     bool res = true;
     int data[] = {0, 0, 0};
@@ -86,6 +151,9 @@ BOOST_CXX14_CONSTEXPR inline bool test_constexpr_iota() {
     
     boost::algorithm::iota(data, data + 3, 1); // fill all
     res = (res && test_iota_results(data, data + 3, 1));
+
+    boost::algorithm::iota(data, data + 3, 5, -2); // with a step
+    res = (res && data[0] == 5 && data[1] == 3 && data[2] == 1);
     
     return res;
     }
@@ -107,6 +175,7 @@ BOOST_CXX14_CONSTEXPR inline bool test_constexpr_iota_n() {
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_ints ();
+  test_arrays ();
   BOOST_CXX14_CONSTEXPR bool constexpr_iota_res = test_constexpr_iota ();
   BOOST_CHECK(constexpr_iota_res);
   BOOST_CXX14_CONSTEXPR bool constexpr_iota_n_res = test_constexpr_iota_n ();
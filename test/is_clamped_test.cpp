@@ -18,6 +18,7 @@
 #include <limits>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
@@ -217,6 +218,51 @@ void test_spaceship() {
   #endif
 }
 
+void test_ranges() {
+  //  Long enough for several blocks of the vectorized path, and a tail
+  std::vector<int> v;
+  for (int i = 0; i < 1000; ++i)
+    v.push_back(i % 100);
+  BOOST_CHECK(ba::is_clamped_range(v, 0, 99));
+  BOOST_CHECK(ba::is_clamped_range_until(v, 0, 99) == v.end());
+  BOOST_CHECK(ba::is_clamped_range_until(&v[0], &v[0] + v.size(), 0, 99) == &v[0] + v.size());
+  BOOST_CHECK(ba::is_clamped_range_until(&v[0], &v[0] + v.size(), 1, 99) == &v[0]);
+  BOOST_CHECK(ba::is_clamped_range_until(&v[0], &v[0] + v.size(), 0, 98) == &v[99]);
+
+  const std::size_t positions[] = { 0, 1, 63, 64, 65, 500, 998, 999 };
+  for (std::size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); ++i) {
+    std::vector<int> w(v);
+    w[positions[i]] = -1;
+    const int *first = &w[0], *last = first + w.size();
+    BOOST_CHECK(ba::is_clamped_range_until(first, last, 0, 99) == first + positions[i]);
+    BOOST_CHECK(ba::is_clamped_range_until(w.begin(), w.end(), 0, 99) == w.begin() + positions[i]);
+    BOOST_CHECK(!ba::is_clamped_range(first, last, 0, 99));
+    w[positions[i]] = 100;
+    BOOST_CHECK(ba::is_clamped_range_until(first, last, 0, 99) == first + positions[i]);
+  }
+
+  //  With a predicate, and the empty range
+  BOOST_CHECK(ba::is_clamped_range(v, 99, 0, intGreater));
+  BOOST_CHECK(ba::is_clamped_range_until(v, 98, 0, intGreater) == v.begin() + 99);
+  BOOST_CHECK(ba::is_clamped_range(v.begin(), v.begin(), 5, 6));
+
+  //  NaNs are in range, as for is_clamped
+  std::vector<double> d(300, 0.5);
+  d[100] = std::numeric_limits<double>::quiet_NaN();
+  BOOST_CHECK(ba::is_clamped_range(&d[0], &d[0] + d.size(), 0.0, 1.0));
+  BOOST_CHECK(ba::is_clamped_range(d.begin(), d.end(), 0.0, 1.0));
+  d[200] = 1.5;
+  BOOST_CHECK(ba::is_clamped_range_until(&d[0], &d[0] + d.size(), 0.0, 1.0) == &d[200]);
+  const std::vector<double>& cd = d;
+  BOOST_CHECK(ba::is_clamped_range_until(cd.begin(), cd.end(), 0.0, 1.0) == cd.begin() + 200);
+  BOOST_CHECK(ba::is_clamped_range_until(cd.begin(), cd.begin() + 200, 0.0, 1.0) == cd.begin() + 200);
+
+  std::vector<custom> c;
+  for (int i = 0; i < 10; ++i)
+    c.push_back(custom(i));
+  BOOST_CHECK(ba::is_clamped_range_until(c.begin(), c.end(), custom(0), custom(6), customLess) == c.begin() + 7);
+}
+
 BOOST_AUTO_TEST_CASE(test_main) {
   test_ints();
   test_floats();
@@ -226,6 +272,7 @@ BOOST_AUTO_TEST_CASE(test_main) {
   test_first_argument_determines_types();
   test_constexpr();
   test_spaceship();
+  test_ranges();
 }
 
 #if __cplusplus >= 201103L
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <iostream>
 #include <list>
+#include <string>
 #include <vector>
 
 
@@ -70,7 +71,50 @@ void test_is_palindrome()
     BOOST_CHECK (!ba::is_palindrome("acab"));
 }
 
+//  The word-at-a-time path, for every length up to several blocks, against
+//  the element-at-a-time path (through a list)
+void test_is_palindrome_words()
+{
+    const char alphabet[] = "ACGTacgt@`[{\xc1\xe1";
+    for (std::size_t n = 0; n < 150; ++n)
+    {
+        std::string s(n, 'x');
+        for (std::size_t i = 0; i < (n + 1) / 2; ++i)
+            s[i] = s[n - 1 - i] = alphabet[(i * 7 + n) % (sizeof(alphabet) - 1)];
+        const std::vector<unsigned char> u(s.begin(), s.end());
+        BOOST_CHECK ( ba::is_palindrome(s));
+        BOOST_CHECK ( ba::is_palindrome(u));
+        BOOST_CHECK ( ba::is_palindrome(s.c_str()));
+        BOOST_CHECK ( ba::is_palindrome(s, ba::ascii_iequal()));
+
+    //  Break it at each position in the first half
+        for (std::size_t i = 0; i < n / 2; ++i)
+        {
+            std::string t(s);
+            t[i] = t[i] == 'A' ? 'C' : 'A';
+            const std::list<char> l(t.begin(), t.end());
+            BOOST_CHECK (!ba::is_palindrome(t));
+            BOOST_CHECK (!ba::is_palindrome(t.data(), t.data() + t.size(), std::equal_to<char>()));
+            BOOST_CHECK (!ba::is_palindrome(l));
+            BOOST_CHECK (ba::is_palindrome(t, ba::ascii_iequal()) == ba::is_palindrome(l, ba::ascii_iequal()));
+            t = s;
+            t[n - 1 - i] = t[n - 1 - i] == 'g' ? 't' : 'g';
+            BOOST_CHECK (!ba::is_palindrome(t.begin(), t.end()));
+        }
+    }
+
+//  Only the ASCII letters are folded
+    const std::string dna = std::string(40, 'a') + "GATTACAcattag" + std::string(40, 'A');
+    BOOST_CHECK (!ba::is_palindrome(dna));
+    BOOST_CHECK ( ba::is_palindrome(dna, ba::ascii_iequal()));
+    BOOST_CHECK ( ba::is_palindrome(dna.c_str(), ba::ascii_iequal()));
+    const std::string punctuation = std::string(40, '-') + "@[\xc1!\xe1{`" + std::string(40, '-');
+    BOOST_CHECK (!ba::is_palindrome(punctuation, ba::ascii_iequal()));
+    BOOST_CHECK ( ba::ascii_iequal()('Q', 'q') && !ba::ascii_iequal()('@', '`'));
+}
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_is_palindrome ();
+  test_is_palindrome_words ();
 }
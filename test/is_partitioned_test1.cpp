@@ -68,10 +68,40 @@ void test_sequence1 () {
     BOOST_CHECK ( ba::is_partitioned ( l.begin (), l.end (), less_than<int>(99)));      // all elements satisfy 
     }
 
+//  Arrays of numbers, which are tested a block at a time
+void test_blocks () {
+    for ( int n = 0; n < 600; n += 7 )
+        for ( int pp = 0; pp <= n; pp += 3 ) {
+            std::vector<short> v ( n );
+            for ( int i = 0; i < n; ++i )
+                v [ i ] = i < pp ? 1 : 50;
+            BOOST_CHECK ( ba::is_partitioned ( v, less_than<short>(10)));
+            if ( pp + 1 < n ) {
+                v [ n - 1 ] = 2;
+                BOOST_CHECK ( !ba::is_partitioned ( v, less_than<short>(10)));
+                BOOST_CHECK ( !ba::is_partitioned ( v.begin () + pp, v.end (), less_than<short>(10)));
+                BOOST_CHECK ( ba::is_partitioned ( v.begin () + pp, v.end () - 1, less_than<short>(10)));
+                }
+            }
+    }
+
+//  A predicate may take the elements by non-const reference
+bool odd ( int &v ) { return v % 2 != 0; }
+
+void test_non_const_predicate () {
+    std::vector<int> v ( 1000, 1 );
+    for ( std::size_t i = 600; i < v.size (); ++i )
+        v [ i ] = 2;
+    BOOST_CHECK ( ba::is_partitioned ( v.begin (), v.end (), odd ));
+    v [ 900 ] = 3;
+    BOOST_CHECK ( !ba::is_partitioned ( v.begin (), v.end (), odd ));
+    }
 
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_sequence1 ();
+  test_blocks ();
+  test_non_const_predicate ();
   BOOST_CXX14_CONSTEXPR bool constexpr_res = test_constexpr ();
   BOOST_CHECK ( constexpr_res );
 }
@@ -7,6 +7,7 @@
     For more information, see http://www.boost.org
 */
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/config.hpp>
@@ -18,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <deque>
 
 namespace ba = boost::algorithm;
 // namespace ba = boost;
@@ -56,8 +58,70 @@ void test_sequence1 () {
     BOOST_CHECK ( ba::is_partitioned_until ( l.begin (), l.end (), less_than<int>(99)) == l.end());      // all elements satisfy
 }
 
+//  Counts how often it is applied to each element of an array
+template <typename T>
+struct counted_less_than {
+    counted_less_than ( const T *base, std::vector<int> &calls, T limit ) : base_ ( base ), calls_ ( &calls ), limit_ ( limit ) {}
+    bool operator () ( const T &v ) const { ++(*calls_) [ &v - base_ ]; return v < limit_; }
+private:
+    const T *base_;
+    std::vector<int> *calls_;
+    T limit_;
+};
+
+//  Arrays of numbers, which are tested a block at a time, with the
+//  partition point and the element out of place on either side of the
+//  block boundaries
+template <typename T>
+void test_blocks () {
+    const int sizes [] = { 0, 1, 2, 31, 32, 33, 255, 256, 257, 1000, 3000 };
+    for ( std::size_t s = 0; s < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++s ) {
+        const int n = sizes [ s ];
+        for ( int pp = 0; pp <= n; pp += ( pp < 300 ? 1 : 97 )) {
+            std::vector<T> v ( n );
+            for ( int i = 0; i < n; ++i )
+                v [ i ] = static_cast<T> ( i < pp ? 1 : 50 );
+            BOOST_CHECK ( ba::is_partitioned_until ( v, less_than<T>(10)) == v.end ());
+
+            const int bads [] = { pp + 1, pp + 2, pp + 63, pp + 64, pp + 65, n - 1 };
+            for ( std::size_t b = 0; b < sizeof ( bads ) / sizeof ( bads [ 0 ] ); ++b ) {
+                const int bad = bads [ b ];
+                if ( bad <= pp || bad >= n )
+                    continue;
+                v [ bad ] = static_cast<T> ( 2 );
+                BOOST_CHECK ( ba::is_partitioned_until ( v, less_than<T>(10)) == v.begin () + bad );
+                BOOST_CHECK ( ba::is_partitioned_until ( &v [ 0 ], &v [ 0 ] + n, less_than<T>(10)) == &v [ 0 ] + bad );
+                std::deque<T> d ( v.begin (), v.end ());
+                BOOST_CHECK ( ba::is_partitioned_until ( d.begin (), d.end (), less_than<T>(10)) == d.begin () + bad );
+
+                std::vector<int> calls ( n );
+                ba::is_partitioned_until ( v.begin (), v.end (), counted_less_than<T> ( &v [ 0 ], calls, 10 ));
+                BOOST_CHECK ( *std::max_element ( calls.begin (), calls.end ()) == 1 );
+                BOOST_CHECK ( std::count ( calls.begin (), calls.begin () + bad + 1, 1 ) == bad + 1 );
+                v [ bad ] = static_cast<T> ( 50 );
+                }
+            }
+        }
+}
+
+//  A predicate may take the elements by non-const reference
+bool odd ( int &v ) { return v % 2 != 0; }
+
+void test_non_const_predicate () {
+    std::vector<int> v ( 1000, 1 );
+    for ( std::size_t i = 600; i < v.size (); ++i )
+        v [ i ] = 2;
+    BOOST_CHECK ( ba::is_partitioned_until ( v.begin (), v.end (), odd ) == v.end ());
+    v [ 900 ] = 3;
+    BOOST_CHECK ( ba::is_partitioned_until ( v.begin (), v.end (), odd ) == v.begin () + 900 );
+}
 
 BOOST_AUTO_TEST_CASE( test_main )
 {
     test_sequence1 ();
+    test_non_const_predicate ();
+    test_blocks<int> ();
+    test_blocks<char> ();
+    test_blocks<double> ();
+    test_blocks<unsigned long long> ();
 }
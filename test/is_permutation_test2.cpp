@@ -0,0 +1,344 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the counting and hashing versions of is_permutation, and
+is_permutation_ordered, against the quadratic one
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/cxx11/is_permutation.hpp>
+#include <boost/algorithm/cxx14/is_permutation.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+
+//  Only equality: is_permutation has to compare everything with everything
+struct point {
+    point ( int x ) : x_ ( x ) {}
+    int x_;
+    };
+bool operator == ( const point &a, const point &b ) { return a.x_ == b.x_; }
+bool operator != ( const point &a, const point &b ) { return a.x_ != b.x_; }
+
+struct point_hash {
+    std::size_t operator () ( const point &p ) const { return static_cast<std::size_t> ( p.x_ ) * 31u; }
+    };
+
+struct same_parity {
+    bool operator () ( int a, int b ) const { return ( a - b ) % 2 == 0; }
+    };
+
+struct iequal {
+    bool operator () ( const std::string &a, const std::string &b ) const {
+        if ( a.size () != b.size ()) return false;
+        for ( std::size_t i = 0; i < a.size (); ++i )
+            if ( std::tolower ( a [ i ] ) != std::tolower ( b [ i ] ))
+                return false;
+        return true;
+        }
+    };
+
+struct ihash {
+    std::size_t operator () ( const std::string &s ) const {
+        std::size_t h = 0;
+        for ( std::size_t i = 0; i < s.size (); ++i )
+            h = h * 131 + static_cast<std::size_t> ( std::tolower ( s [ i ] ));
+        return h;
+        }
+    };
+
+struct string_hash {
+    std::size_t operator () ( const std::string &s ) const {
+        std::size_t h = s.size ();
+        for ( std::size_t i = 0; i < s.size (); ++i )
+            h = h * 31 + static_cast<unsigned char> ( s [ i ] );
+        return h;
+        }
+    };
+
+struct constant_hash {
+    std::size_t operator () ( int ) const { return 42; }
+    };
+
+//  Checks v1 against a shuffled copy of itself, and against copies with one
+//  element changed, both with the default comparison and with std::equal_to.
+template <typename T>
+void check_shuffles ( const std::vector<T> &v1, T other ) {
+    std::vector<T> v2 ( v1 );
+    std::reverse ( v2.begin (), v2.end ());
+    std::random_shuffle ( v2.begin () + v2.size () / 2, v2.end ());
+
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin ()));
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), std::equal_to<T> ()));
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), v2.end ()));
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), v2.end (), std::equal_to<T> ()));
+
+    if ( v2.empty ()) return;
+    BOOST_CHECK ( !ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), v2.end () - 1 ));
+    const std::size_t positions [] = { 0, v2.size () / 2, v2.size () - 1 };
+    for ( std::size_t i = 0; i < 3; ++i ) {
+        std::vector<T> v3 ( v2 );
+        v3 [ positions [ i ]] = other;
+        const bool expected = std::count ( v1.begin (), v1.end (), other ) == std::count ( v3.begin (), v3.end (), other );
+        BOOST_CHECK_EQUAL ( ba::is_permutation ( v1.begin (), v1.end (), v3.begin ()), expected );
+        BOOST_CHECK_EQUAL ( ba::is_permutation ( v1.begin (), v1.end (), v3.begin (), v3.end ()), expected );
+        BOOST_CHECK_EQUAL ( ba::is_permutation ( v3.begin (), v3.end (), v1.begin (), v1.end ()), expected );
+        BOOST_CHECK_EQUAL ( ba::detail::is_permutation_inner ( v1.begin (), v1.end (), v3.begin (), v3.end (),
+                                                               std::equal_to<T> ()), expected );
+        }
+    }
+
+const std::size_t sizes [] = { 0, 1, 15, 16, 17, 100, 4095, 4096, 10000 };
+const std::size_t num_sizes = sizeof ( sizes ) / sizeof ( sizes [ 0 ] );
+
+BOOST_AUTO_TEST_CASE( test_counting )
+{
+    for ( std::size_t i = 0; i < num_sizes; ++i ) {
+        std::vector<unsigned char> uc;
+        std::vector<signed char> sc;
+        std::vector<short> s;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j ) {
+            uc.push_back ( static_cast<unsigned char> ( std::rand ()));
+            sc.push_back ( static_cast<signed char> ( std::rand () % 200 - 100 ));
+            s.push_back ( static_cast<short> ( std::rand () % 60000 - 30000 ));
+            }
+        check_shuffles ( uc, static_cast<unsigned char> ( 7 ));
+        check_shuffles ( sc, static_cast<signed char> ( -7 ));
+        check_shuffles ( s, static_cast<short> ( -30001 ));
+        check_shuffles ( std::vector<char> ( sizes [ i ], 'a' ), 'b' );
+        }
+
+    std::vector<bool> b1 ( 100, false ), b2 ( 100, false );
+    b1 [ 3 ] = b2 [ 97 ] = true;
+    BOOST_CHECK ( ba::is_permutation ( b1.begin (), b1.end (), b2.begin ()));
+    b2 [ 50 ] = true;
+    BOOST_CHECK ( !ba::is_permutation ( b1.begin (), b1.end (), b2.begin (), b2.end ()));
+}
+
+//  Has only ==, so a pair of it has a < that can't be instantiated
+struct tag {
+    tag ( int t ) : t_ ( t ) {}
+    int t_;
+    };
+bool operator == ( const tag &a, const tag &b ) { return a.t_ == b.t_; }
+
+//  < orders by the key alone, == compares the tag as well
+struct keyed {
+    keyed ( int key, int tag ) : key_ ( key ), tag_ ( tag ) {}
+    int key_, tag_;
+    };
+bool operator <  ( const keyed &a, const keyed &b ) { return a.key_ < b.key_; }
+bool operator == ( const keyed &a, const keyed &b ) { return a.key_ == b.key_ && a.tag_ == b.tag_; }
+bool operator != ( const keyed &a, const keyed &b ) { return !( a == b ); }
+
+struct key_less {
+    bool operator () ( const keyed &a, const keyed &b ) const { return a.key_ < b.key_; }
+    };
+
+//  Having a < doesn't make is_permutation sort
+BOOST_AUTO_TEST_CASE( test_less_not_used )
+{
+    std::vector<std::pair<int, tag> > p1;
+    for ( int i = 0; i < 20; ++i )
+        p1.push_back ( std::make_pair ( i % 3, tag ( i )));
+    std::vector<std::pair<int, tag> > p2 ( p1.rbegin (), p1.rend ());
+    BOOST_CHECK ( ba::is_permutation ( p1.begin (), p1.end (), p2.begin ()));
+    p2 [ 5 ].second = tag ( 100 );
+    BOOST_CHECK ( !ba::is_permutation ( p1.begin (), p1.end (), p2.begin ()));
+
+    std::vector<keyed> k1;
+    for ( int i = 0; i < 20; ++i )
+        k1.push_back ( keyed ( i % 4, i ));
+    std::vector<keyed> k2 ( k1.rbegin (), k1.rend ());
+    BOOST_CHECK ( ba::is_permutation ( k1.begin (), k1.end (), k2.begin ()));
+    BOOST_CHECK ( ba::is_permutation ( k1.begin (), k1.end (), k2.begin (), k2.end ()));
+
+    for ( std::size_t i = 0; i < num_sizes && sizes [ i ] <= 4096; ++i ) {
+        std::vector<std::pair<int, int> > v;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j )
+            v.push_back ( std::make_pair ( std::rand () % 10, std::rand () % 100 ));
+        check_shuffles ( v, std::make_pair ( 5, 5 ));
+        }
+}
+
+BOOST_AUTO_TEST_CASE( test_ordered )
+{
+    for ( std::size_t i = 0; i < num_sizes; ++i ) {
+        std::vector<keyed> k1;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j )
+            k1.push_back ( keyed ( std::rand () % 10, std::rand () % 100 ));
+        std::vector<keyed> k2 ( k1.rbegin (), k1.rend ());
+        std::random_shuffle ( k2.begin (), k2.end ());
+        BOOST_CHECK ( ba::is_permutation_ordered ( k1.begin (), k1.end (), k2.begin (), k2.end (), key_less ()));
+        BOOST_CHECK ( ba::is_permutation_ordered ( k1.begin (), k1.end (), k2.begin (), k2.end (),
+                                                   std::equal_to<keyed> (), std::less<keyed> ()));
+        if ( k2.empty ()) continue;
+        BOOST_CHECK ( !ba::is_permutation_ordered ( k1.begin (), k1.end (), k2.begin (), k2.end () - 1, key_less ()));
+
+    //  Same keys, different tags
+        k2 [ k2.size () / 2 ].tag_ = 1000;
+        BOOST_CHECK ( !ba::is_permutation_ordered ( k1.begin (), k1.end (), k2.begin (), k2.end (), key_less ()));
+        BOOST_CHECK ( !ba::is_permutation_ordered ( k2.begin (), k2.end (), k1.begin (), k1.end (), key_less ()));
+
+    //  Different keys
+        k2 [ k2.size () / 2 ] = keyed ( 10, 0 );
+        BOOST_CHECK ( !ba::is_permutation_ordered ( k1.begin (), k1.end (), k2.begin (), k2.end (), key_less ()));
+        }
+
+//  Iterators that aren't random access
+    std::list<keyed> l1, l2;
+    for ( int i = 0; i < 50; ++i ) {
+        l1.push_back ( keyed ( i % 5, i ));
+        l2.push_front ( keyed ( i % 5, i ));
+        }
+    BOOST_CHECK ( ba::is_permutation_ordered ( l1.begin (), l1.end (), l2.begin (), l2.end (), key_less ()));
+    l2.front ().tag_ = 7;
+    BOOST_CHECK ( !ba::is_permutation_ordered ( l1.begin (), l1.end (), l2.begin (), l2.end (), key_less ()));
+}
+
+BOOST_AUTO_TEST_CASE( test_default_hashing )
+{
+    for ( std::size_t i = 0; i < num_sizes; ++i ) {
+        std::vector<int> v;
+        std::vector<double> d;
+        std::vector<std::string> s;
+        std::vector<const std::size_t *> ptrs;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j ) {
+            v.push_back ( std::rand () % 1000 );
+            d.push_back ( std::rand () % 1000 / 8.0 );
+            s.push_back ( std::string ( 1, 'a' + std::rand () % 26 ) + "xyz" );
+            ptrs.push_back ( sizes + std::rand () % num_sizes );
+            }
+        check_shuffles ( v, 5 );
+        check_shuffles ( d, 0.5 );
+        check_shuffles ( s, std::string ( "q" ));
+        check_shuffles ( ptrs, static_cast<const std::size_t *> ( NULL ));
+        }
+
+//  NaNs don't equal anything, not even another NaN
+    std::vector<double> d1 ( 100, 1.0 );
+    d1 [ 50 ] = std::numeric_limits<double>::quiet_NaN ();
+    BOOST_CHECK ( !ba::is_permutation ( d1.begin (), d1.end (), d1.begin ()));
+    std::vector<double> d2 ( d1.rbegin (), d1.rend ());
+    BOOST_CHECK ( !ba::is_permutation ( d1.begin (), d1.end (), d2.begin ()));
+    BOOST_CHECK ( !ba::detail::is_permutation_inner ( d1.begin (), d1.end (), d2.begin (), d2.end (), std::equal_to<double> ()));
+
+//  ... but zeros of either sign do
+    std::vector<double> z1 ( 100, 0.0 ), z2 ( 100, 0.0 );
+    z1 [ 10 ] = z2 [ 90 ] = -0.0;
+    z1 [ 20 ] = -0.0;
+    BOOST_CHECK ( ba::is_permutation ( z1.begin (), z1.end (), z2.begin ()));
+}
+
+BOOST_AUTO_TEST_CASE( test_quadratic )
+{
+    for ( std::size_t i = 0; i < num_sizes && sizes [ i ] <= 4096; ++i ) {
+        std::vector<point> p;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j )
+            p.push_back ( point ( std::rand () % 100 ));
+        check_shuffles ( p, point ( 1000 ));
+        }
+
+//  A predicate other than std::equal_to is used as given
+    std::vector<int> v1, v2;
+    for ( int i = 0; i < 100; ++i ) {
+        v1.push_back ( i );
+        v2.push_back ( i + 2 );
+        }
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), same_parity ()));
+    BOOST_CHECK ( ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), v2.end (), same_parity ()));
+    BOOST_CHECK ( !ba::is_permutation ( v1.begin (), v1.end (), v2.begin (), v2.end ()));
+
+//  Also for iterators that aren't random access, and sequences of different lengths
+    std::list<int> l1 ( v1.begin (), v1.end ()), l2 ( v2.begin (), v2.end ());
+    BOOST_CHECK ( ba::is_permutation ( l1.begin (), l1.end (), l2.begin (), l2.end (), same_parity ()));
+    BOOST_CHECK ( !ba::is_permutation ( l1.begin (), l1.end (), l2.begin (), l2.end ()));
+    l2.assign ( v1.rbegin (), v1.rend ());
+    BOOST_CHECK ( ba::is_permutation ( l1.begin (), l1.end (), l2.begin (), l2.end ()));
+    l2.push_back ( 1000 );
+    BOOST_CHECK ( !ba::is_permutation ( l1.begin (), l1.end (), l2.begin (), l2.end ()));
+    BOOST_CHECK ( !ba::is_permutation ( l2.begin (), l2.end (), l1.begin (), l1.end ()));
+}
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+//  Values that can't be copied
+BOOST_AUTO_TEST_CASE( test_move_only )
+{
+    std::vector<std::unique_ptr<int> > v;
+    for ( int i = 0; i < 100; ++i )
+        v.push_back ( std::unique_ptr<int> ( new int ( i )));
+    BOOST_CHECK ( ba::is_permutation ( v.begin (), v.end (), v.begin ()));
+    BOOST_CHECK ( ba::is_permutation ( v.begin (), v.end (), v.begin (), v.end ()));
+    std::vector<std::unique_ptr<int> > w;
+    for ( std::size_t i = v.size (); i > 0; --i )
+        w.push_back ( std::move ( v [ i - 1 ] ));
+    std::vector<std::unique_ptr<int> > u;
+    for ( std::size_t i = 0; i < w.size (); ++i )
+        u.push_back ( std::unique_ptr<int> ( w [ i ].get ()));
+    std::reverse ( u.begin () + 10, u.end ());
+    BOOST_CHECK ( ba::is_permutation ( u.begin (), u.end (), w.begin (), w.end ()));
+    for ( std::size_t i = 0; i < u.size (); ++i )
+        u [ i ].release ();
+    u [ 0 ].reset ( new int ( 0 ));
+    BOOST_CHECK ( !ba::is_permutation ( u.begin (), u.end (), w.begin (), w.end ()));
+}
+#endif
+
+BOOST_AUTO_TEST_CASE( test_user_hashing )
+{
+    for ( std::size_t i = 0; i < num_sizes; ++i ) {
+        std::vector<std::string> s1;
+        std::vector<point> p1;
+        for ( std::size_t j = 0; j < sizes [ i ]; ++j ) {
+            s1.push_back ( std::string ( 1, 'a' + std::rand () % 26 ) + "Word" );
+            p1.push_back ( point ( std::rand () % 1000 ));
+            }
+        std::vector<std::string> s2 ( s1.rbegin (), s1.rend ());
+        std::vector<point> p2 ( p1.rbegin (), p1.rend ());
+
+        BOOST_CHECK ( ba::is_permutation ( s1.begin (), s1.end (), s2.begin (), s2.end (),
+                                           std::equal_to<std::string> (), string_hash ()));
+        BOOST_CHECK ( ba::is_permutation ( p1.begin (), p1.end (), p2.begin (), p2.end (),
+                                           std::equal_to<point> (), point_hash ()));
+
+    //  With a predicate that equates more values than ==
+        for ( std::size_t j = 0; j < s2.size (); j += 2 )
+            s2 [ j ][ 2 ] = 'O';
+        BOOST_CHECK ( ba::is_permutation ( s1.begin (), s1.end (), s2.begin (), s2.end (), iequal (), ihash ()));
+
+        if ( s2.empty ()) continue;
+        s2 [ s2.size () / 2 ] = "?";
+        BOOST_CHECK ( !ba::is_permutation ( s1.begin (), s1.end (), s2.begin (), s2.end (), iequal (), ihash ()));
+        BOOST_CHECK ( !ba::is_permutation ( s1.begin (), s1.end (), s2.begin (), s2.end () - 1, iequal (), ihash ()));
+        p2.back () = point ( 1000 );
+        BOOST_CHECK ( !ba::is_permutation ( p1.begin (), p1.end (), p2.begin (), p2.end (),
+                                            std::equal_to<point> (), point_hash ()));
+        }
+
+//  Every hash the same still gives the right answer
+    std::list<int> l1, l2;
+    for ( int i = 0; i < 200; ++i ) {
+        l1.push_back ( i % 7 );
+        l2.push_front ( i % 7 );
+        }
+    BOOST_CHECK ( ba::is_permutation ( l1.begin (), l1.end (), l2.begin (), l2.end (),
+                                       std::equal_to<int> (), constant_hash ()));
+}
@@ -7,6 +7,11 @@
     For more information, see http://www.boost.org
 */
 
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <boost/config.hpp>
 #include <boost/algorithm/cxx14/mismatch.hpp>
 
@@ -161,7 +166,11 @@ void test_mismatch ()
             
 //  Checks constexpr
     BOOST_CXX14_CONSTEXPR bool res = (
+//  Pointers, which are compared a word at a time at run time
+        iter_eq ( ba::mismatch ( num, num + sz, num, num + sz ), num + sz, num + sz )
+        && iter_eq ( ba::mismatch ( num + 1, num + sz, num, num + sz ), num + 2, num + 1 )
 //  No mismatch for empty
+        &&
         iter_eq ( 
             ba::mismatch ( input_iterator<const int *>(num),     input_iterator<const int *>(num), 
                            input_iterator<const int *>(num),     input_iterator<const int *>(num)),
@@ -189,7 +198,59 @@ void test_mismatch ()
 }
 
 
+enum colour { red, green, blue };
+
+//  Arrays of integers, enums and pointers are compared a word at a time;
+//  check every length up to 100, with a difference at every position
+template <typename T>
+void test_bytewise ( T a, T b ) {
+    for ( std::size_t n = 0; n < 100; ++n ) {
+        std::vector<T> v1 ( n, a );
+        const std::vector<T> v2 ( v1 );
+        BOOST_CHECK ( iter_eq ( ba::mismatch ( v1.data (), v1.data () + n, v2.data (), v2.data () + n ),
+                                v1.data () + n, v2.data () + n ));
+        for ( std::size_t i = 0; i < n; ++i ) {
+            v1 [ i ] = b;
+            BOOST_CHECK ( ba::mismatch ( v1.begin (), v1.end (), v2.begin (), v2.end ()).first == v1.begin () + i );
+            BOOST_CHECK ( ba::mismatch ( v2.begin (), v2.end (), v1.begin (), v1.end (), std::equal_to<T> ()).second
+                          == v1.begin () + i );
+        //  A second difference later on doesn't matter
+            v1 [ n - 1 ] = b;
+            BOOST_CHECK ( ba::mismatch ( v1.begin (), v1.end (), v2.begin (), v2.end ()).first == v1.begin () + i );
+        //  Sequences of different lengths
+            BOOST_CHECK ( ba::mismatch ( v1.begin () + i + 1, v1.end (), v2.begin () + i + 1, v2.end () - 1 ).first
+                          == ( i + 1 == n ? v1.end () : v1.end () - 1 ));
+            v1 [ i ] = v1 [ n - 1 ] = a;
+            }
+        }
+    }
+
+void test_bytewise_mismatch ()
+{
+    test_bytewise<char> ( 'a', 'b' );
+    test_bytewise<unsigned short> ( 0x1234, 0x1334 );
+    test_bytewise<int> ( -1, 0x7FFFFFFF );
+    test_bytewise<long long> ( 1LL << 40, 1 );
+    test_bytewise<colour> ( green, blue );
+    int x [ 2 ];
+    test_bytewise<int *> ( x, x + 1 );
+
+    const std::string s1 ( "the same string" ), s2 ( "the same strinG" );
+    BOOST_CHECK ( ba::mismatch ( s1.begin (), s1.end (), s2.begin (), s2.end ()).first == s1.begin () + 14 );
+
+//  Floating point values are compared with ==, not by their bytes
+    const double zeros [] = { 0.0, -0.0 };
+    const double nans [] = { 0.0, std::numeric_limits<double>::quiet_NaN () };
+    BOOST_CHECK ( ba::mismatch ( zeros, zeros + 1, zeros + 1, zeros + 2 ).first == zeros + 1 );
+    BOOST_CHECK ( ba::mismatch ( nans, nans + 2, nans, nans + 2 ).first == nans + 1 );
+
+//  A predicate other than std::equal_to is used as given
+    const int ints [] = { 1, 2, 3, 4 };
+    BOOST_CHECK ( ba::mismatch ( ints, ints + 4, ints, ints + 4, never_eq<int> ).first == ints );
+}
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_mismatch ();
+  test_bytewise_mismatch ();
 }
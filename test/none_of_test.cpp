@@ -8,6 +8,7 @@
 */
 
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/algorithm/cxx11/none_of.hpp>
 
 #define BOOST_TEST_MAIN
@@ -99,7 +100,20 @@ void test_none()
     BOOST_CHECK ( constexpr_res );
 }
 
+//  Arrays of numbers take the word at a time search, which is tested on
+//  its own in count_up_to_test.cpp
+void test_numbers ()
+{
+    BOOST_STATIC_ASSERT (( ba::detail::is_value_searchable<std::vector<unsigned char>::iterator, int>::type::value ));
+    std::vector<unsigned char> v ( 100, 0xFF );
+    BOOST_CHECK ( ba::none_of_equal ( v.begin (), v.end (), 0x1FF ));
+    v [ 64 ] = 0;
+    BOOST_CHECK ( !ba::none_of_equal ( v, 0 ));
+}
+
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_none();
+  test_numbers ();
 }
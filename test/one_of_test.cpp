@@ -8,6 +8,7 @@
 */
 
 #include <boost/config.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/algorithm/cxx11/one_of.hpp>
 
 #define BOOST_TEST_MAIN
@@ -100,8 +101,21 @@ void test_one ()
     BOOST_CHECK ( constexpr_res );
 }
 
+//  Arrays of numbers take the word at a time search, which is tested on
+//  its own in count_up_to_test.cpp
+void test_numbers ()
+{
+    BOOST_STATIC_ASSERT (( ba::detail::is_value_searchable<std::vector<long long>::iterator, long long>::type::value ));
+    std::vector<long long> v ( 100, 0 );
+    v [ 50 ] = 1LL << 40;
+    BOOST_CHECK ( ba::one_of_equal ( v.begin (), v.end (), 1LL << 40 ));
+    v [ 99 ] = 1LL << 40;
+    BOOST_CHECK ( !ba::one_of_equal ( v, 1LL << 40 ));
+}
+
 
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_one ();
+  test_numbers ();
 }
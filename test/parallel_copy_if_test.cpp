@@ -0,0 +1,191 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the execution policy versions of copy_if and partition_copy
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/copy_if.hpp>
+#include <boost/algorithm/cxx11/partition_copy.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//  Picks the elements that are not zero
+struct nonzero {
+    bool operator () ( unsigned v ) const { return v != 0; }
+    };
+
+//  Records how often it is applied to each element of an array; the
+//  threads work on different elements.
+struct counted_nonzero {
+    counted_nonzero ( const unsigned *base, std::vector<unsigned char> &calls )
+        : base_ ( base ), calls_ ( &calls ) {}
+    bool operator () ( const unsigned &v ) const { ++(*calls_) [ &v - base_ ]; return v != 0; }
+private:
+    const unsigned *base_;
+    std::vector<unsigned char> *calls_;
+    };
+
+struct odd_or_throw {
+    odd_or_throw ( unsigned bad ) : bad_ ( bad ) {}
+    bool operator () ( unsigned v ) const {
+        if ( v == bad_ ) throw std::runtime_error ( "bad" );
+        return v % 2 != 0;
+        }
+private:
+    unsigned bad_;
+    };
+
+bool long_string ( const std::string &s ) { return s.size () > 3; }
+
+//  Element i is i + 1 if it is to be picked, and 0 if not; each chunk's
+//  elements must land after those of the chunks before it
+void check_picked ( const std::vector<unsigned> &v ) {
+    std::vector<unsigned> expected;
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        if ( v [ i ] != 0 )
+            expected.push_back ( v [ i ] );
+    const std::size_t zeros = v.size () - expected.size ();
+
+    for ( std::size_t threads = 2; threads <= 8; threads *= 2 ) {
+        std::vector<unsigned> out ( expected.size ());
+        BOOST_CHECK ( ba::copy_if ( ex::par ( threads ), v.begin (), v.end (), out.begin (), nonzero ()) == out.end ());
+        BOOST_CHECK ( out == expected );
+
+        std::vector<unsigned> out_true ( expected.size ()), out_false ( zeros, 1 );
+        std::pair<std::vector<unsigned>::iterator, unsigned *> res =
+            ba::partition_copy ( ex::par ( threads ), v.begin (), v.end (), out_true.begin (),
+                                 out_false.empty () ? NULL : &out_false [ 0 ], nonzero ());
+        BOOST_CHECK ( res.first == out_true.end ());
+        BOOST_CHECK ( res.second == ( out_false.empty () ? NULL : &out_false [ 0 ] + zeros ));
+        BOOST_CHECK ( out_true == expected );
+        BOOST_CHECK ( std::count ( out_false.begin (), out_false.end (), 0u ) == static_cast<std::ptrdiff_t> ( zeros ));
+        }
+    }
+
+//  Chunks with nothing picked, or everything, next to ones with some
+void test_chunks () {
+    const std::size_t n = 4 * ( 1 << 15 ) + 5;
+    std::vector<unsigned> v ( n );
+    check_picked ( v );
+
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = static_cast<unsigned> ( i + 1 );
+    check_picked ( v );
+
+//  Only at the start, only at the end, and only one element
+    std::vector<unsigned> w ( n );
+    for ( std::size_t i = 0; i < 100; ++i )
+        w [ i ] = static_cast<unsigned> ( i + 1 );
+    check_picked ( w );
+    std::fill ( w.begin (), w.end (), 0u );
+    for ( std::size_t i = n - 100; i < n; ++i )
+        w [ i ] = static_cast<unsigned> ( i + 1 );
+    check_picked ( w );
+    std::fill ( w.begin (), w.end (), 0u );
+    w [ n / 2 ] = 42;
+    check_picked ( w );
+
+//  Every third element, so that each chunk picks a different number
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = i % 3 == 0 ? static_cast<unsigned> ( i + 1 ) : 0u;
+    check_picked ( v );
+    }
+
+//  Each element is tested once, and the sequential versions agree
+void test_calls () {
+    std::vector<unsigned> v ( 200000 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = static_cast<unsigned> ( i % 7 );
+    std::vector<unsigned char> calls ( v.size ());
+    std::vector<unsigned> out ( v.size ());
+    ba::copy_if ( ex::par ( 4 ), &v [ 0 ], &v [ 0 ] + v.size (), out.begin (), counted_nonzero ( &v [ 0 ], calls ));
+    BOOST_CHECK ( std::count ( calls.begin (), calls.end (), 1 ) == static_cast<std::ptrdiff_t> ( v.size ()));
+    std::vector<unsigned char> calls2 ( v.size ());
+    std::vector<unsigned> out2 ( v.size ());
+    ba::partition_copy ( ex::par ( 4 ), &v [ 0 ], &v [ 0 ] + v.size (), out.begin (), out2.begin (),
+                         counted_nonzero ( &v [ 0 ], calls2 ));
+    BOOST_CHECK ( calls2 == calls );
+
+    std::vector<unsigned> seq ( v.size ());
+    ba::copy_if ( ex::seq, v.begin (), v.end (), seq.begin (), nonzero ());
+    ba::copy_if ( ex::par, v.begin (), v.end (), out.begin (), nonzero ());
+    BOOST_CHECK ( seq == out );
+    }
+
+void test_iterators () {
+    std::vector<unsigned> v ( 100000 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = static_cast<unsigned> ( i % 5 );
+    std::vector<unsigned> expected;
+    ba::copy_if ( v, std::back_inserter ( expected ), nonzero ());
+
+//  Random access, but not contiguous
+    std::deque<unsigned> d ( v.begin (), v.end ());
+    std::deque<unsigned> out ( expected.size ());
+    BOOST_CHECK ( ba::copy_if ( ex::par ( 4 ), d.begin (), d.end (), out.begin (), nonzero ()) == out.end ());
+    BOOST_CHECK ( std::equal ( out.begin (), out.end (), expected.begin ()));
+
+//  Output that is not random access, and input that is not either
+    std::vector<unsigned> out2;
+    ba::copy_if ( ex::par, v.begin (), v.end (), std::back_inserter ( out2 ), nonzero ());
+    BOOST_CHECK ( out2 == expected );
+    std::list<unsigned> l ( v.begin (), v.end ());
+    std::vector<unsigned> out3 ( expected.size ());
+    BOOST_CHECK ( ba::copy_if ( ex::par, l.begin (), l.end (), out3.begin (), nonzero ()) == out3.end ());
+    BOOST_CHECK ( out3 == expected );
+    std::list<unsigned> lt, lf;
+    ba::partition_copy ( ex::par, l.begin (), l.end (), std::back_inserter ( lt ), std::back_inserter ( lf ), nonzero ());
+    BOOST_CHECK ( lt.size () == expected.size () && lt.size () + lf.size () == v.size ());
+
+//  Elements that are not numbers
+    std::vector<std::string> words;
+    for ( std::size_t i = 0; i < 100000; ++i )
+        words.push_back ( std::string ( i % 7, 'a' + static_cast<char> ( i % 26 )));
+    std::vector<std::string> long_words, short_words;
+    ba::partition_copy ( words.begin (), words.end (), std::back_inserter ( long_words ),
+                         std::back_inserter ( short_words ), long_string );
+    std::vector<std::string> par_long ( long_words.size ()), par_short ( short_words.size ());
+    ba::partition_copy ( ex::par ( 4 ), words.begin (), words.end (), par_long.begin (), par_short.begin (), long_string );
+    BOOST_CHECK ( par_long == long_words );
+    BOOST_CHECK ( par_short == short_words );
+    }
+
+void test_exceptions () {
+    std::vector<unsigned> v ( 200000 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = static_cast<unsigned> ( i );
+    std::vector<unsigned> out ( v.size ());
+    BOOST_CHECK_THROW ( ba::copy_if ( ex::par ( 4 ), v.begin (), v.end (), out.begin (), odd_or_throw ( 150000 )),
+                        std::runtime_error );
+    BOOST_CHECK_THROW ( ba::partition_copy ( ex::par ( 4 ), v.begin (), v.end (), out.begin (), out.begin (), odd_or_throw ( 7 )),
+                        std::runtime_error );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_chunks ();
+    test_calls ();
+    test_iterators ();
+    test_exceptions ();
+}
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the execution policy versions of iota
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/iota.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//  What adding step n - 1 times gives, which the terms computed directly
+//  must match exactly
+template <typename V, typename T>
+std::vector<V> counted ( std::size_t n, T value, T step ) {
+    std::vector<V> v;
+    for ( ; v.size () < n; value += step )
+        v.push_back ( value );
+    return v;
+    }
+
+//  Each chunk starts from a term computed from its offset, and the terms
+//  within a chunk are written 1024 at a time
+void test_chunks () {
+    const std::size_t grain = 1 << 16;
+    const std::size_t sizes [] = { 2 * grain - 1, 2 * grain, 3 * grain + 1025, 8 * grain + 3 };
+    for ( std::size_t s = 0; s < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++s ) {
+        const std::size_t n = sizes [ s ];
+        const std::vector<int> up = counted<int> ( n, -1000, 1 ), down = counted<int> ( n, 5000, -3 );
+        for ( std::size_t threads = 2; threads <= 8; threads += 3 ) {
+            std::vector<int> v ( n );
+            ba::iota ( ex::par ( threads ), v.begin (), v.end (), -1000 );
+            BOOST_CHECK ( v == up );
+            ba::iota ( ex::par ( threads ), v.begin (), v.end (), 5000, -3 );
+            BOOST_CHECK ( v == down );
+            }
+        }
+    }
+
+//  Integers wrap around as repeated increments do, including the ones
+//  narrower than int
+void test_wrap_around () {
+    const std::size_t n = 300000;
+    std::vector<unsigned> u ( n );
+    ba::iota ( ex::par ( 4 ), u.begin (), u.end (), UINT_MAX - 1000u );
+    BOOST_CHECK ( u == counted<unsigned> ( n, UINT_MAX - 1000u, 1u ));
+
+    std::vector<unsigned char> c ( n );
+    ba::iota ( ex::par ( 4 ), c.begin (), c.end (), static_cast<unsigned char> ( 200 ));
+    BOOST_CHECK ( c == counted<unsigned char> ( n, static_cast<unsigned char> ( 200 ), static_cast<unsigned char> ( 1 )));
+
+    std::vector<long long> l ( n );
+    ba::iota ( ex::par ( 3 ), l.begin (), l.end (), -5LL, 1LL << 33 );
+    BOOST_CHECK ( l == counted<long long> ( n, -5LL, 1LL << 33 ));
+    }
+
+//  Floating point terms are computed directly only while they are whole
+//  numbers small enough to be exact; otherwise repeated additions round,
+//  and the elements are counted one at a time
+void test_floating_point () {
+    const std::size_t n = 300000;
+    std::vector<double> d ( n );
+    ba::iota ( ex::par ( 4 ), d.begin (), d.end (), -1000.0 );
+    BOOST_CHECK ( d == counted<double> ( n, -1000.0, 1.0 ));
+    ba::iota ( ex::par ( 4 ), d.begin (), d.end (), 0.5, 0.25 );
+    BOOST_CHECK ( d == counted<double> ( n, 0.5, 0.25 ));
+    ba::iota ( ex::par ( 4 ), d.begin (), d.end (), 0.1, 0.1 );
+    BOOST_CHECK ( d == counted<double> ( n, 0.1, 0.1 ));
+
+//  Past 2^24 a float can't hold every whole number
+    std::vector<float> f ( n );
+    ba::iota ( ex::par ( 4 ), f.begin (), f.end (), 16777000.0f );
+    BOOST_CHECK ( f == counted<float> ( n, 16777000.0f, 1.0f ));
+    ba::iota ( f.begin (), f.end (), 16777000.0f, 1.0f );
+    BOOST_CHECK ( f == counted<float> ( n, 16777000.0f, 1.0f ));
+
+//  int values stored as doubles
+    ba::iota ( ex::par ( 4 ), d.begin (), d.end (), 3, 2 );
+    BOOST_CHECK ( d == counted<double> ( n, 3, 2 ));
+    }
+
+//  Sequences that aren't contiguous, or aren't random access
+void test_containers () {
+    const std::size_t n = 200000;
+    const std::vector<int> expected = counted<int> ( n, 17, 1 );
+    std::deque<int> d ( n );
+    ba::iota ( ex::par ( 4 ), d.begin (), d.end (), 17 );
+    BOOST_CHECK ( std::equal ( d.begin (), d.end (), expected.begin ()));
+    std::list<int> l ( n );
+    ba::iota ( ex::par ( 4 ), l.begin (), l.end (), 17 );
+    BOOST_CHECK ( std::equal ( l.begin (), l.end (), expected.begin ()));
+    }
+
+//  Values that aren't numbers are filled one at a time
+void test_iterators () {
+    std::vector<int> v ( 100000 );
+    std::vector<std::vector<int>::iterator> its ( v.size ());
+    ba::iota ( ex::par ( 4 ), its.begin (), its.end (), v.begin ());
+    bool ok = true;
+    for ( std::size_t i = 0; i < its.size (); ++i )
+        ok = ok && its [ i ] == v.begin () + i;
+    BOOST_CHECK ( ok );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_chunks ();
+    test_wrap_around ();
+    test_floating_point ();
+    test_containers ();
+    test_iterators ();
+}
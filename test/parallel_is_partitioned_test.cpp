@@ -0,0 +1,156 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the execution policy versions of is_partitioned and is_partitioned_until
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <deque>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/is_partitioned.hpp>
+#include <boost/algorithm/is_partitioned_until.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+bool negative ( int v ) { return v < 0; }
+
+struct negative_or_throw {
+    negative_or_throw ( int bad ) : bad_ ( bad ) {}
+    bool operator () ( int v ) const {
+        if ( v == bad_ ) throw std::runtime_error ( "bad" );
+        return v < 0;
+        }
+private:
+    int bad_;
+    };
+
+bool is_short ( const std::string &s ) { return s.size () < 3; }
+
+//  The reference: the first element that is negative after one that is not
+std::size_t reference_until ( const std::vector<int> &v ) {
+    std::size_t i = 0;
+    while ( i < v.size () && v [ i ] < 0 )
+        ++i;
+    while ( i < v.size () && v [ i ] >= 0 )
+        ++i;
+    return i;
+    }
+
+//  Arrays of ints are tested 64 at a time; put the partition point, and an
+//  element out of place after it, at every position of the first few blocks
+void test_blocks () {
+    for ( std::size_t n = 0; n <= 200; n += 67 )
+        for ( std::size_t point = 0; point <= n; ++point ) {
+            std::vector<int> v ( n, 1 );
+            std::fill ( v.begin (), v.begin () + point, -1 );
+            BOOST_CHECK ( ba::is_partitioned_until ( v.begin (), v.end (), negative ) == v.end ());
+            for ( std::size_t bad = point + 1; bad < n; ++bad ) {
+                v [ bad ] = -2;
+                BOOST_CHECK ( static_cast<std::size_t> ( ba::is_partitioned_until ( v.begin (), v.end (), negative ) - v.begin ()) == bad );
+                BOOST_CHECK ( !ba::is_partitioned ( &v [ 0 ], &v [ 0 ] + n, negative ));
+                v [ bad ] = 1;
+                }
+            }
+    }
+
+//  The chunks are combined in order: a chunk that starts with a negative
+//  element after one with a non-negative element is out of place at its
+//  start, and otherwise the first chunk that is not partitioned decides
+void test_chunks () {
+    const std::size_t n = 300001;
+    for ( std::size_t chunks = 2; chunks <= 8; chunks += 3 ) {
+        std::vector<int> v ( n, 1 );
+        for ( std::size_t c = 1; c < chunks; ++c ) {
+            const std::size_t boundary = ba::detail::chunk_offset ( c, chunks, n );
+
+        //  The partition point on a boundary, and either side of it
+            for ( std::size_t point = boundary - 1; point <= boundary + 1; ++point ) {
+                std::fill ( v.begin (), v.begin () + point, -1 );
+                std::fill ( v.begin () + point, v.end (), 1 );
+                BOOST_CHECK ( ba::is_partitioned ( ex::par ( chunks ), v.begin (), v.end (), negative ));
+                }
+
+        //  Out of place just at the start of a chunk, and just before it
+            std::fill ( v.begin (), v.end (), 1 );
+            v [ 0 ] = -1;
+            v [ boundary ] = -1;
+            BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( chunks ), v.begin (), v.end (), negative ) - v.begin ()
+                          == static_cast<std::ptrdiff_t> ( reference_until ( v )));
+            v [ boundary ] = 1;
+            v [ boundary - 1 ] = -1;
+            BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( chunks ), v.begin (), v.end (), negative ) - v.begin ()
+                          == static_cast<std::ptrdiff_t> ( reference_until ( v )));
+            v [ boundary - 1 ] = 1;
+            }
+
+    //  A chunk that is entirely non-negative before one that is entirely
+    //  negative, and the first of several elements out of place
+        std::fill ( v.begin (), v.end (), 1 );
+        const std::size_t second = ba::detail::chunk_offset ( 1, chunks, n );
+        std::fill ( v.begin () + second, v.begin () + ba::detail::chunk_offset ( 2, chunks, n ), -1 );
+        BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( chunks ), v.begin (), v.end (), negative ) == v.begin () + second );
+        std::fill ( v.begin (), v.end (), 1 );
+        v [ n - 1 ] = -1;
+        v [ n / 2 ] = -1;
+        BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( chunks ), v.begin (), v.end (), negative ) == v.begin () + n / 2 );
+        BOOST_CHECK ( ba::is_partitioned_until ( ex::seq, v.begin (), v.end (), negative ) == v.begin () + n / 2 );
+        }
+    }
+
+//  Iterators that are not contiguous, or not random access
+void test_iterators () {
+    std::vector<int> v ( 100000, 1 );
+    std::fill ( v.begin (), v.begin () + 40000, -1 );
+    v [ 70000 ] = -1;
+    const std::deque<int> d ( v.begin (), v.end ());
+    BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( 4 ), d.begin (), d.end (), negative ) == d.begin () + 70000 );
+    const std::list<int> l ( v.begin (), v.end ());
+    BOOST_CHECK ( std::distance ( l.begin (), ba::is_partitioned_until ( ex::par ( 4 ), l.begin (), l.end (), negative )) == 70000 );
+    BOOST_CHECK ( !ba::is_partitioned ( ex::par, l.begin (), l.end (), negative ));
+    }
+
+void test_other_types () {
+    std::vector<std::string> words;
+    for ( std::size_t i = 0; i < 100000; ++i )
+        words.push_back ( std::string ( i < 60000 ? 1 : 5, 'a' ));
+    BOOST_CHECK ( ba::is_partitioned ( ex::par ( 4 ), words.begin (), words.end (), is_short ));
+    words [ 99999 ] = "b";
+    BOOST_CHECK ( ba::is_partitioned_until ( ex::par ( 4 ), words.begin (), words.end (), is_short ) == words.begin () + 99999 );
+    BOOST_CHECK ( !ba::is_partitioned ( ex::par ( 4 ), words.begin (), words.end (), is_short ));
+    }
+
+void test_exceptions () {
+    std::vector<int> v ( 200000 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = static_cast<int> ( i );
+    BOOST_CHECK_THROW ( ba::is_partitioned_until ( ex::par ( 4 ), v.begin (), v.end (), negative_or_throw ( 150000 )),
+                        std::runtime_error );
+    BOOST_CHECK_THROW ( ba::is_partitioned ( ex::par ( 4 ), v.begin (), v.end (), negative_or_throw ( 7 )),
+                        std::runtime_error );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_blocks ();
+    test_chunks ();
+    test_iterators ();
+    test_other_types ();
+    test_exceptions ();
+}
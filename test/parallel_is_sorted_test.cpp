@@ -0,0 +1,173 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the block-wise and the execution policy versions of is_sorted_until,
+is_sorted and the is_increasing family
+*/
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//  The reference: compare each element with the one before it
+template <typename Iterator, typename Pred>
+Iterator reference_sorted_until ( Iterator first, Iterator last, Pred p ) {
+    if ( first == last )
+        return last;
+    for ( Iterator next = first; ++next != last; first = next )
+        if ( p ( *next, *first ))
+            return next;
+    return last;
+    }
+
+//  The block-wise versions: through pointers, vector iterators and ranges
+template <typename T, typename Pred>
+void check_blocks ( const std::vector<T> &v, Pred p ) {
+    const T *first = v.empty () ? 0 : &v [ 0 ];
+    const T *last = first + v.size ();
+    const T *expected = reference_sorted_until ( first, last, p );
+
+    BOOST_CHECK ( ba::is_sorted_until ( first, last, p ) == expected );
+    BOOST_CHECK ( ba::is_sorted_until ( v.begin (), v.end (), p ) - v.begin () == expected - first );
+    BOOST_CHECK ( ba::is_sorted_until ( v, p ) - v.begin () == expected - first );
+    BOOST_CHECK ( ba::is_sorted ( first, last, p ) == ( expected == last ));
+    }
+
+//  Every length up to a few blocks (of 256 bytes), increasing, with one
+//  element out of order at each position
+template <typename T>
+void test_blocks ( std::size_t step ) {
+    for ( std::size_t n = 0; n < 1100; n += step ) {
+        std::vector<T> v ( n );
+        for ( std::size_t i = 0; i < n; ++i )
+            v [ i ] = static_cast<T> ( i / 3 );
+        check_blocks ( v, std::less<T> ());
+        check_blocks ( v, std::less_equal<T> ());
+        check_blocks ( v, std::greater<T> ());
+        for ( std::size_t i = 0; i < n; i += step ) {
+            const T saved = v [ i ];
+            v [ i ] = static_cast<T> ( i == 0 ? 1 : 0 );
+            check_blocks ( v, std::less<T> ());
+            check_blocks ( v, std::less_equal<T> ());
+            v [ i ] = saved;
+            }
+        }
+    }
+
+void test_numbers () {
+    test_blocks<char> ( 7 );            //  wraps around, so is out of order early
+    test_blocks<boost::uint8_t> ( 5 );
+    test_blocks<short> ( 5 );
+    test_blocks<boost::uint16_t> ( 11 );
+    test_blocks<int> ( 3 );
+    test_blocks<unsigned> ( 13 );
+    test_blocks<long long> ( 7 );
+    test_blocks<float> ( 5 );
+    test_blocks<double> ( 7 );
+    test_blocks<long double> ( 17 );    //  not block-wise
+
+//  NaN is unordered with everything, so a NaN never stops the search
+    const double nan = std::numeric_limits<double>::quiet_NaN ();
+    std::vector<double> d ( 1000 );
+    for ( std::size_t i = 0; i < d.size (); ++i )
+        d [ i ] = static_cast<double> ( i );
+    d [ 500 ] = nan;
+    check_blocks ( d, std::less<double> ());
+    d [ 700 ] = 1.0;
+    check_blocks ( d, std::less<double> ());
+    BOOST_CHECK ( ba::is_sorted_until ( d.begin (), d.end ()) == d.begin () + 700 );
+
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+    check_blocks ( d, std::less<> ());
+    check_blocks ( d, std::greater_equal<> ());
+#endif
+    }
+
+void test_policies () {
+    std::vector<int> v ( 1000000 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = static_cast<int> ( i );
+
+    BOOST_CHECK (  ba::is_sorted ( ex::par, v.begin (), v.end ()));
+    BOOST_CHECK (  ba::is_increasing ( ex::par, v.begin (), v.end ()));
+    BOOST_CHECK (  ba::is_strictly_increasing ( ex::par ( 8 ), v.begin (), v.end ()));
+    BOOST_CHECK ( !ba::is_decreasing ( ex::par, v.begin (), v.end ()));
+    BOOST_CHECK ( !ba::is_strictly_decreasing ( ex::seq, v.begin (), v.end ()));
+    BOOST_CHECK (  ba::is_sorted_until ( ex::par, v.begin (), v.end ()) == v.end ());
+
+//  Out of order at the boundaries of the chunks, and next to them
+    for ( std::size_t chunks = 2; chunks <= 8; ++chunks )
+        for ( std::size_t i = 1; i < chunks; ++i ) {
+            const std::size_t boundary = ba::detail::chunk_offset ( i, chunks, v.size () - 1 );
+            for ( std::size_t k = boundary - 1; k <= boundary + 1; ++k ) {
+                const int saved = v [ k ];
+                v [ k ] = -1;
+                BOOST_CHECK ( ba::is_sorted_until ( ex::par ( chunks ), v.begin (), v.end ()) == v.begin () + k );
+                BOOST_CHECK ( !ba::is_increasing ( ex::par ( chunks ), v.begin (), v.end ()));
+                v [ k ] = saved;
+                }
+            }
+
+//  A NaN at a boundary is unordered with its neighbours in both chunks,
+//  and the search goes on past it
+    std::vector<double> d ( v.begin (), v.end ());
+    const std::size_t boundary = ba::detail::chunk_offset ( 1, 4, d.size () - 1 );
+    d [ boundary ] = std::numeric_limits<double>::quiet_NaN ();
+    BOOST_CHECK ( ba::is_sorted ( ex::par ( 4 ), d.begin (), d.end ()));
+    d [ boundary + 2 ] = 0.0;
+    BOOST_CHECK ( ba::is_sorted_until ( ex::par ( 4 ), d.begin (), d.end ()) == d.begin () + boundary + 2 );
+    BOOST_CHECK ( ba::is_sorted_until ( ex::seq, d.begin (), d.end ()) == d.begin () + boundary + 2 );
+
+//  The first of several pairs out of order wins
+    v [ 900000 ] = 0;
+    v [ 300000 ] = 0;
+    BOOST_CHECK ( ba::is_sorted_until ( ex::par ( 4 ), v.begin (), v.end ()) == v.begin () + 300000 );
+    v [ 300000 ] = 300000;
+    v [ 900000 ] = 900000;
+
+//  Equal neighbours
+    v [ 500001 ] = v [ 500000 ];
+    BOOST_CHECK (  ba::is_increasing ( ex::par, v.begin (), v.end ()));
+    BOOST_CHECK ( !ba::is_strictly_increasing ( ex::par, v.begin (), v.end ()));
+    BOOST_CHECK ( ba::is_sorted_until ( ex::par ( 2 ), v.begin (), v.end (), std::less_equal<int> ()) == v.begin () + 500001 );
+
+//  Forward iterators, and predicates that are not the standard orderings
+    std::list<std::string> words;
+    words.push_back ( "apple" );
+    words.push_back ( "banana" );
+    words.push_back ( "cherry" );
+    BOOST_CHECK (  ba::is_sorted ( ex::par, words.begin (), words.end ()));
+    BOOST_CHECK ( !ba::is_decreasing ( ex::par, words.begin (), words.end ()));
+    words.push_back ( "apricot" );
+    BOOST_CHECK ( ba::is_sorted_until ( ex::par ( 2 ), words.begin (), words.end ()) == --words.end ());
+
+//  Tiny ranges
+    BOOST_CHECK ( ba::is_sorted ( ex::par, v.begin (), v.begin ()));
+    BOOST_CHECK ( ba::is_sorted ( ex::par, v.begin (), v.begin () + 1 ));
+    BOOST_CHECK ( ba::is_sorted_until ( ex::par ( 16 ), v.begin (), v.begin () + 2 ) == v.begin () + 2 );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_numbers ();
+    test_policies ();
+}
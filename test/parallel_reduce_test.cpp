@@ -0,0 +1,152 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the unrolled and the execution policy versions of reduce and transform_reduce
+*/
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx17/reduce.hpp>
+#include <boost/algorithm/cxx17/transform_reduce.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//  Associative, but not commutative: the first value that isn't zero
+struct first_nonzero {
+    unsigned operator () ( unsigned a, unsigned b ) const { return a != 0 ? a : b; }
+    };
+
+struct twice {
+    unsigned operator () ( unsigned v ) const { return v * 2; }
+    };
+
+bool close ( double a, double b ) {
+    return std::fabs ( a - b ) <= 1e-9 * ( std::fabs ( a ) + std::fabs ( b ) + 1 );
+    }
+
+//  The four accumulators leave up to three elements over, and the blocks
+//  of 2^14 elements leave a short last block
+void test_lengths () {
+    const std::size_t block = 1 << 14;
+    const std::size_t sizes [] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, block - 1, block, block + 1, 5 * block + 3 };
+    for ( std::size_t s = 0; s < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++s ) {
+        std::vector<unsigned> v ( sizes [ s ] );
+        for ( std::size_t i = 0; i < v.size (); ++i )
+            v [ i ] = static_cast<unsigned> ( std::rand ());
+        unsigned sum = 3u, dot = 3u;
+        for ( std::size_t i = 0; i < v.size (); ++i ) {
+            sum += v [ i ];
+            dot += v [ i ] * v [ v.size () - 1 - i ];
+            }
+        const std::vector<unsigned> w ( v.rbegin (), v.rend ());
+
+        BOOST_CHECK ( ba::reduce ( v.begin (), v.end (), 3u ) == sum );
+        BOOST_CHECK ( ba::reduce ( ex::seq, v.begin (), v.end (), 3u ) == sum );
+        BOOST_CHECK ( ba::reduce ( ex::par ( 3 ), v.begin (), v.end (), 3u, std::plus<unsigned> ()) == sum );
+        BOOST_CHECK ( ba::reduce ( ex::par, v.begin (), v.end ()) == sum - 3u );
+        BOOST_CHECK ( ba::transform_reduce ( v.begin (), v.end (), w.begin (), 3u ) == dot );
+        BOOST_CHECK ( ba::transform_reduce ( ex::par ( 5 ), v.begin (), v.end (), w.begin (), 3u ) == dot );
+        BOOST_CHECK ( ba::transform_reduce ( ex::par, v.begin (), v.end (), 0u, std::plus<unsigned> (), twice ()) == 2 * ( sum - 3u ));
+        }
+    }
+
+//  Floating point sums are rounded differently by the accumulators, but
+//  the blocks make the result the same whatever the number of threads
+void test_floating_point () {
+    std::vector<double> v ( 300007 );
+    for ( std::size_t i = 0; i < v.size (); ++i )
+        v [ i ] = std::rand () / ( RAND_MAX + 1.0 ) - 0.25;
+
+    double sum = 0.5, dot = 0.0;
+    for ( std::size_t i = 0; i < v.size (); ++i ) {
+        sum += v [ i ];
+        dot += v [ i ] * v [ i ];
+        }
+    BOOST_CHECK ( close ( ba::reduce ( v.begin (), v.end (), 0.5 ), sum ));
+
+    const double seq = ba::reduce ( ex::seq, v.begin (), v.end (), 0.5 );
+    BOOST_CHECK ( close ( seq, sum ));
+    for ( std::size_t threads = 1; threads <= 8; ++threads )
+        BOOST_CHECK ( ba::reduce ( ex::par ( threads ), v.begin (), v.end (), 0.5 ) == seq );
+
+    const double pdot = ba::transform_reduce ( ex::seq, v.begin (), v.end (), v.begin (), 0.0 );
+    BOOST_CHECK ( close ( pdot, dot ));
+    BOOST_CHECK ( ba::transform_reduce ( ex::par ( 3 ), v.begin (), v.end (), v.begin (), 0.0 ) == pdot );
+    BOOST_CHECK ( ba::transform_reduce ( ex::par ( 6 ), v.begin (), v.end (), v.begin (), 0.0 ) == pdot );
+
+//  float data with a double accumulator
+    const std::vector<float> f ( v.begin (), v.end ());
+    BOOST_CHECK ( close ( ba::transform_reduce ( f.data (), f.data () + f.size (), f.data (), 0.0,
+                                                 std::plus<double> (), std::multiplies<double> ()),
+                          ba::transform_reduce ( ex::par, f.begin (), f.end (), f.begin (), 0.0,
+                                                 std::plus<double> (), std::multiplies<double> ())));
+    }
+
+//  Other operations keep the elements in order, so they need only be associative
+void test_order () {
+    const std::size_t n = 200000;
+    const std::size_t firsts [] = { 0, 1, ( 1 << 14 ) - 1, 1 << 14, n / 2, n - 1 };
+    for ( std::size_t i = 0; i < sizeof ( firsts ) / sizeof ( firsts [ 0 ] ); ++i ) {
+        std::vector<unsigned> v ( n );
+        v [ n - 1 ] = 9;
+        v [ firsts [ i ]] = 7;
+        BOOST_CHECK ( ba::reduce ( v.begin (), v.end (), 0u, first_nonzero ()) == 7 );
+        BOOST_CHECK ( ba::reduce ( ex::par ( 4 ), v.begin (), v.end (), 0u, first_nonzero ()) == 7 );
+        BOOST_CHECK ( ba::transform_reduce ( ex::par ( 3 ), v.begin (), v.end (), 0u, first_nonzero (), twice ()) == 14 );
+        BOOST_CHECK ( ba::reduce ( ex::par ( 4 ), v.begin (), v.end (), 5u, first_nonzero ()) == 5 );
+        }
+    }
+
+void test_non_random_access () {
+    std::list<unsigned> l;
+    for ( unsigned i = 0; i < 1000; ++i )
+        l.push_back ( i );
+    BOOST_CHECK ( ba::reduce ( l.begin (), l.end (), 0u ) == 499500u );
+    BOOST_CHECK ( ba::reduce ( ex::par, l.begin (), l.end (), 0u ) == 499500u );
+    BOOST_CHECK ( ba::transform_reduce ( ex::par, l.begin (), l.end (), l.begin (), 0u ) == 332833500u );
+    }
+
+//  Not associative, but within one block the elements are combined in order
+struct add_twice {
+    double operator () ( double a, double b ) const { return a + 2 * b; }
+    };
+
+struct halve {
+    double operator () ( double x ) const { return x / 2; }
+    };
+
+//  The operation is given the elements, not the elements converted to T
+void test_conversions () {
+    const std::vector<double> halves ( 1000, 0.5 ), ones ( 1000, 1.0 );
+    BOOST_CHECK_EQUAL ( ba::reduce ( halves.begin (), halves.end (), 7, add_twice ()), 1007 );
+    BOOST_CHECK_EQUAL ( ba::reduce ( ex::seq, halves.begin (), halves.end (), 7, add_twice ()), 1007 );
+    BOOST_CHECK_EQUAL ( ba::reduce ( ex::par ( 4 ), halves.begin (), halves.end (), 7, add_twice ()), 1007 );
+    BOOST_CHECK_EQUAL ( ba::transform_reduce ( ex::par, ones.begin (), ones.end (), 7, add_twice (), halve ()), 1007 );
+    BOOST_CHECK_EQUAL ( ba::transform_reduce ( ex::par, halves.begin (), halves.end (), ones.begin (), 7,
+                                               add_twice (), std::multiplies<double> ()), 1007 );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_lengths ();
+    test_floating_point ();
+    test_order ();
+    test_non_random_access ();
+    test_conversions ();
+}
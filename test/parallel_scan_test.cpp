@@ -0,0 +1,193 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the execution policy versions of the scans against the sequential ones
+*/
+
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/cxx17/inclusive_scan.hpp>
+#include <boost/algorithm/cxx17/exclusive_scan.hpp>
+#include <boost/algorithm/cxx17/transform_inclusive_scan.hpp>
+#include <boost/algorithm/cxx17/transform_exclusive_scan.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//  An associative operation that is not commutative: composition of the
+//  affine maps x -> a*x + b (modulo 2^32), so that combining the chunks in
+//  the wrong order, or an element twice, would show up.
+typedef std::pair<unsigned, unsigned> affine;
+
+struct compose {
+    affine operator () ( const affine &f, const affine &g ) const
+        { return affine ( g.first * f.first, g.first * f.second + g.second ); }
+    };
+
+struct make_affine {
+    affine operator () ( unsigned v ) const { return affine ( v | 1, v ); }
+    };
+
+//  A sum with no default value; the parallel versions must not need one
+struct total {
+    explicit total ( unsigned v ) : value ( v ) {}
+    bool operator == ( const total &t ) const { return value == t.value; }
+    unsigned value;
+    };
+
+struct add_total {
+    total operator () ( const total &a, const total &b ) const { return total ( a.value + b.value ); }
+    };
+
+struct make_total {
+    total operator () ( unsigned v ) const { return total ( v ); }
+    };
+
+std::vector<unsigned> random_input ( std::size_t n ) {
+    std::vector<unsigned> v ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v [ i ] = static_cast<unsigned> ( std::rand ());
+    return v;
+    }
+
+//  The sequence is split into chunks of at least 2^16 elements; try one
+//  chunk, a few chunks of uneven length, and more threads than chunks
+void test_chunks () {
+    const std::size_t grain = 1 << 16;
+    const std::size_t sizes [] = { 2 * grain - 1, 2 * grain, 3 * grain + 7, 5 * grain + 1 };
+    for ( std::size_t s = 0; s < sizeof ( sizes ) / sizeof ( sizes [ 0 ] ); ++s ) {
+        const std::vector<unsigned> v = random_input ( sizes [ s ] );
+        const std::size_t n = v.size ();
+        std::vector<affine> expected ( n ), actual ( n );
+
+        ba::transform_inclusive_scan ( v.begin (), v.end (), expected.begin (), compose (), make_affine (), affine ( 3, 4 ));
+        for ( std::size_t threads = 2; threads <= 8; threads += 3 ) {
+            ba::transform_inclusive_scan ( ex::par ( threads ), v.begin (), v.end (), actual.begin (),
+                                           compose (), make_affine (), affine ( 3, 4 ));
+            BOOST_CHECK ( actual == expected );
+            }
+
+        ba::transform_exclusive_scan ( v.begin (), v.end (), expected.begin (), affine ( 3, 4 ), compose (), make_affine ());
+        for ( std::size_t threads = 2; threads <= 8; threads += 3 ) {
+            ba::transform_exclusive_scan ( ex::par ( threads ), v.begin (), v.end (), actual.begin (),
+                                           affine ( 3, 4 ), compose (), make_affine ());
+            BOOST_CHECK ( actual == expected );
+            }
+        }
+    }
+
+//  Without an initial value, the first element starts the scan, and is
+//  combined with nothing before it
+void test_without_init () {
+    const std::vector<unsigned> v = random_input ( 300000 );
+    std::vector<unsigned> expected ( v.size ()), actual ( v.size (), 0xDEADBEEF );
+
+    ba::inclusive_scan ( v.begin (), v.end (), expected.begin ());
+    BOOST_CHECK ( ba::inclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin ()) == actual.end ());
+    BOOST_CHECK ( actual == expected );
+
+    ba::inclusive_scan ( v.begin (), v.end (), expected.begin (), std::multiplies<unsigned> ());
+    ba::inclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin (), std::multiplies<unsigned> ());
+    BOOST_CHECK ( actual == expected );
+
+    ba::transform_inclusive_scan ( v.begin (), v.end (), expected.begin (), std::multiplies<unsigned> (), std::negate<unsigned> ());
+    ba::transform_inclusive_scan ( ex::par ( 3 ), v.begin (), v.end (), actual.begin (), std::multiplies<unsigned> (), std::negate<unsigned> ());
+    BOOST_CHECK ( actual == expected );
+    BOOST_CHECK ( actual [ 0 ] == 0u - v [ 0 ] );
+
+//  And with nothing to scan, nothing is written
+    BOOST_CHECK ( ba::inclusive_scan ( ex::par, v.begin (), v.begin (), actual.begin ()) == actual.begin ());
+    }
+
+//  The exclusive scans start with the initial value, and never use the last element
+void test_exclusive () {
+    std::vector<unsigned> v = random_input ( 300000 );
+    std::vector<unsigned> expected ( v.size ()), actual ( v.size ());
+
+    ba::exclusive_scan ( v.begin (), v.end (), expected.begin (), 5u );
+    BOOST_CHECK ( ba::exclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin (), 5u ) == actual.end ());
+    BOOST_CHECK ( actual == expected );
+    BOOST_CHECK ( actual [ 0 ] == 5u );
+
+    v.back () += 12345u;
+    ba::exclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin (), 5u );
+    BOOST_CHECK ( actual == expected );
+
+    ba::transform_exclusive_scan ( v.begin (), v.end (), expected.begin (), 2u, std::plus<unsigned> (), std::negate<unsigned> ());
+    ba::transform_exclusive_scan ( ex::par ( 5 ), v.begin (), v.end (), actual.begin (), 2u, std::plus<unsigned> (), std::negate<unsigned> ());
+    BOOST_CHECK ( actual == expected );
+    }
+
+//  The output may be the input
+void test_in_place () {
+    const std::vector<unsigned> v = random_input ( 400000 );
+    std::vector<unsigned> expected ( v.size ());
+
+    std::vector<unsigned> actual ( v );
+    ba::inclusive_scan ( v.begin (), v.end (), expected.begin (), std::plus<unsigned> (), 17u );
+    ba::inclusive_scan ( ex::par ( 4 ), actual.begin (), actual.end (), actual.begin (), std::plus<unsigned> (), 17u );
+    BOOST_CHECK ( actual == expected );
+
+    actual = v;
+    ba::exclusive_scan ( v.begin (), v.end (), expected.begin (), 0u );
+    ba::exclusive_scan ( ex::par ( 4 ), actual.begin (), actual.end (), actual.begin (), 0u );
+    BOOST_CHECK ( actual == expected );
+    }
+
+//  The values of the chunks are computed into copies of the initial value
+void test_no_default_constructor () {
+    const std::vector<unsigned> v = random_input ( 300000 );
+    std::vector<total> expected, actual;
+    ba::transform_inclusive_scan ( v.begin (), v.end (), std::back_inserter ( expected ), add_total (), make_total (), total ( 1 ));
+    actual.assign ( v.size (), total ( 0 ));
+    ba::transform_inclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin (), add_total (), make_total (), total ( 1 ));
+    BOOST_CHECK ( actual == expected );
+
+    expected.clear ();
+    ba::transform_exclusive_scan ( v.begin (), v.end (), std::back_inserter ( expected ), total ( 1 ), add_total (), make_total ());
+    ba::transform_exclusive_scan ( ex::par ( 4 ), v.begin (), v.end (), actual.begin (), total ( 1 ), add_total (), make_total ());
+    BOOST_CHECK ( actual == expected );
+    }
+
+//  Iterators that are not random access are scanned in order
+void test_non_random_access () {
+    std::list<unsigned> l;
+    for ( unsigned i = 0; i < 1000; ++i )
+        l.push_back ( i );
+    std::vector<unsigned> expected, actual;
+    ba::inclusive_scan ( l.begin (), l.end (), std::back_inserter ( expected ));
+    ba::inclusive_scan ( ex::par, l.begin (), l.end (), std::back_inserter ( actual ));
+    BOOST_CHECK ( actual == expected );
+
+    const std::vector<unsigned> v = random_input ( 300000 );
+    expected.clear (); actual.clear ();
+    ba::exclusive_scan ( v.begin (), v.end (), std::back_inserter ( expected ), 3u );
+    ba::exclusive_scan ( ex::par, v.begin (), v.end (), std::back_inserter ( actual ), 3u );
+    BOOST_CHECK ( actual == expected );
+    }
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+    test_chunks ();
+    test_without_init ();
+    test_exclusive ();
+    test_in_place ();
+    test_no_default_constructor ();
+    test_non_random_access ();
+}
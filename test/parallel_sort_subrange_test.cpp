@@ -0,0 +1,168 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test the execution policy versions of sort_subrange and partition_subrange, and top_k_copy
+*/
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/execution.hpp>
+#include <boost/algorithm/sort_subrange.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <vector>
+
+namespace ba = boost::algorithm;
+namespace ex = boost::algorithm::execution;
+
+//	n values in [0, range): the indexes, scrambled by a hash that gives
+//	the same order on every platform
+std::vector<int> scattered ( std::size_t n, int range )
+{
+	std::vector<int> v(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		boost::uint32_t x = static_cast<boost::uint32_t>(i);
+		x = (x ^ (x >> 16)) * 0x85ebca6bu;
+		x = (x ^ (x >> 13)) * 0xc2b2ae35u;
+		v[i] = static_cast<int>((x ^ (x >> 16)) % static_cast<boost::uint32_t>(range));
+		}
+	return v;
+}
+
+//	Each of [0, sf), [sf, sl) and [sl, n) holds the same elements as in the
+//	sorted sequence
+template <typename T, typename Pred>
+bool same_pieces ( std::vector<T> a, const std::vector<T> &sorted, std::size_t sf, std::size_t sl, Pred p )
+{
+	std::sort(a.begin(), a.begin() + sf, p);
+	std::sort(a.begin() + sf, a.begin() + sl, p);
+	std::sort(a.begin() + sl, a.end(), p);
+	return a == sorted;
+}
+
+//	A value whose copies (and so moves) may throw, which the parallel
+//	versions don't move through a buffer.
+struct boxed {
+	boxed () : v(0) {}
+	boxed ( int i ) : v(i) {}
+	boxed ( const boxed &b ) : v(b.v) {}
+	boxed & operator = ( const boxed &b ) { v = b.v; return *this; }
+	bool operator < ( const boxed &b ) const { return v < b.v; }
+	bool operator == ( const boxed &b ) const { return v == b.v; }
+	int v;
+};
+
+template <typename T, typename Policy, typename Pred>
+void test_one ( const Policy &policy, const std::vector<T> &v, std::size_t sf, std::size_t sl, Pred p )
+{
+	std::vector<T> sorted(v);
+	std::sort(sorted.begin(), sorted.end(), p);
+
+	std::vector<T> a(v);
+	ba::sort_subrange(policy, a.begin(), a.end(), a.begin() + sf, a.begin() + sl, p);
+	BOOST_CHECK(std::equal(a.begin() + sf, a.begin() + sl, sorted.begin() + sf));
+	BOOST_CHECK(same_pieces(a, sorted, sf, sl, p));
+
+	a = v;
+	ba::partition_subrange(policy, a.begin(), a.end(), a.begin() + sf, a.begin() + sl, p);
+	BOOST_CHECK(same_pieces(a, sorted, sf, sl, p));
+	if (sf != 0 && sf != sl)	// the start of the range isn't selected
+		BOOST_CHECK(a[sf] == sorted[sf]);
+}
+
+void test_windows ( const std::vector<int> &v )
+{
+	const std::size_t n = v.size();
+	const std::size_t windows [][2] = {
+		{ 0, 0 }, { 0, 10 }, { n / 2, n / 2 + 10 }, { n - 10, n }, { n / 3, 2 * n / 3 },
+		{ 0, n }, { 1, n - 1 }, { n / 2, n / 2 + 1 }, { n / 10, n / 10 + n / 100 }
+		};
+	for (std::size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); ++i) {
+		const std::size_t sf = windows[i][0], sl = windows[i][1];
+		test_one(ex::seq,     v, sf, sl, std::less<int>());
+		test_one(ex::par,     v, sf, sl, std::less<int>());
+		test_one(ex::par(4),  v, sf, sl, std::less<int>());
+		test_one(ex::par(7),  v, sf, sl, std::greater<int>());
+		}
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_sort_subrange )
+{
+	const std::size_t n = 1 << 19;
+	test_windows(scattered(n, 1 << 30));
+	test_windows(scattered(n, 3));		// mostly equal elements
+
+	std::vector<int> v(n);
+	for (std::size_t i = 0; i < n; ++i)
+		v[i] = static_cast<int>(i);
+	test_windows(v);						// already sorted
+	std::reverse(v.begin(), v.end());
+	test_windows(v);
+
+//	Small ranges, and values that can't be moved without the chance of an exception
+	const std::vector<int> small = scattered(1000, 100);
+	test_one(ex::par(4), small, 100, 200, std::less<int>());
+	const std::vector<int> r = scattered(n, 1000);
+	const std::vector<boxed> b(r.begin(), r.end());
+	test_one(ex::par(4), b, n / 4, n / 4 + 100, std::less<boxed>());
+
+//	The versions without a predicate
+	std::vector<int> a(r);
+	ba::sort_subrange(ex::par(4), a.begin(), a.end(), a.begin() + 10, a.begin() + 20);
+	ba::partition_subrange(ex::par(4), a.begin(), a.end(), a.begin() + 30, a.begin() + 40);
+	std::vector<int> sorted(r);
+	std::sort(sorted.begin(), sorted.end());
+	BOOST_CHECK(std::equal(a.begin() + 10, a.begin() + 20, sorted.begin() + 10));
+	BOOST_CHECK(a[30] == sorted[30]);
+}
+
+template <typename Policy>
+void test_top_k ( const Policy &policy, const std::vector<int> &v, std::size_t k )
+{
+	std::vector<int> expected(k), out(k, -1);
+	const std::size_t m = std::partial_sort_copy(v.begin(), v.end(), expected.begin(), expected.end()) - expected.begin();
+	BOOST_CHECK(ba::top_k_copy(policy, v.begin(), v.end(), out.begin(), out.end()) == out.begin() + m);
+	BOOST_CHECK(std::equal(out.begin(), out.begin() + m, expected.begin()));
+
+	std::partial_sort_copy(v.begin(), v.end(), expected.begin(), expected.end(), std::greater<int>());
+	BOOST_CHECK(ba::top_k_copy(policy, v.begin(), v.end(), out.begin(), out.end(), std::greater<int>()) == out.begin() + m);
+	BOOST_CHECK(std::equal(out.begin(), out.begin() + m, expected.begin()));
+}
+
+BOOST_AUTO_TEST_CASE( test_top_k_copy )
+{
+	const std::vector<int> v = scattered(1 << 19, 1 << 30);
+	const std::vector<int> dups = scattered(1 << 19, 5);
+	const std::size_t ks [] = { 0, 1, 10, 1000, 100000, 1 << 20 };
+	for (std::size_t i = 0; i < sizeof(ks) / sizeof(ks[0]); ++i) {
+		test_top_k(ex::seq, v, ks[i]);
+		test_top_k(ex::par, v, ks[i]);
+		test_top_k(ex::par(4), v, ks[i]);
+		test_top_k(ex::par(4), dups, ks[i]);
+		}
+
+//	The input isn't changed
+	const std::vector<int> copy(v);
+	std::vector<int> out(100);
+	ba::top_k_copy(ex::par(3), v.begin(), v.end(), out.begin(), out.end());
+	BOOST_CHECK(v == copy);
+
+//	Input that isn't random access, and the sequential version
+	const std::list<int> l(v.begin(), v.begin() + 5000);
+	std::vector<int> expected(100);
+	std::partial_sort_copy(l.begin(), l.end(), expected.begin(), expected.end());
+	BOOST_CHECK(ba::top_k_copy(ex::par(4), l.begin(), l.end(), out.begin(), out.end()) == out.end());
+	BOOST_CHECK(out == expected);
+	BOOST_CHECK(ba::top_k_copy(l.begin(), l.end(), out.begin(), out.end()) == out.end());
+	BOOST_CHECK(out == expected);
+}
@@ -18,6 +18,7 @@
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/algorithm/cxx11/none_of.hpp>
 #include <string>
+#include <iterator>
 #include <vector>
 #include <list>
 
@@ -81,6 +82,100 @@ void test_sequence1 () {
 
     }
 
+
+//  Arrays of numbers are sorted into the outputs a block at a time. Check
+//  every length up to a few blocks, with the elements picked at random,
+//  against the element by element loop; the outputs are exactly as long as
+//  they need to be.
+template <typename T>
+void test_blocks ( unsigned percent ) {
+    unsigned seed = 54321;
+    for ( std::size_t n = 0; n < 1100; n += 1 + n / 8 ) {
+        std::vector<T> c ( n );
+        for ( std::size_t i = 0; i < n; ++i ) {
+            seed = seed * 1103515245u + 12345u;
+            c [ i ] = static_cast<T> (( seed >> 8 ) % 100 );
+            }
+
+        std::vector<T> expected_true, expected_false;
+        for ( std::size_t i = 0; i < n; ++i )
+            ( c [ i ] < static_cast<T> ( percent ) ? expected_true : expected_false ).push_back ( c [ i ] );
+        std::vector<T> out_true ( expected_true.size ()), out_false ( expected_false.size ());
+        const T *first = c.empty () ? NULL : &c [ 0 ];
+        std::pair<typename std::vector<T>::iterator, T *> res = ba::partition_copy (
+            first, first + n, out_true.begin (), out_false.empty () ? NULL : &out_false [ 0 ],
+            less_than<T> ( static_cast<T> ( percent )));
+        BOOST_CHECK ( res.first == out_true.end ());
+        BOOST_CHECK ( res.second == ( out_false.empty () ? NULL : &out_false [ 0 ] + out_false.size ()));
+        BOOST_CHECK ( out_true == expected_true );
+        BOOST_CHECK ( out_false == expected_false );
+        }
+    }
+
+void test_numbers () {
+    const unsigned percents [] = { 0, 1, 10, 50, 90, 99, 100 };
+    for ( std::size_t i = 0; i < sizeof ( percents ) / sizeof ( percents [ 0 ] ); ++i ) {
+        test_blocks<unsigned char> ( percents [ i ] );
+        test_blocks<int> ( percents [ i ] );
+        test_blocks<long long> ( percents [ i ] );
+        test_blocks<float> ( percents [ i ] );
+        }
+    }
+
+//  A predicate that throws part way through a block; the elements sorted
+//  before it are still written
+struct even_until {
+    explicit even_until ( int stop ) : stop_ ( stop ) {}
+    bool operator () ( int v ) const {
+        if ( v == stop_ )
+            throw v;
+        return v % 2 == 0;
+        }
+private:
+    int stop_;
+    };
+
+void test_throwing () {
+    std::vector<int> c ( 1000 );
+    for ( std::size_t i = 0; i < c.size (); ++i )
+        c [ i ] = static_cast<int> ( i );
+    const int stops [] = { 0, 1, 100, 255, 256, 601, 999 };
+    for ( std::size_t i = 0; i < sizeof ( stops ) / sizeof ( stops [ 0 ] ); ++i ) {
+        std::vector<int> evens, odds;
+        try {
+            ba::partition_copy ( c, std::back_inserter ( evens ), std::back_inserter ( odds ), even_until ( stops [ i ] ));
+            BOOST_CHECK ( false );
+            }
+        catch ( int stop ) {
+            BOOST_CHECK_EQUAL ( stop, stops [ i ] );
+            }
+        BOOST_CHECK_EQUAL ( evens.size (), static_cast<std::size_t> (( stops [ i ] + 1 ) / 2 ));
+        BOOST_CHECK_EQUAL ( odds.size (), static_cast<std::size_t> ( stops [ i ] / 2 ));
+        BOOST_CHECK ( ba::all_of ( evens.begin (), evens.end (), is_even ));
+        BOOST_CHECK ( ba::none_of ( odds.begin (), odds.end (), is_even ));
+        }
+    }
+
+//  A predicate may take the elements by non-const reference, and change them
+bool even_and_doubled ( int &v ) {
+    const bool even = v % 2 == 0;
+    v *= 2;
+    return even;
+    }
+
+void test_non_const_predicate () {
+    std::vector<int> v;
+    for ( int i = 0; i < 1000; ++i )
+        v.push_back ( i );
+    std::vector<int> evens, odds;
+    ba::partition_copy ( v.begin (), v.end (), std::back_inserter ( evens ), std::back_inserter ( odds ), even_and_doubled );
+    BOOST_CHECK_EQUAL ( evens.size (), 500u );
+    BOOST_CHECK_EQUAL ( odds.size (), 500u );
+    BOOST_CHECK ( !evens.empty () && evens.back () == 2 * 998 );
+    BOOST_CHECK ( !odds.empty () && odds.back () == 2 * 999 );
+    BOOST_CHECK ( v [ 7 ] == 14 );
+    }
+
     
 BOOST_CXX14_CONSTEXPR bool test_constexpr () {
     int in[] = {1, 1, 2};
@@ -105,6 +200,9 @@ BOOST_CXX14_CONSTEXPR bool test_constexpr () {
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_sequence1 ();
+  test_numbers ();
+  test_throwing ();
+  test_non_const_predicate ();
   BOOST_CXX14_CONSTEXPR bool constexpr_res = test_constexpr ();
   BOOST_CHECK ( constexpr_res );
 }
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <deque>
 
 namespace ba = boost::algorithm;
 // namespace ba = boost;
@@ -93,8 +94,42 @@ void test_sequence1 () {
 
     }
 
+//  Every partition point of sequences of every length up to 70, and a few
+//  longer ones, with random access iterators that are and aren't contiguous
+void test_random_access () {
+    for ( int n = 0; n <= 70; ++n ) {
+        std::vector<int> v;
+        for ( int i = 0; i < n; ++i )
+            v.push_back ( i );
+        std::deque<int> d ( v.begin (), v.end ());
+        for ( int pp = 0; pp <= n; ++pp ) {
+            BOOST_CHECK ( ba::partition_point ( v.begin (), v.end (), less_than<int>(pp)) == v.begin () + pp );
+            BOOST_CHECK ( ba::partition_point ( d.begin (), d.end (), less_than<int>(pp)) == d.begin () + pp );
+            if ( n != 0 ) {
+                const int *first = &v [ 0 ];
+                BOOST_CHECK ( ba::partition_point ( first, first + n, less_than<int>(pp)) == first + pp );
+                }
+            }
+        }
+
+    std::vector<long> big;
+    for ( long i = 0; i < 1000003; ++i )
+        big.push_back ( i / 3 );
+    const long limits [] = { -1, 0, 1, 77777, 333333, 333334, 400000 };
+    for ( std::size_t i = 0; i < sizeof ( limits ) / sizeof ( limits [ 0 ] ); ++i ) {
+        const long limit = limits [ i ];
+        const std::ptrdiff_t expected = limit <= 0 ? 0 : limit > 333334 ? 1000003 : 3 * limit;
+        BOOST_CHECK ( ba::partition_point ( big, less_than<long>(limit)) - big.begin () == expected );
+        }
+
+    std::string s ( 1000, 'a' );
+    s.append ( 500, 'b' );
+    BOOST_CHECK ( ba::partition_point ( s, less_than<char>('b')) == s.begin () + 1000 );
+    }
+
 
 BOOST_AUTO_TEST_CASE( test_main )
 {
   test_sequence1 ();
+  test_random_access ();
 }
@@ -7,6 +7,7 @@
     For more information, see http://www.boost.org
 */
 
+#include <cstdlib>
 #include <iostream>
 #include <functional>
 
@@ -75,10 +76,148 @@ void test_power_constexpr ()
     BOOST_CXX14_CONSTEXPR bool check_plus = 
         ba::power(3, 2, std::plus<int>()) == 6;
     BOOST_CHECK(check_plus);
+    BOOST_CXX14_CONSTEXPR bool check_unrolled = 
+        ba::power<10>(3) == 59049;
+    BOOST_CHECK(check_unrolled);
+}
+
+//  2x2 matrices of unsigned, multiplied (modulo 2^32); their powers give
+//  the Fibonacci numbers.
+namespace matrices {
+    struct matrix {
+        unsigned a, b, c, d;
+        bool operator == ( const matrix &m ) const { return a == m.a && b == m.b && c == m.c && d == m.d; }
+        };
+
+    struct product {
+        matrix operator () ( const matrix &x, const matrix &y ) const {
+            const matrix r = { x.a * y.a + x.b * y.c, x.a * y.b + x.b * y.d,
+                               x.c * y.a + x.d * y.c, x.c * y.b + x.d * y.d };
+            return r;
+            }
+        };
+
+//  Found by argument dependent lookup
+    matrix identity_operation ( product ) { const matrix i = { 1, 0, 0, 1 }; return i; }
+
+//  The (max, +) semiring's "multiplication" is +, whose identity for this
+//  type isn't what identity_operation ( std::plus<T> ) would say.
+    struct tropical { int v; };
+    struct tropical_times {
+        tropical operator () ( tropical x, tropical y ) const { tropical r = { x.v + y.v }; return r; }
+        };
+    }
+
+namespace boost { namespace algorithm {
+    template <>
+    struct identity_element<matrices::tropical_times, matrices::tropical> {
+        static matrices::tropical value ( const matrices::tropical_times & ) { matrices::tropical t = { 0 }; return t; }
+        };
+    }}
+
+void test_power_operation ()
+{
+    const matrices::matrix fib = { 1, 1, 1, 0 };
+    const matrices::matrix id = { 1, 0, 0, 1 };
+    BOOST_CHECK ( ba::power ( fib, 0, matrices::product ()) == id );
+    BOOST_CHECK ( ba::power ( fib, 1, matrices::product ()) == fib );
+    BOOST_CHECK ( ba::power ( fib, 30, matrices::product ()).b == 832040 );
+    BOOST_CHECK ( ba::power<30> ( fib, matrices::product ()).b == 832040 );
+    BOOST_CHECK ( ba::power<0> ( fib, matrices::product ()) == id );
+
+    const matrices::tropical three = { 3 };
+    BOOST_CHECK ( ba::power ( three, 0, matrices::tropical_times ()).v == 0 );
+    BOOST_CHECK ( ba::power ( three, 7, matrices::tropical_times ()).v == 21 );
+
+//  Every exponent, at run time and at compile time, against repeated multiplication
+    unsigned long expected = 1;
+    for ( int n = 0; n < 24; ++n ) {
+        BOOST_CHECK ( ba::power ( 3ul, n ) == expected );
+        BOOST_CHECK ( ba::power ( 3ul, n, std::multiplies<unsigned long> ()) == expected );
+        expected *= 3;
+        }
+    BOOST_CHECK ( ba::power<0> ( 3ul ) == 1 );
+    BOOST_CHECK ( ba::power<1> ( 3ul ) == 3 );
+    BOOST_CHECK ( ba::power<7> ( 3ul ) == ba::power ( 3ul, 7 ));
+    BOOST_CHECK ( ba::power<16> ( 3ul ) == ba::power ( 3ul, 16 ));
+    BOOST_CHECK ( ba::power<23> ( 3ul ) == ba::power ( 3ul, 23 ));
+    BOOST_CHECK ( ba::power<5> ( 2, std::plus<int> ()) == 10 );
+    BOOST_CHECK ( ba::power<3> ( 1.5 ) == 3.375 );
+#if __cplusplus >= 201402L
+    BOOST_CHECK ( ba::power ( 3, 4, std::multiplies<> ()) == 81 );
+    BOOST_CHECK ( ba::power ( 3, 0, std::multiplies<> ()) == 1 );
+    BOOST_CHECK ( ba::power ( 3, 0, std::plus<> ()) == 0 );
+#endif
+}
+
+//  The reference: multiply and reduce with a 128 bit product, a step at a time
+boost::uint64_t mul_mod_slow ( boost::uint64_t a, boost::uint64_t b, boost::uint64_t m )
+{
+    boost::uint64_t result = 0;
+    a %= m;
+    for ( ; b != 0; b >>= 1 ) {
+        if ( b & 1 )
+            result = ( result >= m - a ) ? result - ( m - a ) : result + a;
+        a = ( a >= m - a ) ? a - ( m - a ) : a + a;
+        }
+    return result;
+}
+
+boost::uint64_t power_mod_slow ( boost::uint64_t x, unsigned n, boost::uint64_t m )
+{
+    boost::uint64_t y = 1 % m;
+    for ( unsigned i = 0; i < n; ++i )
+        y = mul_mod_slow ( y, x, m );
+    return y;
+}
+
+boost::uint64_t random64 ()
+{
+    boost::uint64_t r = 0;
+    for ( int i = 0; i < 4; ++i )
+        r = ( r << 16 ) ^ static_cast<boost::uint64_t> ( std::rand () & 0xFFFF );
+    return r;
+}
+
+void test_power_mod ()
+{
+    BOOST_CHECK ( ba::power_mod ( 3, 4, 5 ) == 1 );
+    BOOST_CHECK ( ba::power_mod ( 3, 0, 5 ) == 1 );
+    BOOST_CHECK ( ba::power_mod ( 3, 0, 1 ) == 0 );
+    BOOST_CHECK ( ba::power_mod ( 0, 0, 7 ) == 1 );
+    BOOST_CHECK ( ba::power_mod ( 0, 5, 7 ) == 0 );
+    BOOST_CHECK ( ba::power_mod ( 12, 3, 5 ) == 3 );     // x >= m
+    BOOST_CHECK ( ba::power_mod ( 2u, 100, 1000000007u ) == 976371285u );
+
+//  Fermat's little theorem, for primes of 61 and 64 bits
+    const boost::uint64_t primes [] = { ( boost::uint64_t ( 1 ) << 61 ) - 1, 18446744073709551557ULL, 4294967291ULL };
+    for ( int i = 0; i < 3; ++i )
+        for ( int j = 0; j < 20; ++j ) {
+            const boost::uint64_t p = primes [ i ], x = random64 () % ( p - 1 ) + 1;
+            BOOST_CHECK ( ba::power_mod ( x, p - 1, p ) == 1 );
+            BOOST_CHECK ( ba::power_mod ( x, p, p ) == x );
+            }
+
+//  Odd and even moduli of every size, against the slow reference
+    for ( int j = 0; j < 2000; ++j ) {
+        const int bits = 2 + j % 63;
+        boost::uint64_t m = random64 () >> ( 64 - bits );
+        if ( m < 2 ) m = 2 + j;
+        const boost::uint64_t x = random64 ();
+        const unsigned n = static_cast<unsigned> ( std::rand () % 100 );
+        BOOST_CHECK ( ba::power_mod ( x, n, m ) == power_mod_slow ( x, n, m ));
+        BOOST_CHECK ( ba::power_mod ( x, n, m | 1 ) == power_mod_slow ( x, n, m | 1 ));
+        }
+    const boost::uint64_t big = ~boost::uint64_t ( 0 );
+    BOOST_CHECK ( ba::power_mod ( big - 1, 3u, big ) == power_mod_slow ( big - 1, 3, big ));
+    BOOST_CHECK ( ba::power_mod ( big - 1, 3u, big - 1 ) == 0 );
+    BOOST_CHECK ( ba::power_mod ( big - 2, 5u, big - 1 ) == power_mod_slow ( big - 2, 5, big - 1 ));
 }
 
 
 BOOST_AUTO_TEST_CASE( test_main ) {
   test_power ();
   test_power_constexpr ();
+  test_power_operation ();
+  test_power_mod ();
 }
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) agent 2026.
+
+   Distributed under the Boost Software License, Version 1.0. (See accompanying
+   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    For more information, see http://www.boost.org
+
+Test sort_subrange on large ranges, and partition_subranges and sort_subranges
+*/
+
+#include <boost/config.hpp>
+#include <boost/algorithm/sort_subrange.hpp>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace ba = boost::algorithm;
+
+typedef std::vector<int>::iterator Iter;
+
+//	Every element of [first, cut) is no greater than every element of [cut, last)
+template <typename Pred>
+bool partitioned_at ( Iter first, Iter last, Iter cut, Pred p )
+{
+	if (cut == first || cut == last) return true;
+	const Iter big = std::max_element(first, cut, p);
+	const Iter small = std::min_element(cut, last, p);
+	return !p(*small, *big);
+}
+
+std::vector<int> random_vector ( std::size_t n, int range )
+{
+	std::vector<int> v(n);
+	for (std::size_t i = 0; i < n; ++i)
+		v[i] = std::rand() % range;
+	return v;
+}
+
+void test_sort_subrange ( const std::vector<int> &v, std::size_t sf, std::size_t sl )
+{
+	std::vector<int> sorted(v);
+	std::sort(sorted.begin(), sorted.end());
+
+	std::vector<int> a(v);
+	ba::sort_subrange(a.begin(), a.end(), a.begin() + sf, a.begin() + sl);
+	BOOST_CHECK(std::equal(a.begin() + sf, a.begin() + sl, sorted.begin() + sf));
+	BOOST_CHECK(partitioned_at(a.begin(), a.end(), a.begin() + sf, std::less<int>()));
+	BOOST_CHECK(partitioned_at(a.begin(), a.end(), a.begin() + sl, std::less<int>()));
+
+	a = v;
+	std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+	ba::sort_subrange(a.begin(), a.end(), a.begin() + sf, a.begin() + sl, std::greater<int>());
+	BOOST_CHECK(std::equal(a.begin() + sf, a.begin() + sl, sorted.begin() + sf));
+}
+
+void test_subranges ( const std::vector<int> &v, const std::vector<std::size_t> &offsets )
+{
+	std::vector<int> sorted(v);
+	std::sort(sorted.begin(), sorted.end());
+
+	std::vector<int> a(v);
+	std::vector<Iter> cuts;
+	for (std::size_t i = 0; i < offsets.size(); ++i)
+		cuts.push_back(a.begin() + offsets[i]);
+	ba::partition_subranges(a.begin(), a.end(), cuts.begin(), cuts.end());
+	for (std::size_t i = 0; i < cuts.size(); ++i)
+		BOOST_CHECK(partitioned_at(a.begin(), a.end(), cuts[i], std::less<int>()));
+	std::vector<int> b(a);
+	std::sort(b.begin(), b.end());
+	BOOST_CHECK(b == sorted);
+
+	a = v;
+	ba::sort_subranges(a.begin(), a.end(), cuts.begin(), cuts.end());
+	for (std::size_t i = 0; i < cuts.size(); i += 2) {
+		const Iter sl = i + 1 < cuts.size() ? cuts[i + 1] : a.end();
+		BOOST_CHECK(std::equal(cuts[i], sl, sorted.begin() + (cuts[i] - a.begin())));
+		}
+	for (std::size_t i = 0; i < cuts.size(); ++i)
+		BOOST_CHECK(partitioned_at(a.begin(), a.end(), cuts[i], std::less<int>()));
+
+	a = v;
+	std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+	ba::sort_subranges(a.begin(), a.end(), cuts.begin(), cuts.end(), std::greater<int>());
+	for (std::size_t i = 0; i < cuts.size(); i += 2) {
+		const Iter sl = i + 1 < cuts.size() ? cuts[i + 1] : a.end();
+		BOOST_CHECK(std::equal(cuts[i], sl, sorted.begin() + (cuts[i] - a.begin())));
+		}
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+	const std::size_t n = 100000;
+	const std::vector<int> v = random_vector(n, 1000000);
+	const std::vector<int> dups = random_vector(n, 10);
+
+//	Small windows (partial_sort) and large ones (nth_element and sort)
+	test_sort_subrange(v, 0, 10);
+	test_sort_subrange(v, 500, 510);
+	test_sort_subrange(v, 0, 5000);
+	test_sort_subrange(v, 50000, 60000);
+	test_sort_subrange(v, 90000, n);
+	test_sort_subrange(v, n - 1, n);
+	test_sort_subrange(dups, 40000, 40010);
+	test_sort_subrange(dups, 40000, 70000);
+
+	std::vector<std::size_t> offsets;
+	test_subranges(v, offsets);
+	offsets.push_back(0); offsets.push_back(10);
+	test_subranges(v, offsets);
+	offsets.push_back(400); offsets.push_back(410);
+	offsets.push_back(1900); offsets.push_back(2000);
+	test_subranges(v, offsets);
+	test_subranges(dups, offsets);
+	offsets.push_back(99990);
+	test_subranges(v, offsets);
+
+//	Repeated cuts, and cuts at the ends
+	offsets.clear();
+	offsets.push_back(0); offsets.push_back(0);
+	offsets.push_back(30); offsets.push_back(30); offsets.push_back(31);
+	offsets.push_back(31); offsets.push_back(77777);
+	offsets.push_back(n); offsets.push_back(n);
+	test_subranges(v, offsets);
+	test_subranges(dups, offsets);
+}